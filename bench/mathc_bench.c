@@ -0,0 +1,1441 @@
+/*
+Microbenchmarks for the MATHC functions.
+
+Every benchmark calls one function in a loop over a pool of inputs. The loop is
+calibrated so one sample takes about `--sample-ms` milliseconds, warmed up, and
+then sampled `--samples` times. The results are written as JSON, with the time
+per operation in nanoseconds, so runs from different commits can be diffed.
+*/
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "mathc.h"
+
+#define BENCH_POOL 64
+#define BENCH_MASK (BENCH_POOL - 1)
+#define BENCH_STREAM 1024
+#define BENCH_MAX_SAMPLES 1000
+
+struct bench {
+	const char* family;
+	const char* name;
+	/* Elements processed by each call */
+	size_t items;
+	void (*run)(size_t iterations);
+	/* Largest error of the results for approximations, written next to the time, or NULL */
+	double (*error)(void);
+};
+
+#define BENCH(family, name) {#family, #name, 1, bench_##name, NULL}
+#define BENCH_ITEMS(family, name, items) {#family, #name, items, bench_##name, NULL}
+#define BENCH_ITEMS_ERROR(family, name, items)                                                     \
+	{#family, #name, items, bench_##name, bench_error_##name}
+
+/* Defines `bench_<name>`, which runs `call` once per iteration with `k` indexing the pools */
+#define BENCH_CALL(name, call)                                                                     \
+	static void bench_##name(size_t iterations)                                                    \
+	{                                                                                              \
+		for (size_t i = 0; i < iterations; i++) {                                                  \
+			size_t k = i & BENCH_MASK;                                                             \
+			call;                                                                                  \
+		}                                                                                          \
+	}
+
+/* Defines `bench_<name>`, which runs `call` once per iteration over the whole stream */
+#define BENCH_STREAM_CALL(name, call)                                                              \
+	static void bench_##name(size_t iterations)                                                    \
+	{                                                                                              \
+		for (size_t i = 0; i < iterations; i++) {                                                  \
+			call;                                                                                  \
+		}                                                                                          \
+	}
+
+static volatile double bench_sink;
+
+#if defined(MATHC_USE_INT)
+static mint_t in_ia[BENCH_POOL][VEC4_SIZE];
+static mint_t in_ib[BENCH_POOL][VEC4_SIZE];
+static mint_t in_ic[BENCH_POOL][VEC4_SIZE];
+static mint_t in_i[BENCH_POOL];
+static mint_t out_i[BENCH_POOL][VEC4_SIZE];
+static mint_t out_is[BENCH_POOL];
+#endif
+
+#if defined(MATHC_USE_FLOATING_POINT)
+static mfloat_t in_a[BENCH_POOL][MAT4_SIZE];
+static mfloat_t in_b[BENCH_POOL][MAT4_SIZE];
+static mfloat_t in_c[BENCH_POOL][MAT4_SIZE];
+static mfloat_t in_d[BENCH_POOL][MAT4_SIZE];
+/* Unit quaternions */
+static mfloat_t in_q0[BENCH_POOL][QUAT_SIZE];
+static mfloat_t in_q1[BENCH_POOL][QUAT_SIZE];
+/* Rotations with a translation, for the inverses that require them */
+static mfloat_t in_rigid[BENCH_POOL][MAT4_SIZE];
+/* The same rotations and translations as unit dual quaternions */
+static mfloat_t in_dq[BENCH_POOL][DUALQUAT_SIZE];
+/* The same rotations and translations with a scale that isn't uniform */
+static mfloat_t in_tr[BENCH_POOL][TRANSFORM_SIZE];
+/* Interpolation factors in [0, 1] */
+static mfloat_t in_t[BENCH_POOL];
+static mfloat_t out_f[BENCH_POOL][MAT4_SIZE];
+static mfloat_t out_s[BENCH_POOL];
+static bool out_b[BENCH_POOL];
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+static mfloat_t stream_a[3][BENCH_STREAM];
+static mfloat_t stream_b[3][BENCH_STREAM];
+static mfloat_t stream_r[3][BENCH_STREAM];
+/* Affine matrix, and the stream as padded vec4 for the per-vertex baseline */
+static mfloat_t stream_m[MAT4_SIZE];
+static mfloat_t stream_v4[BENCH_STREAM][VEC4_SIZE];
+/* Pairs of unit quaternions in SoA layout for the batched blends */
+static mfloat_t stream_q0[QUAT_SIZE][BENCH_STREAM];
+static mfloat_t stream_q1[QUAT_SIZE][BENCH_STREAM];
+static mfloat_t stream_rq[QUAT_SIZE][BENCH_STREAM];
+/* A box that holds about half of the stream, and the visibility of each item */
+static mfloat_t stream_frustum[FRUSTUM_SIZE];
+static uint32_t stream_mask[BENCH_STREAM / 32];
+/* Index of the nearest object hit by a ray */
+static size_t stream_hit;
+/* Four weighted bones per item from a palette of BENCH_POOL bones, and skinned normals */
+static mfloat_t stream_palette[BENCH_POOL][AFFINE_SIZE];
+static uint16_t stream_bones[BENCH_STREAM * SKIN_BONES];
+static mfloat_t stream_weights[BENCH_STREAM * SKIN_BONES];
+static mfloat_t stream_rn[3][BENCH_STREAM];
+/* Nodes of a hierarchy, each a child of one of the eight nodes before it */
+static mfloat_t stream_nodes[BENCH_STREAM][TRANSFORM_SIZE];
+static int32_t stream_parents[BENCH_STREAM];
+static mfloat_t stream_world[BENCH_STREAM][MAT4_SIZE];
+static mfloat_t stream_world_tr[BENCH_STREAM][TRANSFORM_SIZE];
+#if defined(MATHC_USE_EASING_FUNCTIONS)
+/* Interpolation factors in [0, 1] for the batched easing */
+static mfloat_t stream_t[BENCH_STREAM];
+#endif
+#endif
+#if defined(MATHC_USE_FLOATING_POINT) && defined(MATHC_USE_EASING_FUNCTIONS)
+/* elastic_ease_in_out sampled for the table lookups */
+#define BENCH_EASING_TABLE 256
+static mfloat_t easing_table[BENCH_EASING_TABLE];
+/* The CSS ease curve, cubic-bezier(0.25, 0.1, 0.25, 1) */
+static struct mathc_cubic_bezier easing_bezier;
+#endif
+#if defined(MATHC_USE_STRUCT_FUNCTIONS)
+static struct vec3 in_sv3a[BENCH_POOL];
+static struct vec3 in_sv3b[BENCH_POOL];
+static struct vec4 in_sv4a[BENCH_POOL];
+static struct vec4 in_sv4b[BENCH_POOL];
+static struct quat in_sq0[BENCH_POOL];
+static struct quat in_sq1[BENCH_POOL];
+static struct vec3 out_sv3[BENCH_POOL];
+static struct vec4 out_sv4[BENCH_POOL];
+static struct quat out_sq[BENCH_POOL];
+#endif
+#endif
+
+static unsigned int bench_random_state = 12345u;
+
+/* Deterministic pseudo-random value in [-1, 1) */
+static double bench_random(void)
+{
+	bench_random_state = bench_random_state * 1664525u + 1013904223u;
+	return (double)(bench_random_state >> 8) / 8388608.0 - 1.0;
+}
+
+static void bench_fill(void)
+{
+	for (int k = 0; k < BENCH_POOL; k++) {
+#if defined(MATHC_USE_INT)
+		for (int j = 0; j < VEC4_SIZE; j++) {
+			in_ia[k][j] = (mint_t)(bench_random() * 50.0);
+			in_ib[k][j] = (mint_t)(bench_random() * 10.0);
+			if (in_ib[k][j] == 0) {
+				in_ib[k][j] = 3;
+			}
+			in_ic[k][j] = in_ib[k][j] + 20;
+		}
+		in_i[k] = (mint_t)(k % 7 + 2);
+#endif
+#if defined(MATHC_USE_FLOATING_POINT)
+		for (int j = 0; j < MAT4_SIZE; j++) {
+			in_a[k][j] = (mfloat_t)(bench_random() * 4.0);
+			in_b[k][j] = (mfloat_t)(bench_random() * 4.0);
+			in_c[k][j] = (mfloat_t)(bench_random() * 4.0);
+			in_d[k][j] = (mfloat_t)(bench_random() * 4.0);
+		}
+		for (int j = 0; j < QUAT_SIZE; j++) {
+			in_q0[k][j] = (mfloat_t)bench_random();
+			in_q1[k][j] = (mfloat_t)bench_random();
+		}
+		quat_normalize(in_q0[k], in_q0[k]);
+		quat_normalize(in_q1[k], in_q1[k]);
+		mat4_rotation_quat(in_rigid[k], in_q0[k]);
+		in_rigid[k][12] = in_a[k][0];
+		in_rigid[k][13] = in_a[k][1];
+		in_rigid[k][14] = in_a[k][2];
+		dualquat_from_quat_vec3(in_dq[k], in_q0[k], in_a[k]);
+		in_t[k] = (mfloat_t)(bench_random() * 0.5 + 0.5);
+		for (int j = 0; j < VEC3_SIZE; j++) {
+			out_f[k][j] = MFABS(in_b[k][j]) + MFLOAT_C(0.5);
+		}
+		transform_from_trs(in_tr[k], in_a[k], in_q0[k], out_f[k]);
+#if defined(MATHC_USE_STRUCT_FUNCTIONS)
+		in_sv3a[k] = svec3(in_a[k][0], in_a[k][1], in_a[k][2]);
+		in_sv3b[k] = svec3(in_b[k][0], in_b[k][1], in_b[k][2]);
+		in_sv4a[k] = svec4(in_a[k][0], in_a[k][1], in_a[k][2], in_a[k][3]);
+		in_sv4b[k] = svec4(in_b[k][0], in_b[k][1], in_b[k][2], in_b[k][3]);
+		in_sq0[k] = squat(in_q0[k][0], in_q0[k][1], in_q0[k][2], in_q0[k][3]);
+		in_sq1[k] = squat(in_q1[k][0], in_q1[k][1], in_q1[k][2], in_q1[k][3]);
+#endif
+#endif
+	}
+#if defined(MATHC_USE_FLOATING_POINT) && defined(MATHC_USE_STREAM_FUNCTIONS)
+	for (int c = 0; c < 3; c++) {
+		for (int i = 0; i < BENCH_STREAM; i++) {
+			stream_a[c][i] = (mfloat_t)(bench_random() * 4.0);
+			stream_b[c][i] = (mfloat_t)(bench_random() * 4.0);
+		}
+	}
+	for (int i = 0; i < BENCH_STREAM; i++) {
+		stream_v4[i][0] = stream_a[0][i];
+		stream_v4[i][1] = stream_a[1][i];
+		stream_v4[i][2] = stream_a[2][i];
+		stream_v4[i][3] = MFLOAT_C(1.0);
+	}
+	for (int i = 0; i < BENCH_STREAM; i++) {
+		mfloat_t q0[QUAT_SIZE];
+		mfloat_t q1[QUAT_SIZE];
+		for (int j = 0; j < QUAT_SIZE; j++) {
+			q0[j] = (mfloat_t)(bench_random() * 2.0 - 1.0);
+			q1[j] = (mfloat_t)(bench_random() * 2.0 - 1.0);
+		}
+		quat_normalize(q0, q0);
+		quat_normalize(q1, q1);
+		for (int j = 0; j < QUAT_SIZE; j++) {
+			stream_q0[j][i] = q0[j];
+			stream_q1[j][i] = q1[j];
+		}
+	}
+#if defined(MATHC_USE_EASING_FUNCTIONS)
+	for (int i = 0; i < BENCH_STREAM; i++) {
+		stream_t[i] = (mfloat_t)(bench_random() * 0.5 + 0.5);
+	}
+#endif
+	for (int i = 0; i < BENCH_STREAM; i++) {
+		mfloat_t total = MFLOAT_C(0.0);
+		for (int j = 0; j < SKIN_BONES; j++) {
+			double bone = (bench_random() + 1.0) * (BENCH_POOL / 2);
+			stream_bones[i * SKIN_BONES + j] = (uint16_t)bone;
+			stream_weights[i * SKIN_BONES + j] = (mfloat_t)(bench_random() + 1.5);
+			total += stream_weights[i * SKIN_BONES + j];
+		}
+		for (int j = 0; j < SKIN_BONES; j++) {
+			stream_weights[i * SKIN_BONES + j] /= total;
+		}
+	}
+	for (int k = 0; k < BENCH_POOL; k++) {
+		affine_from_mat4(stream_palette[k], in_a[k]);
+	}
+	for (int i = 0; i < BENCH_STREAM; i++) {
+		stream_parents[i] = i - 1 - (int32_t)((bench_random() + 1.0) * 4.0);
+		if (stream_parents[i] < 0) {
+			stream_parents[i] = -1;
+		}
+		for (int j = 0; j < TRANSFORM_SIZE; j++) {
+			stream_nodes[i][j] = in_tr[i & BENCH_MASK][j];
+		}
+	}
+	mat4_rotation_quat(stream_m, in_q0[0]);
+	stream_m[12] = in_a[0][0];
+	stream_m[13] = in_a[0][1];
+	stream_m[14] = in_a[0][2];
+	mat4_ortho(out_f[0], MFLOAT_C(-2.0), MFLOAT_C(2.0), MFLOAT_C(-2.0), MFLOAT_C(2.0),
+			   MFLOAT_C(-2.0), MFLOAT_C(2.0));
+	frustum_from_mat4(stream_frustum, out_f[0]);
+#endif
+#if defined(MATHC_USE_FLOATING_POINT) && defined(MATHC_USE_EASING_FUNCTIONS)
+	mathc_easing_table(easing_table, BENCH_EASING_TABLE, elastic_ease_in_out);
+	mathc_cubic_bezier(&easing_bezier, MFLOAT_C(0.25), MFLOAT_C(0.1), MFLOAT_C(0.25),
+					   MFLOAT_C(1.0));
+#endif
+}
+
+/* Reads the outputs so the compiler can't discard the benchmarked calls */
+static void bench_consume(void)
+{
+	double sum = 0.0;
+	for (int k = 0; k < BENCH_POOL; k++) {
+#if defined(MATHC_USE_INT)
+		sum += (double)out_i[k][0] + (double)out_is[k];
+#endif
+#if defined(MATHC_USE_FLOATING_POINT)
+		sum += (double)out_f[k][0] + (double)out_s[k] + (double)out_b[k];
+#if defined(MATHC_USE_STRUCT_FUNCTIONS)
+		sum += (double)out_sv3[k].x + (double)out_sv4[k].x + (double)out_sq[k].x;
+#endif
+#endif
+	}
+#if defined(MATHC_USE_FLOATING_POINT) && defined(MATHC_USE_STREAM_FUNCTIONS)
+	sum += (double)stream_r[0][0] + (double)stream_r[1][0] + (double)stream_r[2][0];
+	sum += (double)stream_rq[0][0] + (double)stream_mask[0] + (double)stream_hit;
+	sum += (double)stream_rn[0][0];
+#endif
+	bench_sink = sum;
+}
+
+#if defined(MATHC_USE_INT)
+BENCH_CALL(clampi, out_is[k] = clampi(in_ia[k][0], in_ib[k][0], in_ic[k][0]))
+
+BENCH_CALL(vec2i_is_equal, out_is[k] = vec2i_is_equal(in_ia[k], in_ib[k]))
+BENCH_CALL(vec2i_add, vec2i_add(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec2i_add_i, vec2i_add_i(out_i[k], in_ia[k], in_i[k]))
+BENCH_CALL(vec2i_subtract, vec2i_subtract(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec2i_multiply, vec2i_multiply(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec2i_multiply_i, vec2i_multiply_i(out_i[k], in_ia[k], in_i[k]))
+BENCH_CALL(vec2i_divide, vec2i_divide(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec2i_divide_i, vec2i_divide_i(out_i[k], in_ia[k], in_i[k]))
+BENCH_CALL(vec2i_snap, vec2i_snap(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec2i_negative, vec2i_negative(out_i[k], in_ia[k]))
+BENCH_CALL(vec2i_abs, vec2i_abs(out_i[k], in_ia[k]))
+BENCH_CALL(vec2i_max, vec2i_max(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec2i_min, vec2i_min(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec2i_clamp, vec2i_clamp(out_i[k], in_ia[k], in_ib[k], in_ic[k]))
+BENCH_CALL(vec2i_tangent, vec2i_tangent(out_i[k], in_ia[k]))
+
+BENCH_CALL(vec3i_is_equal, out_is[k] = vec3i_is_equal(in_ia[k], in_ib[k]))
+BENCH_CALL(vec3i_add, vec3i_add(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec3i_add_i, vec3i_add_i(out_i[k], in_ia[k], in_i[k]))
+BENCH_CALL(vec3i_subtract, vec3i_subtract(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec3i_multiply, vec3i_multiply(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec3i_multiply_i, vec3i_multiply_i(out_i[k], in_ia[k], in_i[k]))
+BENCH_CALL(vec3i_divide, vec3i_divide(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec3i_divide_i, vec3i_divide_i(out_i[k], in_ia[k], in_i[k]))
+BENCH_CALL(vec3i_snap, vec3i_snap(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec3i_cross, vec3i_cross(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec3i_negative, vec3i_negative(out_i[k], in_ia[k]))
+BENCH_CALL(vec3i_abs, vec3i_abs(out_i[k], in_ia[k]))
+BENCH_CALL(vec3i_max, vec3i_max(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec3i_min, vec3i_min(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec3i_clamp, vec3i_clamp(out_i[k], in_ia[k], in_ib[k], in_ic[k]))
+
+BENCH_CALL(vec4i_is_equal, out_is[k] = vec4i_is_equal(in_ia[k], in_ib[k]))
+BENCH_CALL(vec4i_add, vec4i_add(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec4i_add_i, vec4i_add_i(out_i[k], in_ia[k], in_i[k]))
+BENCH_CALL(vec4i_subtract, vec4i_subtract(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec4i_multiply, vec4i_multiply(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec4i_multiply_i, vec4i_multiply_i(out_i[k], in_ia[k], in_i[k]))
+BENCH_CALL(vec4i_divide, vec4i_divide(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec4i_divide_i, vec4i_divide_i(out_i[k], in_ia[k], in_i[k]))
+BENCH_CALL(vec4i_snap, vec4i_snap(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec4i_negative, vec4i_negative(out_i[k], in_ia[k]))
+BENCH_CALL(vec4i_abs, vec4i_abs(out_i[k], in_ia[k]))
+BENCH_CALL(vec4i_max, vec4i_max(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec4i_min, vec4i_min(out_i[k], in_ia[k], in_ib[k]))
+BENCH_CALL(vec4i_clamp, vec4i_clamp(out_i[k], in_ia[k], in_ib[k], in_ic[k]))
+#endif
+
+#if defined(MATHC_USE_FLOATING_POINT)
+BENCH_CALL(clampf, out_s[k] = clampf(in_a[k][0], in_b[k][0], in_c[k][0]))
+BENCH_CALL(lerp, out_s[k] = lerp(in_a[k][0], in_b[k][0], in_t[k]))
+BENCH_CALL(remap, out_s[k] = remap(in_a[k][0], -4, 4, in_b[k][0], in_c[k][0]))
+
+/* The polynomial transcendental functions next to the C library functions they replace */
+BENCH_CALL(mathc_sin_fast, out_s[k] = mathc_sin_fast(in_a[k][0]))
+BENCH_CALL(c_sin, out_s[k] = MSIN(in_a[k][0]))
+BENCH_CALL(mathc_acos_fast, out_s[k] = mathc_acos_fast(in_t[k]))
+BENCH_CALL(c_acos, out_s[k] = MACOS(in_t[k]))
+BENCH_CALL(mathc_atan2_fast, out_s[k] = mathc_atan2_fast(in_a[k][0], in_b[k][0]))
+BENCH_CALL(c_atan2, out_s[k] = MATAN2(in_a[k][0], in_b[k][0]))
+BENCH_CALL(mathc_exp2_fast, out_s[k] = mathc_exp2_fast(in_a[k][0]))
+BENCH_CALL(c_exp2, out_s[k] = MPOW(MFLOAT_C(2.0), in_a[k][0]))
+
+BENCH_CALL(vec2_is_equal, out_b[k] = vec2_is_equal(in_a[k], in_b[k]))
+BENCH_CALL(vec2_add, vec2_add(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec2_add_f, vec2_add_f(out_f[k], in_a[k], in_t[k]))
+BENCH_CALL(vec2_subtract, vec2_subtract(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec2_multiply, vec2_multiply(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec2_multiply_f, vec2_multiply_f(out_f[k], in_a[k], in_t[k]))
+BENCH_CALL(vec2_multiply_mat2, vec2_multiply_mat2(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec2_divide, vec2_divide(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec2_snap, vec2_snap(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec2_negative, vec2_negative(out_f[k], in_a[k]))
+BENCH_CALL(vec2_abs, vec2_abs(out_f[k], in_a[k]))
+BENCH_CALL(vec2_floor, vec2_floor(out_f[k], in_a[k]))
+BENCH_CALL(vec2_round, vec2_round(out_f[k], in_a[k]))
+BENCH_CALL(vec2_max, vec2_max(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec2_min, vec2_min(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec2_clamp, vec2_clamp(out_f[k], in_a[k], in_b[k], in_c[k]))
+BENCH_CALL(vec2_normalize, vec2_normalize(out_f[k], in_a[k]))
+BENCH_CALL(vec2_normalize_fast, vec2_normalize_fast(out_f[k], in_a[k]))
+BENCH_CALL(vec2_dot, out_s[k] = vec2_dot(in_a[k], in_b[k]))
+BENCH_CALL(vec2_project, vec2_project(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec2_slide, vec2_slide(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec2_reflect, vec2_reflect(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec2_tangent, vec2_tangent(out_f[k], in_a[k]))
+BENCH_CALL(vec2_rotate, vec2_rotate(out_f[k], in_a[k], in_t[k]))
+BENCH_CALL(vec2_lerp, vec2_lerp(out_f[k], in_a[k], in_b[k], in_t[k]))
+BENCH_CALL(vec2_bezier3, vec2_bezier3(out_f[k], in_a[k], in_b[k], in_c[k], in_t[k]))
+BENCH_CALL(vec2_bezier4, vec2_bezier4(out_f[k], in_a[k], in_b[k], in_c[k], in_d[k], in_t[k]))
+BENCH_CALL(vec2_angle, out_s[k] = vec2_angle(in_a[k]))
+BENCH_CALL(vec2_length, out_s[k] = vec2_length(in_a[k]))
+BENCH_CALL(vec2_length_squared, out_s[k] = vec2_length_squared(in_a[k]))
+BENCH_CALL(vec2_distance, out_s[k] = vec2_distance(in_a[k], in_b[k]))
+BENCH_CALL(vec2_linear_independent, out_b[k] = vec2_linear_independent(in_a[k], in_b[k]))
+
+BENCH_CALL(vec3_is_equal, out_b[k] = vec3_is_equal(in_a[k], in_b[k]))
+BENCH_CALL(vec3_add, vec3_add(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec3_add_f, vec3_add_f(out_f[k], in_a[k], in_t[k]))
+BENCH_CALL(vec3_subtract, vec3_subtract(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec3_multiply, vec3_multiply(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec3_multiply_f, vec3_multiply_f(out_f[k], in_a[k], in_t[k]))
+BENCH_CALL(vec3_multiply_mat3, vec3_multiply_mat3(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec3_divide, vec3_divide(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec3_snap, vec3_snap(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec3_negative, vec3_negative(out_f[k], in_a[k]))
+BENCH_CALL(vec3_abs, vec3_abs(out_f[k], in_a[k]))
+BENCH_CALL(vec3_floor, vec3_floor(out_f[k], in_a[k]))
+BENCH_CALL(vec3_round, vec3_round(out_f[k], in_a[k]))
+BENCH_CALL(vec3_max, vec3_max(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec3_min, vec3_min(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec3_clamp, vec3_clamp(out_f[k], in_a[k], in_b[k], in_c[k]))
+BENCH_CALL(vec3_cross, vec3_cross(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec3_normalize, vec3_normalize(out_f[k], in_a[k]))
+BENCH_CALL(vec3_normalize_fast, vec3_normalize_fast(out_f[k], in_a[k]))
+BENCH_CALL(vec3_dot, out_s[k] = vec3_dot(in_a[k], in_b[k]))
+BENCH_CALL(vec3_project, vec3_project(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec3_slide, vec3_slide(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec3_reflect, vec3_reflect(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec3_rotate, vec3_rotate(out_f[k], in_a[k], in_b[k], in_t[k]))
+BENCH_CALL(vec3_lerp, vec3_lerp(out_f[k], in_a[k], in_b[k], in_t[k]))
+BENCH_CALL(vec3_bezier3, vec3_bezier3(out_f[k], in_a[k], in_b[k], in_c[k], in_t[k]))
+BENCH_CALL(vec3_bezier4, vec3_bezier4(out_f[k], in_a[k], in_b[k], in_c[k], in_d[k], in_t[k]))
+BENCH_CALL(vec3_length, out_s[k] = vec3_length(in_a[k]))
+BENCH_CALL(vec3_length_squared, out_s[k] = vec3_length_squared(in_a[k]))
+BENCH_CALL(vec3_distance, out_s[k] = vec3_distance(in_a[k], in_b[k]))
+BENCH_CALL(vec3_linear_independent,
+		   out_b[k] = vec3_linear_independent(in_a[k], in_b[k], in_c[k]))
+
+BENCH_CALL(vec4_is_equal, out_b[k] = vec4_is_equal(in_a[k], in_b[k]))
+BENCH_CALL(vec4_add, vec4_add(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec4_add_f, vec4_add_f(out_f[k], in_a[k], in_t[k]))
+BENCH_CALL(vec4_subtract, vec4_subtract(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec4_multiply, vec4_multiply(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec4_multiply_f, vec4_multiply_f(out_f[k], in_a[k], in_t[k]))
+BENCH_CALL(vec4_multiply_mat4, vec4_multiply_mat4(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec4_divide, vec4_divide(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec4_snap, vec4_snap(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec4_negative, vec4_negative(out_f[k], in_a[k]))
+BENCH_CALL(vec4_abs, vec4_abs(out_f[k], in_a[k]))
+BENCH_CALL(vec4_floor, vec4_floor(out_f[k], in_a[k]))
+BENCH_CALL(vec4_round, vec4_round(out_f[k], in_a[k]))
+BENCH_CALL(vec4_max, vec4_max(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec4_min, vec4_min(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(vec4_clamp, vec4_clamp(out_f[k], in_a[k], in_b[k], in_c[k]))
+BENCH_CALL(vec4_normalize, vec4_normalize(out_f[k], in_a[k]))
+BENCH_CALL(vec4_normalize_fast, vec4_normalize_fast(out_f[k], in_a[k]))
+BENCH_CALL(vec4_lerp, vec4_lerp(out_f[k], in_a[k], in_b[k], in_t[k]))
+
+BENCH_CALL(quat_multiply, quat_multiply(out_f[k], in_q0[k], in_q1[k]))
+BENCH_CALL(quat_divide, quat_divide(out_f[k], in_q0[k], in_q1[k]))
+BENCH_CALL(quat_conjugate, quat_conjugate(out_f[k], in_q0[k]))
+BENCH_CALL(quat_inverse, quat_inverse(out_f[k], in_q0[k]))
+BENCH_CALL(quat_normalize, quat_normalize(out_f[k], in_a[k]))
+BENCH_CALL(quat_normalize_fast, quat_normalize_fast(out_f[k], in_a[k]))
+BENCH_CALL(quat_dot, out_s[k] = quat_dot(in_q0[k], in_q1[k]))
+BENCH_CALL(quat_power, quat_power(out_f[k], in_q0[k], in_t[k]))
+BENCH_CALL(quat_from_axis_angle, quat_from_axis_angle(out_f[k], in_q0[k], in_t[k]))
+BENCH_CALL(quat_from_vec3, quat_from_vec3(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(quat_from_mat4, quat_from_mat4(out_f[k], in_a[k]))
+BENCH_CALL(quat_lerp, quat_lerp(out_f[k], in_q0[k], in_q1[k], in_t[k]))
+BENCH_CALL(quat_slerp, quat_slerp(out_f[k], in_q0[k], in_q1[k], in_t[k]))
+BENCH_CALL(quat_length, out_s[k] = quat_length(in_q0[k]))
+BENCH_CALL(quat_angle, out_s[k] = quat_angle(in_q0[k], in_q1[k]))
+BENCH_CALL(quat_rotate_vec3, quat_rotate_vec3(out_f[k], in_q0[k], in_a[k]))
+
+/* What quat_rotate_vec3 replaces: a rotation matrix built for each vector */
+static void quat_rotate_vec3_mat3(mfloat_t* result, mfloat_t* q0, mfloat_t* v0)
+{
+	mfloat_t m[MAT3_SIZE];
+	mat3_rotation_quat(m, q0);
+	vec3_multiply_mat3(result, v0, m);
+}
+
+BENCH_CALL(quat_rotate_vec3_mat3, quat_rotate_vec3_mat3(out_f[k], in_q0[k], in_a[k]))
+
+BENCH_CALL(mat2_determinant, out_s[k] = mat2_determinant(in_a[k]))
+BENCH_CALL(mat2_transpose, mat2_transpose(out_f[k], in_a[k]))
+BENCH_CALL(mat2_cofactor, mat2_cofactor(out_f[k], in_a[k]))
+BENCH_CALL(mat2_adjugate, mat2_adjugate(out_f[k], in_a[k]))
+BENCH_CALL(mat2_multiply, mat2_multiply(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(mat2_multiply_f, mat2_multiply_f(out_f[k], in_a[k], in_t[k]))
+BENCH_CALL(mat2_inverse, mat2_inverse(out_f[k], in_a[k]))
+BENCH_CALL(mat2_scale, mat2_scale(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(mat2_rotation_z, mat2_rotation_z(out_f[k], in_t[k]))
+BENCH_CALL(mat2_lerp, mat2_lerp(out_f[k], in_a[k], in_b[k], in_t[k]))
+
+BENCH_CALL(mat3_determinant, out_s[k] = mat3_determinant(in_a[k]))
+BENCH_CALL(mat3_transpose, mat3_transpose(out_f[k], in_a[k]))
+BENCH_CALL(mat3_cofactor, mat3_cofactor(out_f[k], in_a[k]))
+BENCH_CALL(mat3_multiply, mat3_multiply(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(mat3_multiply_f, mat3_multiply_f(out_f[k], in_a[k], in_t[k]))
+BENCH_CALL(mat3_inverse, mat3_inverse(out_f[k], in_a[k]))
+BENCH_CALL(mat3_scale, mat3_scale(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(mat3_rotation_x, mat3_rotation_x(out_f[k], in_t[k]))
+BENCH_CALL(mat3_rotation_axis, mat3_rotation_axis(out_f[k], in_q0[k], in_t[k]))
+BENCH_CALL(mat3_rotation_quat, mat3_rotation_quat(out_f[k], in_q0[k]))
+BENCH_CALL(mat3_lerp, mat3_lerp(out_f[k], in_a[k], in_b[k], in_t[k]))
+
+BENCH_CALL(mat4_determinant, out_s[k] = mat4_determinant(in_a[k]))
+BENCH_CALL(mat4_transpose, mat4_transpose(out_f[k], in_a[k]))
+BENCH_CALL(mat4_cofactor, mat4_cofactor(out_f[k], in_a[k]))
+BENCH_CALL(mat4_rotation_x, mat4_rotation_x(out_f[k], in_t[k]))
+BENCH_CALL(mat4_rotation_axis, mat4_rotation_axis(out_f[k], in_q0[k], in_t[k]))
+BENCH_CALL(mat4_rotation_quat, mat4_rotation_quat(out_f[k], in_q0[k]))
+BENCH_CALL(mat4_translation, mat4_translation(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(mat4_translate, mat4_translate(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(mat4_scale, mat4_scale(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(mat4_multiply, mat4_multiply(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(mat4_multiply_f, mat4_multiply_f(out_f[k], in_a[k], in_t[k]))
+BENCH_CALL(mat4_inverse, mat4_inverse(out_f[k], in_a[k]))
+BENCH_CALL(mat4_inverse_affine, mat4_inverse_affine(out_f[k], in_rigid[k]))
+BENCH_CALL(mat4_inverse_rigid, mat4_inverse_rigid(out_f[k], in_rigid[k]))
+BENCH_CALL(mat4_lerp, mat4_lerp(out_f[k], in_a[k], in_b[k], in_t[k]))
+BENCH_CALL(mat4_look_at, mat4_look_at(out_f[k], in_a[k], in_b[k], in_q0[k]))
+BENCH_CALL(mat4_ortho, mat4_ortho(out_f[k], -in_a[k][0], in_a[k][0] + 5, -1, 1, in_t[k], 100))
+BENCH_CALL(mat4_perspective, mat4_perspective(out_f[k], in_t[k] + 0.5f, 1.5f, 0.1f, 100))
+BENCH_CALL(mat4_perspective_infinite,
+		   mat4_perspective_infinite(out_f[k], in_t[k] + 0.5f, 1.5f, 0.1f))
+/* The first 12 values of the pools are read as affine matrices */
+BENCH_CALL(affine_multiply, affine_multiply(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(affine_inverse, affine_inverse(out_f[k], in_a[k]))
+BENCH_CALL(affine_inverse_rigid, affine_inverse_rigid(out_f[k], in_a[k]))
+BENCH_CALL(affine_transform_point, affine_transform_point(out_f[k], in_a[k], in_b[k]))
+BENCH_CALL(dualquat_multiply, dualquat_multiply(out_f[k], in_dq[k], in_dq[(k + 1) & BENCH_MASK]))
+BENCH_CALL(dualquat_normalize, dualquat_normalize(out_f[k], in_dq[k]))
+BENCH_CALL(dualquat_transform_point, dualquat_transform_point(out_f[k], in_dq[k], in_b[k]))
+BENCH_CALL(mat4_from_dualquat, mat4_from_dualquat(out_f[k], in_dq[k]))
+BENCH_CALL(transform_multiply,
+		   transform_multiply(out_f[k], in_tr[k], in_tr[(k + 1) & BENCH_MASK]))
+BENCH_CALL(transform_inverse, transform_inverse(out_f[k], in_tr[k]))
+BENCH_CALL(mat4_from_transform, mat4_from_transform(out_f[k], in_tr[k]))
+
+/* What mat4_from_transform replaces: three matrices and two products */
+static void mat4_trs_product(mfloat_t* result, mfloat_t* t0)
+{
+	mfloat_t translation[MAT4_SIZE];
+	mfloat_t rotation[MAT4_SIZE];
+	mfloat_t scaling[MAT4_SIZE];
+	mat4_identity(translation);
+	mat4_identity(scaling);
+	mat4_translation(translation, translation, t0);
+	mat4_rotation_quat(rotation, t0 + 3);
+	mat4_scaling(scaling, scaling, t0 + 7);
+	mat4_multiply(result, rotation, scaling);
+	mat4_multiply(result, translation, result);
+}
+
+BENCH_CALL(mat4_trs_product, mat4_trs_product(out_f[k], in_tr[k]))
+
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+#define BENCH_STREAM_R stream_r[0], stream_r[1], stream_r[2]
+#define BENCH_STREAM_A stream_a[0], stream_a[1], stream_a[2]
+#define BENCH_STREAM_B stream_b[0], stream_b[1], stream_b[2]
+
+BENCH_STREAM_CALL(vec3_add_n, vec3_add_n(BENCH_STREAM_R, BENCH_STREAM_A, BENCH_STREAM_B,
+										 BENCH_STREAM))
+BENCH_STREAM_CALL(vec3_multiply_f_n,
+				  vec3_multiply_f_n(BENCH_STREAM_R, BENCH_STREAM_A, in_t[i & BENCH_MASK],
+									BENCH_STREAM))
+BENCH_STREAM_CALL(vec3_multiply_mat3_n,
+				  vec3_multiply_mat3_n(BENCH_STREAM_R, BENCH_STREAM_A, in_a[i & BENCH_MASK],
+									   BENCH_STREAM))
+BENCH_STREAM_CALL(vec3_cross_n, vec3_cross_n(BENCH_STREAM_R, BENCH_STREAM_A, BENCH_STREAM_B,
+											 BENCH_STREAM))
+BENCH_STREAM_CALL(vec3_normalize_n, vec3_normalize_n(BENCH_STREAM_R, BENCH_STREAM_A,
+													 BENCH_STREAM))
+BENCH_STREAM_CALL(vec3_lerp_n,
+				  vec3_lerp_n(BENCH_STREAM_R, BENCH_STREAM_A, BENCH_STREAM_B,
+							  in_t[i & BENCH_MASK], BENCH_STREAM))
+BENCH_STREAM_CALL(vec3_dot_n, vec3_dot_n(stream_r[0], BENCH_STREAM_A, BENCH_STREAM_B,
+										 BENCH_STREAM))
+BENCH_STREAM_CALL(vec3_length_n, vec3_length_n(stream_r[0], BENCH_STREAM_A, BENCH_STREAM))
+BENCH_STREAM_CALL(vec3_distance_n, vec3_distance_n(stream_r[0], BENCH_STREAM_A, BENCH_STREAM_B,
+												   BENCH_STREAM))
+/* The stream arrays are contiguous, so stream_a[0] also holds BENCH_STREAM packed vec3 */
+BENCH_STREAM_CALL(mat4_transform_points_n,
+				  mat4_transform_points_n(stream_r[0], 0, stream_a[0], 0, stream_m, BENCH_STREAM))
+BENCH_STREAM_CALL(mat4_transform_points_n_projective,
+				  mat4_transform_points_n(stream_r[0], 0, stream_a[0], 0, in_a[i & BENCH_MASK],
+										  BENCH_STREAM))
+BENCH_STREAM_CALL(mat4_transform_directions_n,
+				  mat4_transform_directions_n(stream_r[0], 0, stream_a[0], 0, stream_m,
+											  BENCH_STREAM))
+
+/* What mat4_transform_points_n replaces: one call per vertex padded to vec4 */
+static void vec4_multiply_mat4_loop(void)
+{
+	for (size_t j = 0; j < BENCH_STREAM; j++) {
+		vec4_multiply_mat4(stream_v4[j], stream_v4[j], stream_m);
+	}
+}
+
+BENCH_STREAM_CALL(vec4_multiply_mat4_loop, vec4_multiply_mat4_loop())
+
+/* Rotations whose mat4 results fit in stream_r, with packed axes from stream_a */
+#define BENCH_ROTATIONS (BENCH_STREAM / 8)
+
+BENCH_STREAM_CALL(mat4_rotation_axis_n,
+				  mat4_rotation_axis_n(stream_r[0], stream_a[0], stream_b[0], BENCH_ROTATIONS))
+BENCH_STREAM_CALL(quat_from_axis_angle_n,
+				  quat_from_axis_angle_n(stream_r[0], stream_a[0], stream_b[0], BENCH_ROTATIONS))
+
+/* What mat4_rotation_axis_n replaces: one call per rotation */
+static void mat4_rotation_axis_loop(void)
+{
+	for (size_t j = 0; j < BENCH_ROTATIONS; j++) {
+		mat4_rotation_axis(stream_r[0] + j * MAT4_SIZE, stream_a[0] + j * VEC3_SIZE,
+						   stream_b[0][j]);
+	}
+}
+
+BENCH_STREAM_CALL(mat4_rotation_axis_loop, mat4_rotation_axis_loop())
+
+/* As many packed mat4 as rotations, read from stream_a and stream_b */
+BENCH_STREAM_CALL(mat4_multiply_n, mat4_multiply_n(stream_r[0], 0, stream_a[0], 0, stream_b[0], 0,
+												   BENCH_ROTATIONS))
+BENCH_STREAM_CALL(mat4_multiply_broadcast_left_n,
+				  mat4_multiply_broadcast_left_n(stream_r[0], 0, in_a[i & BENCH_MASK], stream_a[0],
+												 0, BENCH_ROTATIONS))
+BENCH_STREAM_CALL(mat4_multiply_broadcast_right_n,
+				  mat4_multiply_broadcast_right_n(stream_r[0], 0, stream_a[0], 0,
+												  in_a[i & BENCH_MASK], BENCH_ROTATIONS))
+
+/* What mat4_multiply_broadcast_left_n replaces: one call per matrix */
+static void mat4_multiply_loop(mfloat_t* m0)
+{
+	for (size_t j = 0; j < BENCH_ROTATIONS; j++) {
+		mat4_multiply(stream_r[0] + j * MAT4_SIZE, m0, stream_a[0] + j * MAT4_SIZE);
+	}
+}
+
+BENCH_STREAM_CALL(mat4_multiply_loop, mat4_multiply_loop(in_a[i & BENCH_MASK]))
+/* Centers from stream_a, radii and half extents from stream_b */
+BENCH_STREAM_CALL(frustum_cull_spheres_n,
+				  frustum_cull_spheres_n(stream_mask, stream_frustum, BENCH_STREAM_A, stream_b[0],
+										 BENCH_STREAM))
+BENCH_STREAM_CALL(frustum_cull_aabbs_n,
+				  frustum_cull_aabbs_n(stream_mask, stream_frustum, BENCH_STREAM_A, BENCH_STREAM_B,
+									   BENCH_STREAM))
+/* Rays from the pools, and triangles with vertices from stream_a, stream_b and stream_r */
+BENCH_STREAM_CALL(ray_intersect_aabbs_n,
+				  ray_intersect_aabbs_n(&out_s[0], &stream_hit, in_a[i & BENCH_MASK],
+										in_b[i & BENCH_MASK], INFINITY, BENCH_STREAM_A,
+										BENCH_STREAM_B, BENCH_STREAM))
+BENCH_STREAM_CALL(ray_intersect_triangles_n,
+				  ray_intersect_triangles_n(&out_s[0], &stream_hit, in_a[i & BENCH_MASK],
+											in_b[i & BENCH_MASK], INFINITY, BENCH_STREAM_A,
+											BENCH_STREAM_B, BENCH_STREAM_R, BENCH_STREAM))
+/* Positions from stream_a and normals from stream_b, skinned with the bones of in_a */
+#define BENCH_STREAM_RN stream_rn[0], stream_rn[1], stream_rn[2]
+
+BENCH_STREAM_CALL(skin_affine_n,
+				  skin_affine_n(BENCH_STREAM_R, BENCH_STREAM_RN, BENCH_STREAM_A, BENCH_STREAM_B,
+								stream_bones, stream_weights, stream_palette[0], BENCH_STREAM))
+BENCH_STREAM_CALL(skin_mat4_n,
+				  skin_mat4_n(BENCH_STREAM_R, BENCH_STREAM_RN, BENCH_STREAM_A, BENCH_STREAM_B,
+							  stream_bones, stream_weights, in_a[0], BENCH_STREAM))
+BENCH_STREAM_CALL(skin_mat4_n_positions,
+				  skin_mat4_n(BENCH_STREAM_R, NULL, NULL, NULL, BENCH_STREAM_A, NULL, NULL, NULL,
+							  stream_bones, stream_weights, in_a[0], BENCH_STREAM))
+BENCH_STREAM_CALL(skin_dualquat_n,
+				  skin_dualquat_n(BENCH_STREAM_R, BENCH_STREAM_RN, BENCH_STREAM_A, BENCH_STREAM_B,
+								  stream_bones, stream_weights, in_dq[0], BENCH_STREAM))
+
+/* What skin_mat4_n replaces: blending the bones and transforming each padded position */
+static void skin_mat4_loop(void)
+{
+	for (size_t j = 0; j < BENCH_STREAM; j++) {
+		mfloat_t blended[MAT4_SIZE];
+		mfloat_t weighted[MAT4_SIZE];
+		mat4_multiply_f(blended, in_a[stream_bones[j * SKIN_BONES]],
+						stream_weights[j * SKIN_BONES]);
+		for (size_t k = 1; k < SKIN_BONES; k++) {
+			mat4_multiply_f(weighted, in_a[stream_bones[j * SKIN_BONES + k]],
+							stream_weights[j * SKIN_BONES + k]);
+			for (size_t c = 0; c < MAT4_SIZE; c++) {
+				blended[c] += weighted[c];
+			}
+		}
+		vec4_multiply_mat4(out_f[j & BENCH_MASK], stream_v4[j], blended);
+	}
+}
+
+BENCH_STREAM_CALL(skin_mat4_loop, skin_mat4_loop())
+BENCH_STREAM_CALL(transform_hierarchy_n,
+				  transform_hierarchy_n(stream_world_tr[0], stream_nodes[0], stream_parents,
+										BENCH_STREAM))
+BENCH_STREAM_CALL(mat4_from_transform_hierarchy_n,
+				  mat4_from_transform_hierarchy_n(stream_world[0], stream_nodes[0], stream_parents,
+												  BENCH_STREAM))
+
+/* What mat4_from_transform_hierarchy_n replaces: a TRS product and a mat4_multiply per node */
+static void mat4_hierarchy_loop(void)
+{
+	for (size_t j = 0; j < BENCH_STREAM; j++) {
+		mat4_trs_product(stream_world[j], stream_nodes[j]);
+		if (stream_parents[j] >= 0) {
+			mat4_multiply(stream_world[j], stream_world[stream_parents[j]], stream_world[j]);
+		}
+	}
+}
+
+BENCH_STREAM_CALL(mat4_hierarchy_loop, mat4_hierarchy_loop())
+#define BENCH_STREAM_RQ stream_rq[0], stream_rq[1], stream_rq[2], stream_rq[3]
+#define BENCH_STREAM_Q0 stream_q0[0], stream_q0[1], stream_q0[2], stream_q0[3]
+#define BENCH_STREAM_Q1 stream_q1[0], stream_q1[1], stream_q1[2], stream_q1[3]
+
+BENCH_STREAM_CALL(quat_slerp_n, quat_slerp_n(BENCH_STREAM_RQ, BENCH_STREAM_Q0, BENCH_STREAM_Q1,
+											 in_t[i & BENCH_MASK], BENCH_STREAM))
+BENCH_STREAM_CALL(quat_nlerp_n, quat_nlerp_n(BENCH_STREAM_RQ, BENCH_STREAM_Q0, BENCH_STREAM_Q1,
+											 in_t[i & BENCH_MASK], BENCH_STREAM))
+BENCH_STREAM_CALL(quat_slerp_fast_n,
+				  quat_slerp_fast_n(BENCH_STREAM_RQ, BENCH_STREAM_Q0, BENCH_STREAM_Q1,
+									in_t[i & BENCH_MASK], BENCH_STREAM))
+
+typedef void (*bench_blend)(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw, mfloat_t* x0,
+							mfloat_t* y0, mfloat_t* z0, mfloat_t* w0, mfloat_t* x1, mfloat_t* y1,
+							mfloat_t* z1, mfloat_t* w1, mfloat_t f, size_t n);
+
+/*
+Largest angle in radians between the blends of the stream and the exact slerp
+in double precision, for every factor of the pool, so the accuracy of the three
+blends can be weighed against their time.
+*/
+static double bench_blend_error(bench_blend blend)
+{
+	double worst = 0.0;
+	for (int k = 0; k < BENCH_POOL; k++) {
+		double t = (double)in_t[k];
+		blend(BENCH_STREAM_RQ, BENCH_STREAM_Q0, BENCH_STREAM_Q1, in_t[k], BENCH_STREAM);
+		for (int i = 0; i < BENCH_STREAM; i++) {
+			double d = 0.0;
+			double dot = 0.0;
+			double r = 0.0;
+			double e = 0.0;
+			for (int j = 0; j < QUAT_SIZE; j++) {
+				d += (double)stream_q0[j][i] * (double)stream_q1[j][i];
+			}
+			double sign = d < 0.0 ? -1.0 : 1.0;
+			double theta = acos(fmin(fabs(d), 1.0));
+			double a = 1.0 - t;
+			double b = t;
+			if (theta > 1e-9) {
+				a = sin((1.0 - t) * theta) / sin(theta);
+				b = sin(t * theta) / sin(theta);
+			}
+			for (int j = 0; j < QUAT_SIZE; j++) {
+				double exact = a * (double)stream_q0[j][i] + sign * b * (double)stream_q1[j][i];
+				dot += (double)stream_rq[j][i] * exact;
+				r += (double)stream_rq[j][i] * (double)stream_rq[j][i];
+				e += exact * exact;
+			}
+			/* Like the blend error table of the quaternion tests */
+			double c = fabs(dot) / sqrt(r * e);
+			double angle = 2.0 * atan2(sqrt(fmax(1.0 - c * c, 0.0)), c);
+			worst = angle > worst ? angle : worst;
+		}
+	}
+	return worst;
+}
+
+static double bench_error_quat_slerp_n(void)
+{
+	return bench_blend_error(quat_slerp_n);
+}
+
+static double bench_error_quat_nlerp_n(void)
+{
+	return bench_blend_error(quat_nlerp_n);
+}
+
+static double bench_error_quat_slerp_fast_n(void)
+{
+	return bench_blend_error(quat_slerp_fast_n);
+}
+BENCH_STREAM_CALL(quat_rotate_vec3_n,
+				  quat_rotate_vec3_n(BENCH_STREAM_R, in_q0[i & BENCH_MASK], BENCH_STREAM_A,
+									 BENCH_STREAM))
+BENCH_STREAM_CALL(vec2_angle_n, vec2_angle_n(stream_r[0], stream_a[0], stream_a[1], BENCH_STREAM))
+#endif
+
+#if defined(MATHC_USE_STRUCT_FUNCTIONS)
+/* Hand-written equivalents of struct functions, to check the struct API costs nothing more */
+static struct vec3 hand_vec3_add(struct vec3 v0, struct vec3 v1)
+{
+	struct vec3 result;
+	result.x = v0.x + v1.x;
+	result.y = v0.y + v1.y;
+	result.z = v0.z + v1.z;
+	return result;
+}
+
+static mfloat_t hand_vec3_dot(struct vec3 v0, struct vec3 v1)
+{
+	return v0.x * v1.x + v0.y * v1.y + v0.z * v1.z;
+}
+
+static struct vec3 hand_vec3_cross(struct vec3 v0, struct vec3 v1)
+{
+	struct vec3 result;
+	result.x = v0.y * v1.z - v0.z * v1.y;
+	result.y = v0.z * v1.x - v0.x * v1.z;
+	result.z = v0.x * v1.y - v0.y * v1.x;
+	return result;
+}
+
+static struct vec3 hand_vec3_normalize(struct vec3 v0)
+{
+	struct vec3 result;
+	mfloat_t l = MSQRT(v0.x * v0.x + v0.y * v0.y + v0.z * v0.z);
+	result.x = v0.x / l;
+	result.y = v0.y / l;
+	result.z = v0.z / l;
+	return result;
+}
+
+static struct vec4 hand_vec4_lerp(struct vec4 v0, struct vec4 v1, mfloat_t f)
+{
+	struct vec4 result;
+	result.x = v0.x + (v1.x - v0.x) * f;
+	result.y = v0.y + (v1.y - v0.y) * f;
+	result.z = v0.z + (v1.z - v0.z) * f;
+	result.w = v0.w + (v1.w - v0.w) * f;
+	return result;
+}
+
+static struct quat hand_quat_multiply(struct quat q0, struct quat q1)
+{
+	struct quat result;
+	result.x = q0.w * q1.x + q0.x * q1.w + q0.y * q1.z - q0.z * q1.y;
+	result.y = q0.w * q1.y + q0.y * q1.w + q0.z * q1.x - q0.x * q1.z;
+	result.z = q0.w * q1.z + q0.z * q1.w + q0.x * q1.y - q0.y * q1.x;
+	result.w = q0.w * q1.w - q0.x * q1.x - q0.y * q1.y - q0.z * q1.z;
+	return result;
+}
+
+BENCH_CALL(svec3_add, out_sv3[k] = svec3_add(in_sv3a[k], in_sv3b[k]))
+BENCH_CALL(hand_vec3_add, out_sv3[k] = hand_vec3_add(in_sv3a[k], in_sv3b[k]))
+BENCH_CALL(svec3_dot, out_s[k] = svec3_dot(in_sv3a[k], in_sv3b[k]))
+BENCH_CALL(hand_vec3_dot, out_s[k] = hand_vec3_dot(in_sv3a[k], in_sv3b[k]))
+BENCH_CALL(svec3_cross, out_sv3[k] = svec3_cross(in_sv3a[k], in_sv3b[k]))
+BENCH_CALL(hand_vec3_cross, out_sv3[k] = hand_vec3_cross(in_sv3a[k], in_sv3b[k]))
+BENCH_CALL(svec3_normalize, out_sv3[k] = svec3_normalize(in_sv3a[k]))
+BENCH_CALL(hand_vec3_normalize, out_sv3[k] = hand_vec3_normalize(in_sv3a[k]))
+BENCH_CALL(svec4_lerp, out_sv4[k] = svec4_lerp(in_sv4a[k], in_sv4b[k], in_t[k]))
+BENCH_CALL(hand_vec4_lerp, out_sv4[k] = hand_vec4_lerp(in_sv4a[k], in_sv4b[k], in_t[k]))
+BENCH_CALL(squat_multiply, out_sq[k] = squat_multiply(in_sq0[k], in_sq1[k]))
+BENCH_CALL(hand_quat_multiply, out_sq[k] = hand_quat_multiply(in_sq0[k], in_sq1[k]))
+#endif
+
+#if defined(MATHC_USE_EASING_FUNCTIONS)
+BENCH_CALL(quadratic_ease_in_out, out_s[k] = quadratic_ease_in_out(in_t[k]))
+BENCH_CALL(cubic_ease_in_out, out_s[k] = cubic_ease_in_out(in_t[k]))
+BENCH_CALL(quartic_ease_in_out, out_s[k] = quartic_ease_in_out(in_t[k]))
+BENCH_CALL(quintic_ease_in_out, out_s[k] = quintic_ease_in_out(in_t[k]))
+BENCH_CALL(sine_ease_in_out, out_s[k] = sine_ease_in_out(in_t[k]))
+BENCH_CALL(circular_ease_in_out, out_s[k] = circular_ease_in_out(in_t[k]))
+BENCH_CALL(exponential_ease_in_out, out_s[k] = exponential_ease_in_out(in_t[k]))
+BENCH_CALL(elastic_ease_in_out, out_s[k] = elastic_ease_in_out(in_t[k]))
+BENCH_CALL(back_ease_in_out, out_s[k] = back_ease_in_out(in_t[k]))
+BENCH_CALL(bounce_ease_out, out_s[k] = bounce_ease_out(in_t[k]))
+BENCH_CALL(bounce_ease_in_out, out_s[k] = bounce_ease_in_out(in_t[k]))
+BENCH_CALL(easing_table_linear,
+		   out_s[k] = mathc_easing_table_linear(easing_table, BENCH_EASING_TABLE, in_t[k]))
+BENCH_CALL(easing_table_cubic,
+		   out_s[k] = mathc_easing_table_cubic(easing_table, BENCH_EASING_TABLE, in_t[k]))
+BENCH_CALL(cubic_bezier_ease, out_s[k] = mathc_cubic_bezier_ease(&easing_bezier, in_t[k]))
+
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+BENCH_STREAM_CALL(mathc_ease_n_cubic_in_out,
+				  mathc_ease_n(stream_r[0], stream_t, MATHC_EASING_CUBIC_IN_OUT, BENCH_STREAM))
+BENCH_STREAM_CALL(mathc_ease_n_elastic_in_out,
+				  mathc_ease_n(stream_r[0], stream_t, MATHC_EASING_ELASTIC_IN_OUT, BENCH_STREAM))
+BENCH_STREAM_CALL(mathc_ease_n_bounce_in_out,
+				  mathc_ease_n(stream_r[0], stream_t, MATHC_EASING_BOUNCE_IN_OUT, BENCH_STREAM))
+
+/* What mathc_ease_n replaces: one call per value */
+static void elastic_ease_in_out_loop(void)
+{
+	for (size_t j = 0; j < BENCH_STREAM; j++) {
+		stream_r[0][j] = elastic_ease_in_out(stream_t[j]);
+	}
+}
+
+BENCH_STREAM_CALL(elastic_ease_in_out_loop, elastic_ease_in_out_loop())
+BENCH_STREAM_CALL(easing_table_linear_n,
+				  mathc_easing_table_linear_n(stream_r[0], stream_t, easing_table,
+											  BENCH_EASING_TABLE, BENCH_STREAM))
+BENCH_STREAM_CALL(easing_table_cubic_n,
+				  mathc_easing_table_cubic_n(stream_r[0], stream_t, easing_table,
+											 BENCH_EASING_TABLE, BENCH_STREAM))
+BENCH_STREAM_CALL(cubic_bezier_ease_n,
+				  mathc_cubic_bezier_ease_n(stream_r[0], stream_t, &easing_bezier, BENCH_STREAM))
+#endif
+#endif
+#endif
+
+static const struct bench benches[] = {
+#if defined(MATHC_USE_INT)
+	BENCH(utils, clampi),
+	BENCH(vec2i, vec2i_is_equal),
+	BENCH(vec2i, vec2i_add),
+	BENCH(vec2i, vec2i_add_i),
+	BENCH(vec2i, vec2i_subtract),
+	BENCH(vec2i, vec2i_multiply),
+	BENCH(vec2i, vec2i_multiply_i),
+	BENCH(vec2i, vec2i_divide),
+	BENCH(vec2i, vec2i_divide_i),
+	BENCH(vec2i, vec2i_snap),
+	BENCH(vec2i, vec2i_negative),
+	BENCH(vec2i, vec2i_abs),
+	BENCH(vec2i, vec2i_max),
+	BENCH(vec2i, vec2i_min),
+	BENCH(vec2i, vec2i_clamp),
+	BENCH(vec2i, vec2i_tangent),
+	BENCH(vec3i, vec3i_is_equal),
+	BENCH(vec3i, vec3i_add),
+	BENCH(vec3i, vec3i_add_i),
+	BENCH(vec3i, vec3i_subtract),
+	BENCH(vec3i, vec3i_multiply),
+	BENCH(vec3i, vec3i_multiply_i),
+	BENCH(vec3i, vec3i_divide),
+	BENCH(vec3i, vec3i_divide_i),
+	BENCH(vec3i, vec3i_snap),
+	BENCH(vec3i, vec3i_cross),
+	BENCH(vec3i, vec3i_negative),
+	BENCH(vec3i, vec3i_abs),
+	BENCH(vec3i, vec3i_max),
+	BENCH(vec3i, vec3i_min),
+	BENCH(vec3i, vec3i_clamp),
+	BENCH(vec4i, vec4i_is_equal),
+	BENCH(vec4i, vec4i_add),
+	BENCH(vec4i, vec4i_add_i),
+	BENCH(vec4i, vec4i_subtract),
+	BENCH(vec4i, vec4i_multiply),
+	BENCH(vec4i, vec4i_multiply_i),
+	BENCH(vec4i, vec4i_divide),
+	BENCH(vec4i, vec4i_divide_i),
+	BENCH(vec4i, vec4i_snap),
+	BENCH(vec4i, vec4i_negative),
+	BENCH(vec4i, vec4i_abs),
+	BENCH(vec4i, vec4i_max),
+	BENCH(vec4i, vec4i_min),
+	BENCH(vec4i, vec4i_clamp),
+#endif
+#if defined(MATHC_USE_FLOATING_POINT)
+	BENCH(utils, clampf),
+	BENCH(utils, lerp),
+	BENCH(utils, remap),
+	BENCH(transcendental, mathc_sin_fast),
+	BENCH(transcendental, c_sin),
+	BENCH(transcendental, mathc_acos_fast),
+	BENCH(transcendental, c_acos),
+	BENCH(transcendental, mathc_atan2_fast),
+	BENCH(transcendental, c_atan2),
+	BENCH(transcendental, mathc_exp2_fast),
+	BENCH(transcendental, c_exp2),
+	BENCH(vec2, vec2_is_equal),
+	BENCH(vec2, vec2_add),
+	BENCH(vec2, vec2_add_f),
+	BENCH(vec2, vec2_subtract),
+	BENCH(vec2, vec2_multiply),
+	BENCH(vec2, vec2_multiply_f),
+	BENCH(vec2, vec2_multiply_mat2),
+	BENCH(vec2, vec2_divide),
+	BENCH(vec2, vec2_snap),
+	BENCH(vec2, vec2_negative),
+	BENCH(vec2, vec2_abs),
+	BENCH(vec2, vec2_floor),
+	BENCH(vec2, vec2_round),
+	BENCH(vec2, vec2_max),
+	BENCH(vec2, vec2_min),
+	BENCH(vec2, vec2_clamp),
+	BENCH(vec2, vec2_normalize),
+	BENCH(vec2, vec2_normalize_fast),
+	BENCH(vec2, vec2_dot),
+	BENCH(vec2, vec2_project),
+	BENCH(vec2, vec2_slide),
+	BENCH(vec2, vec2_reflect),
+	BENCH(vec2, vec2_tangent),
+	BENCH(vec2, vec2_rotate),
+	BENCH(vec2, vec2_lerp),
+	BENCH(vec2, vec2_bezier3),
+	BENCH(vec2, vec2_bezier4),
+	BENCH(vec2, vec2_angle),
+	BENCH(vec2, vec2_length),
+	BENCH(vec2, vec2_length_squared),
+	BENCH(vec2, vec2_distance),
+	BENCH(vec2, vec2_linear_independent),
+	BENCH(vec3, vec3_is_equal),
+	BENCH(vec3, vec3_add),
+	BENCH(vec3, vec3_add_f),
+	BENCH(vec3, vec3_subtract),
+	BENCH(vec3, vec3_multiply),
+	BENCH(vec3, vec3_multiply_f),
+	BENCH(vec3, vec3_multiply_mat3),
+	BENCH(vec3, vec3_divide),
+	BENCH(vec3, vec3_snap),
+	BENCH(vec3, vec3_negative),
+	BENCH(vec3, vec3_abs),
+	BENCH(vec3, vec3_floor),
+	BENCH(vec3, vec3_round),
+	BENCH(vec3, vec3_max),
+	BENCH(vec3, vec3_min),
+	BENCH(vec3, vec3_clamp),
+	BENCH(vec3, vec3_cross),
+	BENCH(vec3, vec3_normalize),
+	BENCH(vec3, vec3_normalize_fast),
+	BENCH(vec3, vec3_dot),
+	BENCH(vec3, vec3_project),
+	BENCH(vec3, vec3_slide),
+	BENCH(vec3, vec3_reflect),
+	BENCH(vec3, vec3_rotate),
+	BENCH(vec3, vec3_lerp),
+	BENCH(vec3, vec3_bezier3),
+	BENCH(vec3, vec3_bezier4),
+	BENCH(vec3, vec3_length),
+	BENCH(vec3, vec3_length_squared),
+	BENCH(vec3, vec3_distance),
+	BENCH(vec3, vec3_linear_independent),
+	BENCH(vec4, vec4_is_equal),
+	BENCH(vec4, vec4_add),
+	BENCH(vec4, vec4_add_f),
+	BENCH(vec4, vec4_subtract),
+	BENCH(vec4, vec4_multiply),
+	BENCH(vec4, vec4_multiply_f),
+	BENCH(vec4, vec4_multiply_mat4),
+	BENCH(vec4, vec4_divide),
+	BENCH(vec4, vec4_snap),
+	BENCH(vec4, vec4_negative),
+	BENCH(vec4, vec4_abs),
+	BENCH(vec4, vec4_floor),
+	BENCH(vec4, vec4_round),
+	BENCH(vec4, vec4_max),
+	BENCH(vec4, vec4_min),
+	BENCH(vec4, vec4_clamp),
+	BENCH(vec4, vec4_normalize),
+	BENCH(vec4, vec4_normalize_fast),
+	BENCH(vec4, vec4_lerp),
+	BENCH(quat, quat_multiply),
+	BENCH(quat, quat_divide),
+	BENCH(quat, quat_conjugate),
+	BENCH(quat, quat_inverse),
+	BENCH(quat, quat_normalize),
+	BENCH(quat, quat_normalize_fast),
+	BENCH(quat, quat_dot),
+	BENCH(quat, quat_power),
+	BENCH(quat, quat_from_axis_angle),
+	BENCH(quat, quat_from_vec3),
+	BENCH(quat, quat_from_mat4),
+	BENCH(quat, quat_lerp),
+	BENCH(quat, quat_slerp),
+	BENCH(quat, quat_length),
+	BENCH(quat, quat_angle),
+	BENCH(quat, quat_rotate_vec3),
+	BENCH(quat, quat_rotate_vec3_mat3),
+	BENCH(mat2, mat2_determinant),
+	BENCH(mat2, mat2_transpose),
+	BENCH(mat2, mat2_cofactor),
+	BENCH(mat2, mat2_adjugate),
+	BENCH(mat2, mat2_multiply),
+	BENCH(mat2, mat2_multiply_f),
+	BENCH(mat2, mat2_inverse),
+	BENCH(mat2, mat2_scale),
+	BENCH(mat2, mat2_rotation_z),
+	BENCH(mat2, mat2_lerp),
+	BENCH(mat3, mat3_determinant),
+	BENCH(mat3, mat3_transpose),
+	BENCH(mat3, mat3_cofactor),
+	BENCH(mat3, mat3_multiply),
+	BENCH(mat3, mat3_multiply_f),
+	BENCH(mat3, mat3_inverse),
+	BENCH(mat3, mat3_scale),
+	BENCH(mat3, mat3_rotation_x),
+	BENCH(mat3, mat3_rotation_axis),
+	BENCH(mat3, mat3_rotation_quat),
+	BENCH(mat3, mat3_lerp),
+	BENCH(mat4, mat4_determinant),
+	BENCH(mat4, mat4_transpose),
+	BENCH(mat4, mat4_cofactor),
+	BENCH(mat4, mat4_rotation_x),
+	BENCH(mat4, mat4_rotation_axis),
+	BENCH(mat4, mat4_rotation_quat),
+	BENCH(mat4, mat4_translation),
+	BENCH(mat4, mat4_translate),
+	BENCH(mat4, mat4_scale),
+	BENCH(mat4, mat4_multiply),
+	BENCH(mat4, mat4_multiply_f),
+	BENCH(mat4, mat4_inverse),
+	BENCH(mat4, mat4_inverse_affine),
+	BENCH(mat4, mat4_inverse_rigid),
+	BENCH(mat4, mat4_lerp),
+	BENCH(mat4, mat4_look_at),
+	BENCH(mat4, mat4_ortho),
+	BENCH(mat4, mat4_perspective),
+	BENCH(mat4, mat4_perspective_infinite),
+	BENCH(affine, affine_multiply),
+	BENCH(affine, affine_inverse),
+	BENCH(affine, affine_inverse_rigid),
+	BENCH(affine, affine_transform_point),
+	BENCH(dualquat, dualquat_multiply),
+	BENCH(dualquat, dualquat_normalize),
+	BENCH(dualquat, dualquat_transform_point),
+	BENCH(dualquat, mat4_from_dualquat),
+	BENCH(transform, transform_multiply),
+	BENCH(transform, transform_inverse),
+	BENCH(transform, mat4_from_transform),
+	BENCH(transform, mat4_trs_product),
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+	BENCH_ITEMS(stream, vec3_add_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, vec3_multiply_f_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, vec3_multiply_mat3_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, vec3_cross_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, vec3_normalize_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, vec3_lerp_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, vec3_dot_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, vec3_length_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, vec3_distance_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, mat4_transform_points_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, mat4_transform_points_n_projective, BENCH_STREAM),
+	BENCH_ITEMS(stream, mat4_transform_directions_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, vec4_multiply_mat4_loop, BENCH_STREAM),
+	BENCH_ITEMS(stream, mat4_rotation_axis_n, BENCH_ROTATIONS),
+	BENCH_ITEMS(stream, quat_from_axis_angle_n, BENCH_ROTATIONS),
+	BENCH_ITEMS(stream, mat4_rotation_axis_loop, BENCH_ROTATIONS),
+	BENCH_ITEMS(stream, mat4_multiply_n, BENCH_ROTATIONS),
+	BENCH_ITEMS(stream, mat4_multiply_broadcast_left_n, BENCH_ROTATIONS),
+	BENCH_ITEMS(stream, mat4_multiply_broadcast_right_n, BENCH_ROTATIONS),
+	BENCH_ITEMS(stream, mat4_multiply_loop, BENCH_ROTATIONS),
+	BENCH_ITEMS(stream, frustum_cull_spheres_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, frustum_cull_aabbs_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, ray_intersect_aabbs_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, ray_intersect_triangles_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, skin_affine_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, skin_mat4_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, skin_mat4_n_positions, BENCH_STREAM),
+	BENCH_ITEMS(stream, skin_dualquat_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, skin_mat4_loop, BENCH_STREAM),
+	BENCH_ITEMS(stream, transform_hierarchy_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, mat4_from_transform_hierarchy_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, mat4_hierarchy_loop, BENCH_STREAM),
+	BENCH_ITEMS_ERROR(stream, quat_slerp_n, BENCH_STREAM),
+	BENCH_ITEMS_ERROR(stream, quat_nlerp_n, BENCH_STREAM),
+	BENCH_ITEMS_ERROR(stream, quat_slerp_fast_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, quat_rotate_vec3_n, BENCH_STREAM),
+	BENCH_ITEMS(stream, vec2_angle_n, BENCH_STREAM),
+#endif
+#if defined(MATHC_USE_STRUCT_FUNCTIONS)
+	BENCH(struct, svec3_add),
+	BENCH(struct, hand_vec3_add),
+	BENCH(struct, svec3_dot),
+	BENCH(struct, hand_vec3_dot),
+	BENCH(struct, svec3_cross),
+	BENCH(struct, hand_vec3_cross),
+	BENCH(struct, svec3_normalize),
+	BENCH(struct, hand_vec3_normalize),
+	BENCH(struct, svec4_lerp),
+	BENCH(struct, hand_vec4_lerp),
+	BENCH(struct, squat_multiply),
+	BENCH(struct, hand_quat_multiply),
+#endif
+#if defined(MATHC_USE_EASING_FUNCTIONS)
+	BENCH(easing, quadratic_ease_in_out),
+	BENCH(easing, cubic_ease_in_out),
+	BENCH(easing, quartic_ease_in_out),
+	BENCH(easing, quintic_ease_in_out),
+	BENCH(easing, sine_ease_in_out),
+	BENCH(easing, circular_ease_in_out),
+	BENCH(easing, exponential_ease_in_out),
+	BENCH(easing, elastic_ease_in_out),
+	BENCH(easing, back_ease_in_out),
+	BENCH(easing, bounce_ease_out),
+	BENCH(easing, bounce_ease_in_out),
+	BENCH(easing, easing_table_linear),
+	BENCH(easing, easing_table_cubic),
+	BENCH(easing, cubic_bezier_ease),
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+	BENCH_ITEMS(easing, mathc_ease_n_cubic_in_out, BENCH_STREAM),
+	BENCH_ITEMS(easing, mathc_ease_n_elastic_in_out, BENCH_STREAM),
+	BENCH_ITEMS(easing, mathc_ease_n_bounce_in_out, BENCH_STREAM),
+	BENCH_ITEMS(easing, elastic_ease_in_out_loop, BENCH_STREAM),
+	BENCH_ITEMS(easing, easing_table_linear_n, BENCH_STREAM),
+	BENCH_ITEMS(easing, easing_table_cubic_n, BENCH_STREAM),
+	BENCH_ITEMS(easing, cubic_bezier_ease_n, BENCH_STREAM),
+#endif
+#endif
+#endif
+};
+
+#define BENCH_COUNT (sizeof(benches) / sizeof(benches[0]))
+
+struct bench_options {
+	const char* filter;
+	const char* output;
+	int samples;
+	int warmup;
+	double sample_ms;
+	bool list;
+#if defined(MATHC_USE_FLOATING_POINT)
+	const char* simd;
+#endif
+};
+
+struct bench_result {
+	size_t iterations;
+	double median;
+	double mean;
+	double stddev;
+	double min;
+	double max;
+};
+
+/* Monotonic time in nanoseconds */
+static double bench_now(void)
+{
+#if defined(_WIN32)
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart * 1e9 / (double)frequency.QuadPart;
+#else
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+#endif
+}
+
+/* Time of one sample in nanoseconds */
+static double bench_sample(const struct bench* b, size_t iterations)
+{
+	double start = bench_now();
+	b->run(iterations);
+	double elapsed = bench_now() - start;
+	bench_consume();
+	return elapsed;
+}
+
+static int bench_compare(const void* a, const void* b)
+{
+	double x = *(const double*)a;
+	double y = *(const double*)b;
+	return (x > y) - (x < y);
+}
+
+static void bench_run(const struct bench* b, const struct bench_options* options,
+					  struct bench_result* result)
+{
+	double target = options->sample_ms * 1e6;
+	double samples[BENCH_MAX_SAMPLES];
+	size_t iterations = 1;
+	/* Grow the iteration count until a sample takes the target time */
+	for (;;) {
+		double elapsed = bench_sample(b, iterations);
+		if (elapsed >= target || iterations >= ((size_t)1 << 40)) {
+			break;
+		}
+		if (elapsed < target / 16.0) {
+			iterations *= 8;
+		} else {
+			iterations = (size_t)((double)iterations * target / elapsed * 1.05) + 1;
+		}
+	}
+	for (int i = 0; i < options->warmup; i++) {
+		bench_sample(b, iterations);
+	}
+	double sum = 0.0;
+	for (int i = 0; i < options->samples; i++) {
+		samples[i] = bench_sample(b, iterations) / (double)iterations;
+		sum += samples[i];
+	}
+	double mean = sum / options->samples;
+	double variance = 0.0;
+	for (int i = 0; i < options->samples; i++) {
+		variance += (samples[i] - mean) * (samples[i] - mean);
+	}
+	if (options->samples > 1) {
+		variance /= options->samples - 1;
+	}
+	qsort(samples, (size_t)options->samples, sizeof(double), bench_compare);
+	int middle = options->samples / 2;
+	result->iterations = iterations;
+	result->median = options->samples % 2 ? samples[middle]
+										  : (samples[middle - 1] + samples[middle]) * 0.5;
+	result->mean = mean;
+	result->stddev = sqrt(variance);
+	result->min = samples[0];
+	result->max = samples[options->samples - 1];
+}
+
+static bool bench_selected(const struct bench* b, const struct bench_options* options)
+{
+	if (options->filter == NULL) {
+		return true;
+	}
+	return strstr(b->name, options->filter) != NULL || strcmp(b->family, options->filter) == 0;
+}
+
+#if defined(MATHC_USE_FLOATING_POINT)
+static const char* bench_simd_names[] = {"scalar", "sse", "avx2", "avx512"};
+#endif
+
+static void bench_usage(const char* program)
+{
+	fprintf(stderr,
+			"Usage: %s [options]\n"
+			"  --filter <text>   run the benchmarks of a family or with <text> in the name\n"
+			"  --samples <n>     samples for each benchmark (default 10)\n"
+			"  --warmup <n>      samples discarded before measuring (default 1)\n"
+			"  --sample-ms <ms>  target duration of a sample (default 5)\n"
+			"  --output <file>   write the JSON to <file> instead of the standard output\n"
+#if defined(MATHC_USE_FLOATING_POINT)
+			"  --simd <tier>     force scalar, sse, avx2 or avx512 before running\n"
+#endif
+			"  --list            list the benchmarks and exit\n",
+			program);
+}
+
+static bool bench_parse(int argc, char** argv, struct bench_options* options)
+{
+	for (int i = 1; i < argc; i++) {
+		const char* arg = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+		if (strcmp(arg, "--list") == 0) {
+			options->list = true;
+			continue;
+		}
+		if (value == NULL) {
+			return false;
+		}
+		if (strcmp(arg, "--filter") == 0) {
+			options->filter = value;
+		} else if (strcmp(arg, "--samples") == 0) {
+			options->samples = atoi(value);
+		} else if (strcmp(arg, "--warmup") == 0) {
+			options->warmup = atoi(value);
+		} else if (strcmp(arg, "--sample-ms") == 0) {
+			options->sample_ms = atof(value);
+		} else if (strcmp(arg, "--output") == 0) {
+			options->output = value;
+#if defined(MATHC_USE_FLOATING_POINT)
+		} else if (strcmp(arg, "--simd") == 0) {
+			options->simd = value;
+#endif
+		} else {
+			return false;
+		}
+		i++;
+	}
+	return options->samples > 0 && options->samples <= BENCH_MAX_SAMPLES && options->warmup >= 0
+		   && options->sample_ms > 0.0;
+}
+
+int main(int argc, char** argv)
+{
+	struct bench_options options = {0};
+	options.samples = 10;
+	options.warmup = 1;
+	options.sample_ms = 5.0;
+	if (!bench_parse(argc, argv, &options)) {
+		bench_usage(argv[0]);
+		return 2;
+	}
+	if (options.list) {
+		for (size_t i = 0; i < BENCH_COUNT; i++) {
+			if (bench_selected(&benches[i], &options)) {
+				printf("%s %s\n", benches[i].family, benches[i].name);
+			}
+		}
+		return 0;
+	}
+#if defined(MATHC_USE_FLOATING_POINT)
+	if (options.simd != NULL) {
+		int tier = -1;
+		for (int i = 0; i <= MATHC_SIMD_AVX512; i++) {
+			if (strcmp(options.simd, bench_simd_names[i]) == 0) {
+				tier = i;
+			}
+		}
+		if (tier < 0 || !mathc_simd_set((enum mathc_simd)tier)) {
+			fprintf(stderr, "SIMD tier '%s' is not available\n", options.simd);
+			return 2;
+		}
+	}
+#endif
+	FILE* out = stdout;
+	if (options.output != NULL) {
+		out = fopen(options.output, "w");
+		if (out == NULL) {
+			fprintf(stderr, "Can't open '%s' for writing\n", options.output);
+			return 1;
+		}
+	}
+	bench_fill();
+	fprintf(out, "{\n");
+	fprintf(out, "  \"config\": {\n");
+#if defined(MATHC_INLINE)
+	fprintf(out, "    \"inline\": true,\n");
+#else
+	fprintf(out, "    \"inline\": false,\n");
+#endif
+#if defined(MATHC_USE_FLOATING_POINT)
+	fprintf(out, "    \"mfloat_t\": %d,\n", (int)(sizeof(mfloat_t) * 8));
+	fprintf(out, "    \"simd\": \"%s\",\n", bench_simd_names[mathc_simd_get()]);
+#endif
+#if defined(MATHC_USE_INT)
+	fprintf(out, "    \"mint_t\": %d,\n", (int)(sizeof(mint_t) * 8));
+#endif
+	fprintf(out, "    \"samples\": %d,\n", options.samples);
+	fprintf(out, "    \"warmup\": %d,\n", options.warmup);
+	fprintf(out, "    \"sample_ms\": %g\n", options.sample_ms);
+	fprintf(out, "  },\n");
+	fprintf(out, "  \"benchmarks\": [");
+	bool first = true;
+	for (size_t i = 0; i < BENCH_COUNT; i++) {
+		const struct bench* b = &benches[i];
+		struct bench_result r;
+		if (!bench_selected(b, &options)) {
+			continue;
+		}
+		bench_run(b, &options, &r);
+		fprintf(out, "%s\n    {\"family\": \"%s\", \"name\": \"%s\", \"items\": %lu, ",
+				first ? "" : ",", b->family, b->name, (unsigned long)b->items);
+		fprintf(out, "\"iterations\": %lu, \"ns_per_op\": %.3f, \"ns_per_item\": %.3f, ",
+				(unsigned long)r.iterations, r.median, r.median / (double)b->items);
+		fprintf(out, "\"ops_per_sec\": %.0f, ", 1e9 / r.median);
+		fprintf(out, "\"mean\": %.3f, \"stddev\": %.3f, \"min\": %.3f, \"max\": %.3f", r.mean,
+				r.stddev, r.min, r.max);
+		if (b->error != NULL) {
+			fprintf(out, ", \"error\": %.3e", b->error());
+		}
+		fprintf(out, "}");
+		fflush(out);
+		first = false;
+	}
+	fprintf(out, "\n  ]\n}\n");
+	if (out != stdout) {
+		fclose(out);
+	}
+	return 0;
+}
@@ -20,6 +20,518 @@ the following restrictions:
 
 #include "mathc.h"
 
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define MATHC_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#if defined(MATHC_USE_DISPATCH)
+#if !defined(MATHC_USE_SINGLE_FLOATING_POINT)
+#error "Runtime dispatch requires MATHC_USE_SINGLE_FLOATING_POINT"
+#endif
+#if !defined(MATHC_X86)
+#error "Runtime dispatch requires an x86 target"
+#endif
+#include <immintrin.h>
+#define MATHC_HAS_SSE
+#define MATHC_HAS_AVX2
+#define MATHC_HAS_AVX512
+#if defined(_WIN32)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#else
+#if defined(MATHC_USE_SSE)
+#if !defined(MATHC_USE_SINGLE_FLOATING_POINT)
+#error "The SSE backend requires MATHC_USE_SINGLE_FLOATING_POINT"
+#endif
+#if !defined(__SSE__) && !defined(_M_X64) && !(defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#error "MATHC_USE_SSE requires a compiler targeting SSE"
+#endif
+#include <xmmintrin.h>
+#define MATHC_HAS_SSE
+#endif
+#if defined(MATHC_USE_AVX2)
+#if !defined(__AVX2__)
+#error "MATHC_USE_AVX2 requires a compiler targeting AVX2 (-mavx2 or /arch:AVX2)"
+#endif
+#include <immintrin.h>
+#define MATHC_HAS_AVX2
+#endif
+#endif
+
+/* The reciprocal square root estimate is part of SSE, which every x86-64 target has */
+#if defined(MATHC_USE_SINGLE_FLOATING_POINT) \
+	&& (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#include <xmmintrin.h>
+#define MATHC_HAS_RSQRT
+#endif
+
+/*
+SIMD kernels are static functions named after the function they implement plus
+the instruction set. With runtime dispatch every kernel is compiled for its own
+target and the public function calls through a table chosen at first use;
+otherwise the public function calls the widest kernel enabled at compile time.
+*/
+#if defined(MATHC_USE_DISPATCH) && (!defined(_MSC_VER) || defined(__clang__))
+#define MATHC_TARGET_SSE __attribute__((target("sse4.1")))
+#define MATHC_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define MATHC_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#else
+#define MATHC_TARGET_SSE
+#define MATHC_TARGET_AVX2
+#define MATHC_TARGET_AVX512
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MATHC_KERNEL static __attribute__((unused))
+#define MATHC_KERNEL_BODY static __attribute__((always_inline, unused)) inline
+#define MATHC_KERNEL_NOINLINE static __attribute__((noinline, unused))
+#elif defined(_MSC_VER)
+#define MATHC_KERNEL static
+#define MATHC_KERNEL_BODY static __forceinline
+#define MATHC_KERNEL_NOINLINE static __declspec(noinline)
+#else
+#define MATHC_KERNEL static
+#define MATHC_KERNEL_BODY static inline
+#define MATHC_KERNEL_NOINLINE static
+#endif
+
+#if defined(MATHC_USE_FLOATING_POINT)
+/*
+Reciprocal square root for the fast normalize functions: the 12-bit hardware
+estimate refined by one Newton-Raphson step, y * (1.5 - 0.5 * x * y * y), for
+about 22 bits of precision. Without the estimate it is an exact 1 / sqrt(x).
+*/
+MATHC_KERNEL_BODY mfloat_t mathc_rsqrt(mfloat_t x)
+{
+#if defined(MATHC_HAS_RSQRT)
+	__m128 v = _mm_set_ss(x);
+	__m128 y = _mm_rsqrt_ss(v);
+	__m128 yy = _mm_mul_ss(_mm_mul_ss(v, y), y);
+	y = _mm_mul_ss(_mm_mul_ss(_mm_set_ss(0.5f), y), _mm_sub_ss(_mm_set_ss(3.0f), yy));
+	return _mm_cvtss_f32(y);
+#else
+	return MFLOAT_C(1.0) / MSQRT(x);
+#endif
+}
+
+#if defined(MATHC_HAS_RSQRT)
+MATHC_KERNEL_BODY __m128 mathc_rsqrt_ps(__m128 x)
+{
+	__m128 y = _mm_rsqrt_ps(x);
+	__m128 yy = _mm_mul_ps(_mm_mul_ps(x, y), y);
+	return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), y), _mm_sub_ps(_mm_set1_ps(3.0f), yy));
+}
+#endif
+
+/*
+Polynomial transcendental functions. They are written without branches, as
+arithmetic and bitwise selects, so loops that call them vectorize. The minimax
+coefficients are the Cephes single precision ones. See the public `_fast`
+functions in mathc.h for their range and error.
+*/
+#if defined(MATHC_USE_SINGLE_FLOATING_POINT)
+union mathc_float_bits {
+	float f;
+	int32_t i;
+};
+
+/* `c ? a : b` as a bitwise select, which compilers don't turn back into a branch */
+MATHC_KERNEL_BODY float mathc_select(int c, float a, float b)
+{
+	union mathc_float_bits x;
+	union mathc_float_bits y;
+	int32_t mask = -(int32_t)(c != 0);
+	x.f = a;
+	y.f = b;
+	x.i = (x.i & mask) | (y.i & ~mask);
+	return x.f;
+}
+
+/*
+The angle is reduced to [-pi/4, pi/4] around the nearest multiple of pi/2 with
+a three-part Cody-Waite constant, and the sine and cosine polynomials of the
+reduced angle are swapped and negated for the quadrant. Adding 1.5 * 2^23
+rounds the quadrant into the low bits of the sum, without a conversion that
+would overflow for infinities and NaN. Those give NaN, like quadrants beyond
+2^22, where the rounding stops being exact.
+*/
+MATHC_KERNEL_BODY void mathc_sincos_poly(float x, float* s, float* c)
+{
+	float q = x * 0.636619772f;
+	union mathc_float_bits b;
+	int32_t j;
+	float fj;
+	float r;
+	float z;
+	float sp;
+	float cp;
+	b.f = q + 12582912.0f;
+	j = b.i;
+	fj = b.f - 12582912.0f;
+	r = ((x - fj * 1.5703125f) - fj * 4.837512969970703125e-4f) - fj * 7.54978995489188216e-8f;
+	r = mathc_select(MFABS(q) < 4194304.0f, r, NAN);
+	z = r * r;
+	sp = r + r * z * (-1.6666654611e-1f + z * (8.3321608736e-3f - z * 1.9515295891e-4f));
+	cp = 1.0f - 0.5f * z
+		+ z * z * (4.166664568e-2f + z * (-1.388731625e-3f + z * 2.443315712e-5f));
+	*s = (float)(1 - (j & 2)) * mathc_select(j & 1, cp, sp);
+	*c = (float)(1 - ((j + 1) & 2)) * mathc_select(j & 1, sp, cp);
+}
+
+MATHC_KERNEL_BODY float mathc_sin_poly(float x)
+{
+	float s;
+	float c;
+	mathc_sincos_poly(x, &s, &c);
+	return s;
+}
+
+MATHC_KERNEL_BODY float mathc_cos_poly(float x)
+{
+	float s;
+	float c;
+	mathc_sincos_poly(x, &s, &c);
+	return c;
+}
+
+/* Square root of x >= 0: the bit-level reciprocal square root estimate and three Newton steps */
+MATHC_KERNEL_BODY float mathc_sqrt_poly(float x)
+{
+	union mathc_float_bits b;
+	float y;
+	b.f = x;
+	b.i = 0x5f3759df - (b.i >> 1);
+	y = b.f;
+	y = y * (1.5f - 0.5f * x * y * y);
+	y = y * (1.5f - 0.5f * x * y * y);
+	y = y * (1.5f - 0.5f * x * y * y);
+	return x * y;
+}
+
+/* Above 0.5, acos(x) = 2 * asin(sqrt((1 - x) / 2)), which keeps the polynomial on [0, 0.5] */
+MATHC_KERNEL_BODY float mathc_acos_poly(float x)
+{
+	float a = MFABS(x);
+	int big;
+	float z;
+	float t;
+	float p;
+	a = mathc_select(a > 1.0f, 1.0f, a);
+	big = a > 0.5f;
+	z = mathc_select(big, 0.5f * (1.0f - a), a * a);
+	t = mathc_select(big, mathc_sqrt_poly(z), x);
+	p = ((4.2163199048e-2f * z + 2.4181311049e-2f) * z + 4.5470025998e-2f) * z + 7.4953002686e-2f;
+	p = t + t * z * (p * z + 1.6666752422e-1f);
+	return mathc_select(big, mathc_select(x < 0.0f, 3.14159265f - 2.0f * p, 2.0f * p),
+						1.57079633f - p);
+}
+
+/* The ratio of the smaller and larger magnitudes is reduced below tan(pi/8) around pi/4 */
+MATHC_KERNEL_BODY float mathc_atan2_poly(float y, float x)
+{
+	float ax = MFABS(x);
+	float ay = MFABS(y);
+	float mx = mathc_select(ay > ax, ay, ax);
+	float mn = mathc_select(ay > ax, ax, ay);
+	float a = mn / mathc_select(mx > 0.0f, mx, 1.0f);
+	int big = a > 0.4142135624f;
+	float t = mathc_select(big, (a - 1.0f) / (a + 1.0f), a);
+	float z = t * t;
+	float r = ((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z;
+	r = (r - 3.33329491539e-1f) * z * t + t;
+	r = mathc_select(big, r + 0.785398163f, r);
+	r = mathc_select(ay > ax, 1.57079633f - r, r);
+	r = mathc_select(x < 0.0f, 3.14159265f - r, r);
+	return mathc_select(y < 0.0f, -r, r);
+}
+
+/*
+2^x as 2^j * 2^f with j the nearest integer. The power of two is built in two
+halves so that results near the overflow and in the denormal range are right.
+The argument is clamped to [-150, 128] before the conversion to an integer,
+with the comparisons written so that NaN is clamped too, and NaN is returned
+for it at the end.
+*/
+MATHC_KERNEL_BODY float mathc_exp2_poly(float x)
+{
+	union mathc_float_bits s0;
+	union mathc_float_bits s1;
+	int32_t j;
+	float y;
+	float f;
+	float p;
+	y = mathc_select(x < 128.0f, x, 128.0f);
+	y = mathc_select(y > -150.0f, y, -150.0f);
+	j = (int32_t)(y + 150.5f) - 150;
+	f = y - (float)j;
+	p = 9.618437357674640e-3f + f * (1.339887440266574e-3f + f * 1.535336188319500e-4f);
+	p = 1.0f + f * (6.931472028550421e-1f + f * (2.402264791363012e-1f
+		+ f * (5.550332471162809e-2f + f * p)));
+	s0.i = (j / 2 + 127) << 23;
+	s1.i = (j - j / 2 + 127) << 23;
+	return mathc_select(x == x, p * s0.f * s1.f, x);
+}
+
+/* log2(x) as the exponent plus the natural logarithm of the mantissa in [sqrt(0.5), sqrt(2)] */
+MATHC_KERNEL_BODY float mathc_log2_poly(float x)
+{
+	union mathc_float_bits b;
+	int32_t e;
+	int big;
+	float t;
+	float z;
+	float p;
+	float r;
+	b.f = x;
+	e = ((b.i >> 23) & 0xff) - 127;
+	b.i = (b.i & 0x7fffff) | 0x3f800000;
+	big = b.f > 1.41421356f;
+	e = e + big;
+	t = mathc_select(big, 0.5f * b.f, b.f) - 1.0f;
+	z = t * t;
+	p = ((7.0376836292e-2f * t - 1.1514610310e-1f) * t + 1.1676998740e-1f) * t;
+	p = (((p - 1.2420140846e-1f) * t + 1.4249322787e-1f) * t - 1.6668057665e-1f) * t;
+	p = ((p + 2.0000714765e-1f) * t - 2.4999993993e-1f) * t + 3.3333331174e-1f;
+	r = (float)e + (t + t * z * p - 0.5f * z) * 1.44269504f;
+	r = mathc_select(x == INFINITY, INFINITY, r);
+	r = mathc_select(x == 0.0f, -INFINITY, r);
+	return mathc_select(x >= 0.0f, r, NAN);
+}
+
+/* Like pow(), x^0 and 1^y are 1, where y * log2(x) is NaN for 0 * inf */
+MATHC_KERNEL_BODY float mathc_pow_poly(float x, float y)
+{
+	return mathc_select(y == 0.0f || x == 1.0f, 1.0f, mathc_exp2_poly(y * mathc_log2_poly(x)));
+}
+#else
+MATHC_KERNEL_BODY mfloat_t mathc_select(int c, mfloat_t a, mfloat_t b)
+{
+	return c ? a : b;
+}
+#endif
+
+/*
+The transcendental functions used by the functions that can run in loops: the
+easing functions, quat_slerp(), quat_angle(), vec2_angle() and the stream
+functions. MATHC_FAST_TRANSCENDENTALS replaces the C library with the
+polynomials in single precision. MATHC_SELECT_ARGUMENT() picks the argument of
+one of them in a branch-free kernel: a bitwise select keeps the polynomials
+vectorizable, while a plain condition is faster around a call into the C library.
+*/
+#if defined(MATHC_FAST_TRANSCENDENTALS) && defined(MATHC_USE_SINGLE_FLOATING_POINT)
+#define MATHC_SQRT(x) mathc_sqrt_poly(x)
+#define MATHC_SIN(x) mathc_sin_poly(x)
+#define MATHC_COS(x) mathc_cos_poly(x)
+#define MATHC_ACOS(x) mathc_acos_poly(x)
+#define MATHC_ATAN2(y, x) mathc_atan2_poly((y), (x))
+#define MATHC_EXP2(x) mathc_exp2_poly(x)
+#define MATHC_SELECT_ARGUMENT(c, a, b) mathc_select((c), (a), (b))
+#else
+#define MATHC_SQRT(x) MSQRT(x)
+#define MATHC_SIN(x) MSIN(x)
+#define MATHC_COS(x) MCOS(x)
+#define MATHC_ACOS(x) MACOS(x)
+#define MATHC_ATAN2(y, x) MATAN2((y), (x))
+#define MATHC_EXP2(x) MPOW(MFLOAT_C(2.0), (x))
+#define MATHC_SELECT_ARGUMENT(c, a, b) ((c) ? (a) : (b))
+#endif
+#endif
+
+#if defined(MATHC_USE_DISPATCH)
+struct mathc_dispatch {
+	enum mathc_simd simd;
+	mfloat_t* (*vec4_multiply_mat4)(mfloat_t* result, mfloat_t* v0, mfloat_t* m0);
+	mfloat_t* (*quat_slerp)(mfloat_t* result, mfloat_t* q0, mfloat_t* q1, mfloat_t f);
+	mfloat_t* (*mat4_multiply)(mfloat_t* result, mfloat_t* m0, mfloat_t* m1);
+	mfloat_t* (*mat4_inverse)(mfloat_t* result, mfloat_t* m0);
+	mfloat_t* (*affine_multiply)(mfloat_t* result, mfloat_t* a0, mfloat_t* a1);
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+	void (*vec3_multiply_mat3_n)(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+								 mfloat_t* y0, mfloat_t* z0, mfloat_t* m0, size_t n);
+	void (*vec3_cross_n)(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0,
+						 mfloat_t* z0, mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, size_t n);
+	void (*vec3_normalize_n)(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0,
+							 mfloat_t* z0, size_t n);
+	void (*vec3_dot_n)(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* x1,
+					   mfloat_t* y1, mfloat_t* z1, size_t n);
+	void (*vec3_length_n)(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, size_t n);
+	void (*vec3_distance_n)(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+							mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, size_t n);
+	void (*mat4_transform_points_n)(mfloat_t* result, size_t result_stride, mfloat_t* v0,
+									size_t v0_stride, mfloat_t* m0, size_t n);
+	void (*mat4_transform_directions_n)(mfloat_t* result, size_t result_stride, mfloat_t* v0,
+										size_t v0_stride, mfloat_t* m0, size_t n);
+	void (*mat4_multiply_n)(mfloat_t* result, size_t result_stride, mfloat_t* m0,
+							size_t m0_stride, mfloat_t* m1, size_t m1_stride, size_t n);
+	void (*frustum_cull_spheres_n)(uint32_t* result, mfloat_t* frustum, mfloat_t* x0,
+								   mfloat_t* y0, mfloat_t* z0, mfloat_t* radius, size_t n);
+	void (*frustum_cull_aabbs_n)(uint32_t* result, mfloat_t* frustum, mfloat_t* x0, mfloat_t* y0,
+								 mfloat_t* z0, mfloat_t* ex, mfloat_t* ey, mfloat_t* ez, size_t n);
+	void (*ray_intersect_aabbs_n)(mfloat_t* distance, size_t* index, mfloat_t* origin,
+								  mfloat_t* direction, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+								  mfloat_t* ex, mfloat_t* ey, mfloat_t* ez, size_t n);
+	void (*ray_intersect_triangles_n)(mfloat_t* distance, size_t* index, mfloat_t* origin,
+									  mfloat_t* direction, mfloat_t* x0, mfloat_t* y0,
+									  mfloat_t* z0, mfloat_t* x1, mfloat_t* y1, mfloat_t* z1,
+									  mfloat_t* x2, mfloat_t* y2, mfloat_t* z2, size_t n);
+	void (*skin_affine_n)(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx, mfloat_t* rny,
+						  mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* nx0,
+						  mfloat_t* ny0, mfloat_t* nz0, uint16_t* bones, mfloat_t* weights,
+						  mfloat_t* palette, size_t n);
+	void (*skin_mat4_n)(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx, mfloat_t* rny,
+						mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* nx0,
+						mfloat_t* ny0, mfloat_t* nz0, uint16_t* bones, mfloat_t* weights,
+						mfloat_t* palette, size_t n);
+	void (*skin_dualquat_n)(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx, mfloat_t* rny,
+							mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+							mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0, uint16_t* bones,
+							mfloat_t* weights, mfloat_t* palette, size_t n);
+	void (*mat4_from_transform_hierarchy_n)(mfloat_t* result, mfloat_t* local, int32_t* parents,
+											size_t n);
+	void (*mat4_rotation_axis_n)(mfloat_t* result, mfloat_t* axes, mfloat_t* angles, size_t n);
+	void (*quat_from_axis_angle_n)(mfloat_t* result, mfloat_t* axes, mfloat_t* angles, size_t n);
+	void (*quat_nlerp_n)(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw, mfloat_t* x0,
+						 mfloat_t* y0, mfloat_t* z0, mfloat_t* w0, mfloat_t* x1, mfloat_t* y1,
+						 mfloat_t* z1, mfloat_t* w1, mfloat_t f, size_t n);
+	void (*quat_slerp_n)(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw, mfloat_t* x0,
+						 mfloat_t* y0, mfloat_t* z0, mfloat_t* w0, mfloat_t* x1, mfloat_t* y1,
+						 mfloat_t* z1, mfloat_t* w1, mfloat_t f, size_t n);
+	void (*quat_slerp_fast_n)(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw, mfloat_t* x0,
+							  mfloat_t* y0, mfloat_t* z0, mfloat_t* w0, mfloat_t* x1, mfloat_t* y1,
+							  mfloat_t* z1, mfloat_t* w1, mfloat_t f, size_t n);
+	void (*vec2_angle_n)(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, size_t n);
+#if defined(MATHC_USE_EASING_FUNCTIONS)
+	void (*mathc_ease_n)(mfloat_t* result, mfloat_t* f, enum mathc_easing easing, size_t n);
+	void (*mathc_easing_table_linear_n)(mfloat_t* result, mfloat_t* f, mfloat_t* table,
+										size_t size, size_t n);
+	void (*mathc_easing_table_cubic_n)(mfloat_t* result, mfloat_t* f, mfloat_t* table,
+									   size_t size, size_t n);
+	void (*mathc_cubic_bezier_ease_n)(mfloat_t* result, mfloat_t* f,
+									  struct mathc_cubic_bezier* bezier, size_t n);
+#endif
+#endif
+};
+
+static struct mathc_dispatch mathc_dispatch_tables[MATHC_SIMD_AVX512 + 1];
+static struct mathc_dispatch* mathc_dispatch_current;
+
+static void mathc_dispatch_fill(struct mathc_dispatch* table, enum mathc_simd simd);
+
+/*
+The tables of every tier supported by the CPU are filled once, by whichever
+thread calls a dispatched function first, and the other threads wait for it.
+The one-time initialization of the platform orders the fill before every read,
+and the tables are never written again. Selecting a tier only stores a pointer
+to its table, so the threads that call mathc meanwhile use either the old or
+the new table. With GCC and Clang, the pointer is also published with release
+ordering, so the calls after the first one only pay for an acquire load.
+*/
+#if defined(__GNUC__)
+#define MATHC_DISPATCH_PUBLISH(table) \
+	__atomic_store_n(&mathc_dispatch_current, (table), __ATOMIC_RELEASE)
+#define MATHC_DISPATCH_CURRENT() __atomic_load_n(&mathc_dispatch_current, __ATOMIC_ACQUIRE)
+#else
+#define MATHC_DISPATCH_PUBLISH(table) \
+	(*(struct mathc_dispatch* volatile*)&mathc_dispatch_current = (table))
+#define MATHC_DISPATCH_CURRENT() (*(struct mathc_dispatch* volatile*)&mathc_dispatch_current)
+#endif
+
+static void mathc_dispatch_fill_tiers(void)
+{
+	enum mathc_simd best = mathc_simd_detect();
+	for (int32_t simd = MATHC_SIMD_SCALAR; simd <= (int32_t)best; ++simd) {
+		mathc_dispatch_fill(&mathc_dispatch_tables[simd], (enum mathc_simd)simd);
+	}
+	MATHC_DISPATCH_PUBLISH(&mathc_dispatch_tables[best]);
+}
+
+#if defined(_WIN32)
+static INIT_ONCE mathc_dispatch_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK mathc_dispatch_init(PINIT_ONCE once, PVOID parameter, PVOID* context)
+{
+	(void)once;
+	(void)parameter;
+	(void)context;
+	mathc_dispatch_fill_tiers();
+	return TRUE;
+}
+#else
+static pthread_once_t mathc_dispatch_once = PTHREAD_ONCE_INIT;
+
+static void mathc_dispatch_init(void)
+{
+	mathc_dispatch_fill_tiers();
+}
+#endif
+
+/* Out of line, so the dispatched functions don't save registers for this call */
+MATHC_KERNEL_NOINLINE struct mathc_dispatch* mathc_dispatch_get_once(void)
+{
+#if defined(_WIN32)
+	InitOnceExecuteOnce(&mathc_dispatch_once, mathc_dispatch_init, NULL, NULL);
+#else
+	pthread_once(&mathc_dispatch_once, mathc_dispatch_init);
+#endif
+	return MATHC_DISPATCH_CURRENT();
+}
+
+static struct mathc_dispatch* mathc_dispatch_get(void)
+{
+#if defined(__GNUC__)
+	struct mathc_dispatch* table = MATHC_DISPATCH_CURRENT();
+	if (__builtin_expect(table != NULL, 1)) {
+		return table;
+	}
+#endif
+	return mathc_dispatch_get_once();
+}
+#endif
+
+void* mathc_aligned_alloc(size_t size, size_t alignment)
+{
+	/* Over-allocate and keep the pointer returned by malloc() just before the block */
+	void* base;
+	uintptr_t aligned;
+	if (alignment < sizeof(void*)) {
+		alignment = sizeof(void*);
+	}
+	if ((alignment & (alignment - 1)) != 0 || size > SIZE_MAX - alignment - sizeof(void*)) {
+		return NULL;
+	}
+	base = malloc(size + alignment + sizeof(void*));
+	if (base == NULL) {
+		return NULL;
+	}
+	aligned = ((uintptr_t)base + sizeof(void*) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+	((void**)aligned)[-1] = base;
+	return (void*)aligned;
+}
+
+void mathc_aligned_free(void* pointer)
+{
+	if (pointer != NULL) {
+		free(((void**)pointer)[-1]);
+	}
+}
+
 #if defined(MATHC_USE_INT)
 mint_t clampi(mint_t value, mint_t min, mint_t max)
 {
@@ -92,6 +604,78 @@ mfloat_t remap(mfloat_t value, mfloat_t in_min, mfloat_t in_max, mfloat_t out_mi
 	mfloat_t t = inverse_lerp(in_min, in_max, value);
 	return lerp(out_min, out_max, t);
 }
+
+#if defined(MATHC_USE_SINGLE_FLOATING_POINT)
+mfloat_t mathc_sin_fast(mfloat_t x)
+{
+	return mathc_sin_poly(x);
+}
+
+mfloat_t mathc_cos_fast(mfloat_t x)
+{
+	return mathc_cos_poly(x);
+}
+
+mfloat_t mathc_acos_fast(mfloat_t x)
+{
+	return mathc_acos_poly(x);
+}
+
+mfloat_t mathc_atan2_fast(mfloat_t y, mfloat_t x)
+{
+	return mathc_atan2_poly(y, x);
+}
+
+mfloat_t mathc_exp2_fast(mfloat_t x)
+{
+	return mathc_exp2_poly(x);
+}
+
+mfloat_t mathc_log2_fast(mfloat_t x)
+{
+	return mathc_log2_poly(x);
+}
+
+mfloat_t mathc_pow_fast(mfloat_t x, mfloat_t y)
+{
+	return mathc_pow_poly(x, y);
+}
+#else
+mfloat_t mathc_sin_fast(mfloat_t x)
+{
+	return MSIN(x);
+}
+
+mfloat_t mathc_cos_fast(mfloat_t x)
+{
+	return MCOS(x);
+}
+
+mfloat_t mathc_acos_fast(mfloat_t x)
+{
+	return MACOS(x);
+}
+
+mfloat_t mathc_atan2_fast(mfloat_t y, mfloat_t x)
+{
+	return MATAN2(y, x);
+}
+
+mfloat_t mathc_exp2_fast(mfloat_t x)
+{
+	return MPOW(MFLOAT_C(2.0), x);
+}
+
+mfloat_t mathc_log2_fast(mfloat_t x)
+{
+	return MLOG2(x);
+}
+
+mfloat_t mathc_pow_fast(mfloat_t x, mfloat_t y)
+{
+	return MPOW(x, y);
+}
+#endif
 #endif
 
 #if defined(MATHC_USE_INT)
@@ -1011,10 +1595,22 @@ mfloat_t* vec2_clamp(mfloat_t* result, mfloat_t* v0, mfloat_t* v1, mfloat_t* v2)
 
 mfloat_t* vec2_normalize(mfloat_t* result, mfloat_t* v0)
 {
+#if defined(MATHC_USE_FAST_NORMALIZE)
+	return vec2_normalize_fast(result, v0);
+#else
 	mfloat_t l = MSQRT(v0[0] * v0[0] + v0[1] * v0[1]);
 	result[0] = v0[0] / l;
 	result[1] = v0[1] / l;
 	return result;
+#endif
+}
+
+mfloat_t* vec2_normalize_fast(mfloat_t* result, mfloat_t* v0)
+{
+	mfloat_t l = mathc_rsqrt(v0[0] * v0[0] + v0[1] * v0[1]);
+	result[0] = v0[0] * l;
+	result[1] = v0[1] * l;
+	return result;
 }
 
 mfloat_t vec2_dot(mfloat_t* v0, mfloat_t* v1)
@@ -1058,10 +1654,11 @@ mfloat_t* vec2_tangent(mfloat_t* result, mfloat_t* v0)
 
 mfloat_t* vec2_rotate(mfloat_t* result, mfloat_t* v0, mfloat_t f)
 {
-	mfloat_t cs = MCOS(f);
-	mfloat_t sn = MSIN(f);
+	mfloat_t cs;
+	mfloat_t sn;
 	mfloat_t x = v0[0];
 	mfloat_t y = v0[1];
+	MSINCOS(f, &sn, &cs);
 	result[0] = x * cs - y * sn;
 	result[1] = x * sn + y * cs;
 	return result;
@@ -1103,7 +1700,7 @@ mfloat_t* vec2_bezier4(mfloat_t* result, mfloat_t* v0, mfloat_t* v1, mfloat_t* v
 
 mfloat_t vec2_angle(mfloat_t* v0)
 {
-	return MATAN2(v0[1], v0[0]);
+	return MATHC_ATAN2(v0[1], v0[0]);
 }
 
 mfloat_t vec2_length(mfloat_t* v0)
@@ -1409,11 +2006,24 @@ mfloat_t* vec3_cross(mfloat_t* result, mfloat_t* v0, mfloat_t* v1)
 
 mfloat_t* vec3_normalize(mfloat_t* result, mfloat_t* v0)
 {
+#if defined(MATHC_USE_FAST_NORMALIZE)
+	return vec3_normalize_fast(result, v0);
+#else
 	mfloat_t l = MSQRT(v0[0] * v0[0] + v0[1] * v0[1] + v0[2] * v0[2]);
 	result[0] = v0[0] / l;
 	result[1] = v0[1] / l;
 	result[2] = v0[2] / l;
 	return result;
+#endif
+}
+
+mfloat_t* vec3_normalize_fast(mfloat_t* result, mfloat_t* v0)
+{
+	mfloat_t l = mathc_rsqrt(v0[0] * v0[0] + v0[1] * v0[1] + v0[2] * v0[2]);
+	result[0] = v0[0] * l;
+	result[1] = v0[1] * l;
+	result[2] = v0[2] * l;
+	return result;
 }
 
 mfloat_t vec3_dot(mfloat_t* v0, mfloat_t* v1)
@@ -1459,8 +2069,7 @@ mfloat_t* vec3_rotate(mfloat_t* result, mfloat_t* v0, mfloat_t* ra, mfloat_t f)
 	mfloat_t rx;
 	mfloat_t ry;
 	mfloat_t rz;
-	cs = MCOS(f);
-	sn = MSIN(f);
+	MSINCOS(f, &sn, &cs);
 	x = v0[0];
 	y = v0[1];
 	z = v0[2];
@@ -1726,7 +2335,7 @@ mfloat_t* vec4_multiply_f(mfloat_t* result, mfloat_t* v0, mfloat_t f)
 	return result;
 }
 
-mfloat_t* vec4_multiply_mat4(mfloat_t* result, mfloat_t* v0, mfloat_t* m0)
+MATHC_KERNEL mfloat_t* vec4_multiply_mat4_scalar(mfloat_t* result, mfloat_t* v0, mfloat_t* m0)
 {
 	mfloat_t x = v0[0];
 	mfloat_t y = v0[1];
@@ -1739,6 +2348,49 @@ mfloat_t* vec4_multiply_mat4(mfloat_t* result, mfloat_t* v0, mfloat_t* m0)
 	return result;
 }
 
+#if defined(MATHC_HAS_SSE)
+MATHC_TARGET_SSE MATHC_KERNEL mfloat_t* vec4_multiply_mat4_sse(mfloat_t* result, mfloat_t* v0,
+															   mfloat_t* m0)
+{
+	__m128 v = _mm_loadu_ps(v0);
+	__m128 r = _mm_mul_ps(_mm_loadu_ps(m0), _mm_shuffle_ps(v, v, 0x00));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(m0 + 4), _mm_shuffle_ps(v, v, 0x55)));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(m0 + 8), _mm_shuffle_ps(v, v, 0xAA)));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(m0 + 12), _mm_shuffle_ps(v, v, 0xFF)));
+	_mm_storeu_ps(result, r);
+	return result;
+}
+#endif
+
+#if defined(MATHC_HAS_AVX2)
+MATHC_TARGET_AVX2 MATHC_KERNEL mfloat_t* vec4_multiply_mat4_avx2(mfloat_t* result, mfloat_t* v0,
+																 mfloat_t* m0)
+{
+	/* Columns 0/1 are scaled by x/y and columns 2/3 by z/w in one pass */
+	__m256 v = _mm256_broadcast_ps((const __m128*)v0);
+	__m256 xy = _mm256_permutevar_ps(v, _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1));
+	__m256 zw = _mm256_permutevar_ps(v, _mm256_setr_epi32(2, 2, 2, 2, 3, 3, 3, 3));
+	__m256 sum = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(m0), xy),
+							   _mm256_mul_ps(_mm256_loadu_ps(m0 + 8), zw));
+	_mm_storeu_ps(result,
+				  _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1)));
+	return result;
+}
+#endif
+
+mfloat_t* vec4_multiply_mat4(mfloat_t* result, mfloat_t* v0, mfloat_t* m0)
+{
+#if defined(MATHC_USE_DISPATCH)
+	return mathc_dispatch_get()->vec4_multiply_mat4(result, v0, m0);
+#elif defined(MATHC_HAS_AVX2)
+	return vec4_multiply_mat4_avx2(result, v0, m0);
+#elif defined(MATHC_HAS_SSE)
+	return vec4_multiply_mat4_sse(result, v0, m0);
+#else
+	return vec4_multiply_mat4_scalar(result, v0, m0);
+#endif
+}
+
 mfloat_t* vec4_divide(mfloat_t* result, mfloat_t* v0, mfloat_t* v1)
 {
 	result[0] = v0[0] / v1[0];
@@ -1847,12 +2499,26 @@ mfloat_t* vec4_clamp(mfloat_t* result, mfloat_t* v0, mfloat_t* v1, mfloat_t* v2)
 
 mfloat_t* vec4_normalize(mfloat_t* result, mfloat_t* v0)
 {
+#if defined(MATHC_USE_FAST_NORMALIZE)
+	return vec4_normalize_fast(result, v0);
+#else
 	mfloat_t l = MSQRT(v0[0] * v0[0] + v0[1] * v0[1] + v0[2] * v0[2] + v0[3] * v0[3]);
 	result[0] = v0[0] / l;
 	result[1] = v0[1] / l;
 	result[2] = v0[2] / l;
 	result[3] = v0[3] / l;
 	return result;
+#endif
+}
+
+mfloat_t* vec4_normalize_fast(mfloat_t* result, mfloat_t* v0)
+{
+	mfloat_t l = mathc_rsqrt(v0[0] * v0[0] + v0[1] * v0[1] + v0[2] * v0[2] + v0[3] * v0[3]);
+	result[0] = v0[0] * l;
+	result[1] = v0[1] * l;
+	result[2] = v0[2] * l;
+	result[3] = v0[3] * l;
+	return result;
 }
 
 mfloat_t* vec4_lerp(mfloat_t* result, mfloat_t* v0, mfloat_t* v1, mfloat_t f)
@@ -1936,10 +2602,10 @@ mfloat_t* quat_divide(mfloat_t* result, mfloat_t* q0, mfloat_t* q1)
 	mfloat_t y = q0[1];
 	mfloat_t z = q0[2];
 	mfloat_t w = q0[3];
-	mfloat_t ls = q1[0] * q1[0] + q1[1] * q1[1] + q1[8] * q1[8] + q1[3] * q1[3];
+	mfloat_t ls = q1[0] * q1[0] + q1[1] * q1[1] + q1[2] * q1[2] + q1[3] * q1[3];
 	mfloat_t normalized_x = -q1[0] / ls;
 	mfloat_t normalized_y = -q1[1] / ls;
-	mfloat_t normalized_z = -q1[8] / ls;
+	mfloat_t normalized_z = -q1[2] / ls;
 	mfloat_t normalized_w = q1[3] / ls;
 	result[0] = x * normalized_w + normalized_x * w + (y * normalized_z - z * normalized_y);
 	result[1] = y * normalized_w + normalized_y * w + (z * normalized_x - x * normalized_z);
@@ -1987,6 +2653,9 @@ mfloat_t* quat_inverse(mfloat_t* result, mfloat_t* q0)
 
 mfloat_t* quat_normalize(mfloat_t* result, mfloat_t* q0)
 {
+#if defined(MATHC_USE_FAST_NORMALIZE)
+	return quat_normalize_fast(result, q0);
+#else
 	mfloat_t l =
 		MFLOAT_C(1.0) / MSQRT(q0[0] * q0[0] + q0[1] * q0[1] + q0[2] * q0[2] + q0[3] * q0[3]);
 	result[0] = q0[0] * l;
@@ -1994,6 +2663,17 @@ mfloat_t* quat_normalize(mfloat_t* result, mfloat_t* q0)
 	result[2] = q0[2] * l;
 	result[3] = q0[3] * l;
 	return result;
+#endif
+}
+
+mfloat_t* quat_normalize_fast(mfloat_t* result, mfloat_t* q0)
+{
+	mfloat_t l = mathc_rsqrt(q0[0] * q0[0] + q0[1] * q0[1] + q0[2] * q0[2] + q0[3] * q0[3]);
+	result[0] = q0[0] * l;
+	result[1] = q0[1] * l;
+	result[2] = q0[2] * l;
+	result[3] = q0[3] * l;
+	return result;
 }
 
 mfloat_t quat_dot(mfloat_t* q0, mfloat_t* q1)
@@ -2006,11 +2686,14 @@ mfloat_t* quat_power(mfloat_t* result, mfloat_t* q0, mfloat_t exponent)
 	if (MFABS(q0[3]) < MFLOAT_C(1.0) - MFLT_EPSILON) {
 		mfloat_t alpha = MACOS(q0[3]);
 		mfloat_t new_alpha = alpha * exponent;
-		mfloat_t s = MSIN(new_alpha) / MSIN(alpha);
+		mfloat_t s;
+		mfloat_t c;
+		MSINCOS(new_alpha, &s, &c);
+		s = s / MSIN(alpha);
 		result[0] = result[0] * s;
 		result[1] = result[1] * s;
 		result[2] = result[2] * s;
-		result[3] = MCOS(new_alpha);
+		result[3] = c;
 	} else {
 		result[0] = q0[0];
 		result[1] = q0[1];
@@ -2020,17 +2703,24 @@ mfloat_t* quat_power(mfloat_t* result, mfloat_t* q0, mfloat_t exponent)
 	return result;
 }
 
-mfloat_t* quat_from_axis_angle(mfloat_t* result, mfloat_t* v0, mfloat_t angle)
+MATHC_KERNEL_BODY mfloat_t* quat_from_axis_sincos(mfloat_t* result, mfloat_t* v0, mfloat_t s,
+												  mfloat_t c)
 {
-	mfloat_t half = angle * MFLOAT_C(0.5);
-	mfloat_t s = MSIN(half);
 	result[0] = v0[0] * s;
 	result[1] = v0[1] * s;
 	result[2] = v0[2] * s;
-	result[3] = MCOS(half);
+	result[3] = c;
 	return result;
 }
 
+mfloat_t* quat_from_axis_angle(mfloat_t* result, mfloat_t* v0, mfloat_t angle)
+{
+	mfloat_t s;
+	mfloat_t c;
+	MSINCOS(angle * MFLOAT_C(0.5), &s, &c);
+	return quat_from_axis_sincos(result, v0, s, c);
+}
+
 mfloat_t* quat_from_vec3(mfloat_t* result, mfloat_t* v0, mfloat_t* v1)
 {
 	mfloat_t cross[VEC3_SIZE];
@@ -2087,7 +2777,8 @@ mfloat_t* quat_lerp(mfloat_t* result, mfloat_t* q0, mfloat_t* q1, mfloat_t f)
 	return result;
 }
 
-mfloat_t* quat_slerp(mfloat_t* result, mfloat_t* q0, mfloat_t* q1, mfloat_t f)
+MATHC_KERNEL mfloat_t* quat_slerp_scalar(mfloat_t* result, mfloat_t* q0, mfloat_t* q1,
+									   mfloat_t f)
 {
 	mfloat_t tmp1[QUAT_SIZE];
 	mfloat_t d = quat_dot(q0, q1);
@@ -2102,10 +2793,10 @@ mfloat_t* quat_slerp(mfloat_t* result, mfloat_t* q0, mfloat_t* q1, mfloat_t f)
 		f0 = MFLOAT_C(1.0) - f;
 		f1 = f;
 	} else {
-		mfloat_t theta = MACOS(d);
-		mfloat_t sin_theta = MSIN(theta);
-		f0 = MSIN((MFLOAT_C(1.0) - f) * theta) / sin_theta;
-		f1 = MSIN(f * theta) / sin_theta;
+		mfloat_t theta = MATHC_ACOS(d);
+		mfloat_t sin_theta = MATHC_SIN(theta);
+		f0 = MATHC_SIN((MFLOAT_C(1.0) - f) * theta) / sin_theta;
+		f1 = MATHC_SIN(f * theta) / sin_theta;
 	}
 	result[0] = q0[0] * f0 + tmp1[0] * f1;
 	result[1] = q0[1] * f0 + tmp1[1] * f1;
@@ -2114,6 +2805,50 @@ mfloat_t* quat_slerp(mfloat_t* result, mfloat_t* q0, mfloat_t* q1, mfloat_t f)
 	return result;
 }
 
+#if defined(MATHC_HAS_SSE)
+MATHC_TARGET_SSE MATHC_KERNEL mfloat_t* quat_slerp_sse(mfloat_t* result, mfloat_t* q0, mfloat_t* q1,
+													   mfloat_t f)
+{
+	__m128 a = _mm_loadu_ps(q0);
+	__m128 b = _mm_loadu_ps(q1);
+	__m128 d = _mm_mul_ps(a, b);
+	__m128 sign;
+	mfloat_t cos_theta;
+	mfloat_t f0;
+	mfloat_t f1;
+	d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(1, 0, 3, 2)));
+	d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)));
+	/* Move q1 into the hemisphere of q0 by flipping it with the sign of the dot product */
+	sign = _mm_and_ps(d, _mm_set1_ps(-0.0f));
+	b = _mm_xor_ps(b, sign);
+	cos_theta = _mm_cvtss_f32(_mm_xor_ps(d, sign));
+	if (cos_theta > MFLOAT_C(0.9995)) {
+		f0 = MFLOAT_C(1.0) - f;
+		f1 = f;
+	} else {
+		mfloat_t theta = MATHC_ACOS(cos_theta);
+		mfloat_t sin_theta = MATHC_SIN(theta);
+		f0 = MATHC_SIN((MFLOAT_C(1.0) - f) * theta) / sin_theta;
+		f1 = MATHC_SIN(f * theta) / sin_theta;
+	}
+	a = _mm_mul_ps(a, _mm_set1_ps(f0));
+	b = _mm_mul_ps(b, _mm_set1_ps(f1));
+	_mm_storeu_ps(result, _mm_add_ps(a, b));
+	return result;
+}
+#endif
+
+mfloat_t* quat_slerp(mfloat_t* result, mfloat_t* q0, mfloat_t* q1, mfloat_t f)
+{
+#if defined(MATHC_USE_DISPATCH)
+	return mathc_dispatch_get()->quat_slerp(result, q0, q1, f);
+#elif defined(MATHC_HAS_SSE)
+	return quat_slerp_sse(result, q0, q1, f);
+#else
+	return quat_slerp_scalar(result, q0, q1, f);
+#endif
+}
+
 mfloat_t quat_length(mfloat_t* q0)
 {
 	return MSQRT(q0[0] * q0[0] + q0[1] * q0[1] + q0[2] * q0[2] + q0[3] * q0[3]);
@@ -2126,9 +2861,24 @@ mfloat_t quat_length_squared(mfloat_t* q0)
 
 mfloat_t quat_angle(mfloat_t* q0, mfloat_t* q1)
 {
-	mfloat_t s = MSQRT(quat_length_squared(q0) * quat_length_squared(q1));
+	mfloat_t s = MATHC_SQRT(quat_length_squared(q0) * quat_length_squared(q1));
 	s = MFLOAT_C(1.0) / s;
-	return MACOS(quat_dot(q0, q1) * s);
+	return MATHC_ACOS(quat_dot(q0, q1) * s);
+}
+
+mfloat_t* quat_rotate_vec3(mfloat_t* result, mfloat_t* q0, mfloat_t* v0)
+{
+	/* v + w * t + cross(q, t), with t = 2 * cross(q, v) */
+	mfloat_t tx = MFLOAT_C(2.0) * (q0[1] * v0[2] - q0[2] * v0[1]);
+	mfloat_t ty = MFLOAT_C(2.0) * (q0[2] * v0[0] - q0[0] * v0[2]);
+	mfloat_t tz = MFLOAT_C(2.0) * (q0[0] * v0[1] - q0[1] * v0[0]);
+	mfloat_t x = v0[0] + q0[3] * tx + q0[1] * tz - q0[2] * ty;
+	mfloat_t y = v0[1] + q0[3] * ty + q0[2] * tx - q0[0] * tz;
+	mfloat_t z = v0[2] + q0[3] * tz + q0[0] * ty - q0[1] * tx;
+	result[0] = x;
+	result[1] = y;
+	result[2] = z;
+	return result;
 }
 
 mfloat_t* mat2(mfloat_t* result, mfloat_t m11, mfloat_t m12, mfloat_t m21, mfloat_t m22)
@@ -2277,8 +3027,9 @@ mfloat_t* mat2_scale(mfloat_t* result, mfloat_t* m0, mfloat_t* v0)
 
 mfloat_t* mat2_rotation_z(mfloat_t* result, mfloat_t f)
 {
-	mfloat_t c = MCOS(f);
-	mfloat_t s = MSIN(f);
+	mfloat_t c;
+	mfloat_t s;
+	MSINCOS(f, &s, &c);
 	result[0] = c;
 	result[1] = s;
 	result[2] = -s;
@@ -2547,8 +3298,9 @@ mfloat_t* mat3_scale(mfloat_t* result, mfloat_t* m0, mfloat_t* v0)
 
 mfloat_t* mat3_rotation_x(mfloat_t* result, mfloat_t f)
 {
-	mfloat_t c = MCOS(f);
-	mfloat_t s = MSIN(f);
+	mfloat_t c;
+	mfloat_t s;
+	MSINCOS(f, &s, &c);
 	result[0] = MFLOAT_C(1.0);
 	result[1] = MFLOAT_C(0.0);
 	result[2] = MFLOAT_C(0.0);
@@ -2563,8 +3315,9 @@ mfloat_t* mat3_rotation_x(mfloat_t* result, mfloat_t f)
 
 mfloat_t* mat3_rotation_y(mfloat_t* result, mfloat_t f)
 {
-	mfloat_t c = MCOS(f);
-	mfloat_t s = MSIN(f);
+	mfloat_t c;
+	mfloat_t s;
+	MSINCOS(f, &s, &c);
 	result[0] = c;
 	result[1] = MFLOAT_C(0.0);
 	result[2] = -s;
@@ -2579,8 +3332,9 @@ mfloat_t* mat3_rotation_y(mfloat_t* result, mfloat_t f)
 
 mfloat_t* mat3_rotation_z(mfloat_t* result, mfloat_t f)
 {
-	mfloat_t c = MCOS(f);
-	mfloat_t s = MSIN(f);
+	mfloat_t c;
+	mfloat_t s;
+	MSINCOS(f, &s, &c);
 	result[0] = c;
 	result[1] = s;
 	result[2] = MFLOAT_C(0.0);
@@ -2595,9 +3349,9 @@ mfloat_t* mat3_rotation_z(mfloat_t* result, mfloat_t f)
 
 mfloat_t* mat3_rotation_axis(mfloat_t* result, mfloat_t* v0, mfloat_t f)
 {
-	mfloat_t c = MCOS(f);
-	mfloat_t s = MSIN(f);
-	mfloat_t one_c = MFLOAT_C(1.0) - c;
+	mfloat_t c;
+	mfloat_t s;
+	mfloat_t one_c;
 	mfloat_t x = v0[0];
 	mfloat_t y = v0[1];
 	mfloat_t z = v0[2];
@@ -2609,6 +3363,8 @@ mfloat_t* mat3_rotation_axis(mfloat_t* result, mfloat_t* v0, mfloat_t f)
 	mfloat_t zz = z * z;
 	mfloat_t l = xx + yy + zz;
 	mfloat_t sqrt_l = MSQRT(l);
+	MSINCOS(f, &s, &c);
+	one_c = MFLOAT_C(1.0) - c;
 	result[0] = (xx + (yy + zz) * c) / l;
 	result[1] = (xy * one_c + v0[2] * sqrt_l * s) / l;
 	result[2] = (xz * one_c - v0[1] * sqrt_l * s) / l;
@@ -2628,19 +3384,19 @@ mfloat_t* mat3_rotation_quat(mfloat_t* result, mfloat_t* q0)
 	mfloat_t zz = q0[2] * q0[2];
 	mfloat_t xy = q0[0] * q0[1];
 	mfloat_t zw = q0[2] * q0[3];
-	mfloat_t xz = q0[8] * q0[0];
+	mfloat_t xz = q0[0] * q0[2];
 	mfloat_t yw = q0[1] * q0[3];
 	mfloat_t yz = q0[1] * q0[2];
 	mfloat_t xw = q0[0] * q0[3];
-	result[0] = MFLOAT_C(1.0) - MFLOAT_C(2.0) * (yy - zz);
+	result[0] = MFLOAT_C(1.0) - MFLOAT_C(2.0) * (yy + zz);
 	result[1] = MFLOAT_C(2.0) * (xy + zw);
 	result[2] = MFLOAT_C(2.0) * (xz - yw);
 	result[3] = MFLOAT_C(2.0) * (xy - zw);
-	result[4] = MFLOAT_C(1.0) - MFLOAT_C(2.0) * (xx - zz);
+	result[4] = MFLOAT_C(1.0) - MFLOAT_C(2.0) * (xx + zz);
 	result[5] = MFLOAT_C(2.0) * (yz + xw);
 	result[6] = MFLOAT_C(2.0) * (xz + yw);
 	result[7] = MFLOAT_C(2.0) * (yz - xw);
-	result[8] = MFLOAT_C(1.0) - MFLOAT_C(2.0) * (xx - yy);
+	result[8] = MFLOAT_C(1.0) - MFLOAT_C(2.0) * (xx + yy);
 	return result;
 }
 
@@ -3017,8 +3773,9 @@ mfloat_t* mat4_cofactor(mfloat_t* result, mfloat_t* m0)
 
 mfloat_t* mat4_rotation_x(mfloat_t* result, mfloat_t f)
 {
-	mfloat_t c = MCOS(f);
-	mfloat_t s = MSIN(f);
+	mfloat_t c;
+	mfloat_t s;
+	MSINCOS(f, &s, &c);
 	result[0] = MFLOAT_C(1.0);
 	result[1] = MFLOAT_C(0.0);
 	result[2] = MFLOAT_C(0.0);
@@ -3040,8 +3797,9 @@ mfloat_t* mat4_rotation_x(mfloat_t* result, mfloat_t f)
 
 mfloat_t* mat4_rotation_y(mfloat_t* result, mfloat_t f)
 {
-	mfloat_t c = MCOS(f);
-	mfloat_t s = MSIN(f);
+	mfloat_t c;
+	mfloat_t s;
+	MSINCOS(f, &s, &c);
 	result[0] = c;
 	result[1] = MFLOAT_C(0.0);
 	result[2] = -s;
@@ -3063,8 +3821,9 @@ mfloat_t* mat4_rotation_y(mfloat_t* result, mfloat_t f)
 
 mfloat_t* mat4_rotation_z(mfloat_t* result, mfloat_t f)
 {
-	mfloat_t c = MCOS(f);
-	mfloat_t s = MSIN(f);
+	mfloat_t c;
+	mfloat_t s;
+	MSINCOS(f, &s, &c);
 	result[0] = c;
 	result[1] = s;
 	result[2] = MFLOAT_C(0.0);
@@ -3084,10 +3843,9 @@ mfloat_t* mat4_rotation_z(mfloat_t* result, mfloat_t f)
 	return result;
 }
 
-mfloat_t* mat4_rotation_axis(mfloat_t* result, mfloat_t* v0, mfloat_t f)
+MATHC_KERNEL_BODY mfloat_t* mat4_rotation_axis_sincos(mfloat_t* result, mfloat_t* v0, mfloat_t s,
+													  mfloat_t c)
 {
-	mfloat_t c = MCOS(f);
-	mfloat_t s = MSIN(f);
 	mfloat_t one_c = MFLOAT_C(1.0) - c;
 	mfloat_t x = v0[0];
 	mfloat_t y = v0[1];
@@ -3119,6 +3877,14 @@ mfloat_t* mat4_rotation_axis(mfloat_t* result, mfloat_t* v0, mfloat_t f)
 	return result;
 }
 
+mfloat_t* mat4_rotation_axis(mfloat_t* result, mfloat_t* v0, mfloat_t f)
+{
+	mfloat_t s;
+	mfloat_t c;
+	MSINCOS(f, &s, &c);
+	return mat4_rotation_axis_sincos(result, v0, s, c);
+}
+
 mfloat_t* mat4_rotation_quat(mfloat_t* result, mfloat_t* q0)
 {
 	mfloat_t xx = q0[0] * q0[0];
@@ -3233,7 +3999,11 @@ mfloat_t* mat4_scale(mfloat_t* result, mfloat_t* m0, mfloat_t* v0)
 	return result;
 }
 
-mfloat_t* mat4_multiply(mfloat_t* result, mfloat_t* m0, mfloat_t* m1)
+/*
+Kept out of line: inlined into the loop of mat4_multiply_n_scalar(), GCC vectorizes
+the loop across matrices with gathers, which is twice as slow as one call per matrix.
+*/
+MATHC_KERNEL_NOINLINE mfloat_t* mat4_multiply_scalar(mfloat_t* result, mfloat_t* m0, mfloat_t* m1)
 {
 	mfloat_t multiplied[MAT4_SIZE];
 	multiplied[0] = m0[0] * m1[0] + m0[4] * m1[1] + m0[8] * m1[2] + m0[12] * m1[3];
@@ -3271,6 +4041,108 @@ mfloat_t* mat4_multiply(mfloat_t* result, mfloat_t* m0, mfloat_t* m1)
 	return result;
 }
 
+#if defined(MATHC_HAS_SSE)
+/* Multiplies the columns c0 to c3 by m1; every input is loaded before the first store */
+MATHC_TARGET_SSE MATHC_KERNEL_BODY void mat4_multiply_columns_sse(mfloat_t* result, __m128 c0,
+																  __m128 c1, __m128 c2,
+																  __m128 c3, mfloat_t* m1)
+{
+	__m128 multiplied[4];
+	int32_t i;
+	for (i = 0; i < 4; ++i) {
+		__m128 b = _mm_loadu_ps(m1 + i * 4);
+		__m128 r = _mm_mul_ps(c0, _mm_shuffle_ps(b, b, 0x00));
+		r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_shuffle_ps(b, b, 0x55)));
+		r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_shuffle_ps(b, b, 0xAA)));
+		r = _mm_add_ps(r, _mm_mul_ps(c3, _mm_shuffle_ps(b, b, 0xFF)));
+		multiplied[i] = r;
+	}
+	_mm_storeu_ps(result, multiplied[0]);
+	_mm_storeu_ps(result + 4, multiplied[1]);
+	_mm_storeu_ps(result + 8, multiplied[2]);
+	_mm_storeu_ps(result + 12, multiplied[3]);
+}
+
+MATHC_TARGET_SSE MATHC_KERNEL mfloat_t* mat4_multiply_sse(mfloat_t* result, mfloat_t* m0,
+														  mfloat_t* m1)
+{
+	/* Every input is loaded before the first store, so result may alias m0 or m1 */
+	mat4_multiply_columns_sse(result, _mm_loadu_ps(m0), _mm_loadu_ps(m0 + 4),
+							  _mm_loadu_ps(m0 + 8), _mm_loadu_ps(m0 + 12), m1);
+	return result;
+}
+#endif
+
+#if defined(MATHC_HAS_AVX2)
+/* Two result columns per register; every input is loaded before the first store */
+MATHC_TARGET_AVX2 MATHC_KERNEL_BODY void mat4_multiply_columns_avx2(mfloat_t* result, __m256 c0,
+																	__m256 c1, __m256 c2,
+																	__m256 c3, mfloat_t* m1)
+{
+	__m256 b01 = _mm256_loadu_ps(m1);
+	__m256 b23 = _mm256_loadu_ps(m1 + 8);
+	__m256 r01 = _mm256_mul_ps(c0, _mm256_shuffle_ps(b01, b01, 0x00));
+	__m256 r23 = _mm256_mul_ps(c0, _mm256_shuffle_ps(b23, b23, 0x00));
+	r01 = _mm256_add_ps(r01, _mm256_mul_ps(c1, _mm256_shuffle_ps(b01, b01, 0x55)));
+	r23 = _mm256_add_ps(r23, _mm256_mul_ps(c1, _mm256_shuffle_ps(b23, b23, 0x55)));
+	r01 = _mm256_add_ps(r01, _mm256_mul_ps(c2, _mm256_shuffle_ps(b01, b01, 0xAA)));
+	r23 = _mm256_add_ps(r23, _mm256_mul_ps(c2, _mm256_shuffle_ps(b23, b23, 0xAA)));
+	r01 = _mm256_add_ps(r01, _mm256_mul_ps(c3, _mm256_shuffle_ps(b01, b01, 0xFF)));
+	r23 = _mm256_add_ps(r23, _mm256_mul_ps(c3, _mm256_shuffle_ps(b23, b23, 0xFF)));
+	_mm256_storeu_ps(result, r01);
+	_mm256_storeu_ps(result + 8, r23);
+}
+
+MATHC_TARGET_AVX2 MATHC_KERNEL mfloat_t* mat4_multiply_avx2(mfloat_t* result, mfloat_t* m0,
+															mfloat_t* m1)
+{
+	mat4_multiply_columns_avx2(result, _mm256_broadcast_ps((const __m128*)m0),
+							   _mm256_broadcast_ps((const __m128*)(m0 + 4)),
+							   _mm256_broadcast_ps((const __m128*)(m0 + 8)),
+							   _mm256_broadcast_ps((const __m128*)(m0 + 12)), m1);
+	return result;
+}
+#endif
+
+#if defined(MATHC_HAS_AVX512)
+/* All four result columns in one register */
+MATHC_TARGET_AVX512 MATHC_KERNEL_BODY void mat4_multiply_columns_avx512(mfloat_t* result,
+																		__m512 c0, __m512 c1,
+																		__m512 c2, __m512 c3,
+																		mfloat_t* m1)
+{
+	__m512 b = _mm512_loadu_ps(m1);
+	__m512 r = _mm512_mul_ps(c0, _mm512_permute_ps(b, 0x00));
+	r = _mm512_add_ps(r, _mm512_mul_ps(c1, _mm512_permute_ps(b, 0x55)));
+	r = _mm512_add_ps(r, _mm512_mul_ps(c2, _mm512_permute_ps(b, 0xAA)));
+	r = _mm512_add_ps(r, _mm512_mul_ps(c3, _mm512_permute_ps(b, 0xFF)));
+	_mm512_storeu_ps(result, r);
+}
+
+MATHC_TARGET_AVX512 MATHC_KERNEL mfloat_t* mat4_multiply_avx512(mfloat_t* result, mfloat_t* m0,
+																mfloat_t* m1)
+{
+	mat4_multiply_columns_avx512(result, _mm512_broadcast_f32x4(_mm_loadu_ps(m0)),
+								 _mm512_broadcast_f32x4(_mm_loadu_ps(m0 + 4)),
+								 _mm512_broadcast_f32x4(_mm_loadu_ps(m0 + 8)),
+								 _mm512_broadcast_f32x4(_mm_loadu_ps(m0 + 12)), m1);
+	return result;
+}
+#endif
+
+mfloat_t* mat4_multiply(mfloat_t* result, mfloat_t* m0, mfloat_t* m1)
+{
+#if defined(MATHC_USE_DISPATCH)
+	return mathc_dispatch_get()->mat4_multiply(result, m0, m1);
+#elif defined(MATHC_HAS_AVX2)
+	return mat4_multiply_avx2(result, m0, m1);
+#elif defined(MATHC_HAS_SSE)
+	return mat4_multiply_sse(result, m0, m1);
+#else
+	return mat4_multiply_scalar(result, m0, m1);
+#endif
+}
+
 mfloat_t* mat4_multiply_f(mfloat_t* result, mfloat_t* m0, mfloat_t f)
 {
 	result[0] = m0[0] * f;
@@ -3292,7 +4164,7 @@ mfloat_t* mat4_multiply_f(mfloat_t* result, mfloat_t* m0, mfloat_t f)
 	return result;
 }
 
-mfloat_t* mat4_inverse(mfloat_t* result, mfloat_t* m0)
+MATHC_KERNEL mfloat_t* mat4_inverse_scalar(mfloat_t* result, mfloat_t* m0)
 {
 	mfloat_t inverse[MAT4_SIZE];
 	mfloat_t inverted_determinant;
@@ -3365,12 +4237,146 @@ mfloat_t* mat4_inverse(mfloat_t* result, mfloat_t* m0)
 	return result;
 }
 
-mfloat_t* mat4_lerp(mfloat_t* result, mfloat_t* m0, mfloat_t* m1, mfloat_t f)
-{
-	result[0] = m0[0] + (m1[0] - m0[0]) * f;
-	result[1] = m0[1] + (m1[1] - m0[1]) * f;
-	result[2] = m0[2] + (m1[2] - m0[2]) * f;
-	result[3] = m0[3] + (m1[3] - m0[3]) * f;
+#if defined(MATHC_HAS_SSE)
+/*
+Block inverse: the matrix is split into the 2×2 sub-matrices A, B, C and D, each
+held in one register, and the inverse is assembled from their adjugates and
+determinants. Transposing the input transposes the inverse, so the same code
+works on column-major storage.
+*/
+#define MATHC_SHUFFLE(v0, v1, x, y, z, w) _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(w, z, y, x))
+#define MATHC_SWIZZLE(v0, x, y, z, w) MATHC_SHUFFLE(v0, v0, x, y, z, w)
+
+/* 2×2 A * B */
+MATHC_TARGET_SSE MATHC_KERNEL_BODY __m128 mat2_multiply_sse(__m128 a, __m128 b)
+{
+	return _mm_add_ps(_mm_mul_ps(a, MATHC_SWIZZLE(b, 0, 3, 0, 3)),
+					  _mm_mul_ps(MATHC_SWIZZLE(a, 1, 0, 3, 2), MATHC_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+/* 2×2 adjugate(A) * B */
+MATHC_TARGET_SSE MATHC_KERNEL_BODY __m128 mat2_adjugate_multiply_sse(__m128 a, __m128 b)
+{
+	return _mm_sub_ps(_mm_mul_ps(MATHC_SWIZZLE(a, 3, 3, 0, 0), b),
+					  _mm_mul_ps(MATHC_SWIZZLE(a, 1, 1, 2, 2), MATHC_SWIZZLE(b, 2, 3, 0, 1)));
+}
+
+/* 2×2 A * adjugate(B) */
+MATHC_TARGET_SSE MATHC_KERNEL_BODY __m128 mat2_multiply_adjugate_sse(__m128 a, __m128 b)
+{
+	return _mm_sub_ps(_mm_mul_ps(a, MATHC_SWIZZLE(b, 3, 0, 3, 0)),
+					  _mm_mul_ps(MATHC_SWIZZLE(a, 1, 0, 3, 2), MATHC_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+MATHC_TARGET_SSE MATHC_KERNEL mfloat_t* mat4_inverse_sse(mfloat_t* result, mfloat_t* m0)
+{
+	__m128 c0 = _mm_loadu_ps(m0);
+	__m128 c1 = _mm_loadu_ps(m0 + 4);
+	__m128 c2 = _mm_loadu_ps(m0 + 8);
+	__m128 c3 = _mm_loadu_ps(m0 + 12);
+	__m128 a = _mm_movelh_ps(c0, c1);
+	__m128 b = _mm_movehl_ps(c1, c0);
+	__m128 c = _mm_movelh_ps(c2, c3);
+	__m128 d = _mm_movehl_ps(c3, c2);
+	/* Determinants of A, B, C and D */
+	__m128 det_sub = _mm_sub_ps(
+		_mm_mul_ps(MATHC_SHUFFLE(c0, c2, 0, 2, 0, 2), MATHC_SHUFFLE(c1, c3, 1, 3, 1, 3)),
+		_mm_mul_ps(MATHC_SHUFFLE(c0, c2, 1, 3, 1, 3), MATHC_SHUFFLE(c1, c3, 0, 2, 0, 2)));
+	__m128 det_a = MATHC_SWIZZLE(det_sub, 0, 0, 0, 0);
+	__m128 det_b = MATHC_SWIZZLE(det_sub, 1, 1, 1, 1);
+	__m128 det_c = MATHC_SWIZZLE(det_sub, 2, 2, 2, 2);
+	__m128 det_d = MATHC_SWIZZLE(det_sub, 3, 3, 3, 3);
+	__m128 d_c = mat2_adjugate_multiply_sse(d, c);
+	__m128 a_b = mat2_adjugate_multiply_sse(a, b);
+	__m128 x = _mm_sub_ps(_mm_mul_ps(det_d, a), mat2_multiply_sse(b, d_c));
+	__m128 w = _mm_sub_ps(_mm_mul_ps(det_a, d), mat2_multiply_sse(c, a_b));
+	__m128 y = _mm_sub_ps(_mm_mul_ps(det_b, c), mat2_multiply_adjugate_sse(d, a_b));
+	__m128 z = _mm_sub_ps(_mm_mul_ps(det_c, b), mat2_multiply_adjugate_sse(a, d_c));
+	__m128 det = _mm_add_ps(_mm_mul_ps(det_a, det_d), _mm_mul_ps(det_b, det_c));
+	/* Subtract trace((A#B)(D#C)) */
+	__m128 trace = _mm_mul_ps(a_b, MATHC_SWIZZLE(d_c, 0, 2, 1, 3));
+	trace = _mm_add_ps(trace, MATHC_SWIZZLE(trace, 2, 3, 0, 1));
+	trace = _mm_add_ps(trace, MATHC_SWIZZLE(trace, 1, 0, 3, 2));
+	det = _mm_sub_ps(det, trace);
+	det = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+	x = _mm_mul_ps(x, det);
+	y = _mm_mul_ps(y, det);
+	z = _mm_mul_ps(z, det);
+	w = _mm_mul_ps(w, det);
+	_mm_storeu_ps(result, MATHC_SHUFFLE(x, y, 3, 1, 3, 1));
+	_mm_storeu_ps(result + 4, MATHC_SHUFFLE(x, y, 2, 0, 2, 0));
+	_mm_storeu_ps(result + 8, MATHC_SHUFFLE(z, w, 3, 1, 3, 1));
+	_mm_storeu_ps(result + 12, MATHC_SHUFFLE(z, w, 2, 0, 2, 0));
+	return result;
+}
+#endif
+
+mfloat_t* mat4_inverse(mfloat_t* result, mfloat_t* m0)
+{
+#if defined(MATHC_USE_DISPATCH)
+	return mathc_dispatch_get()->mat4_inverse(result, m0);
+#elif defined(MATHC_HAS_SSE)
+	return mat4_inverse_sse(result, m0);
+#else
+	return mat4_inverse_scalar(result, m0);
+#endif
+}
+
+#if !defined(NDEBUG) || defined(MATHC_USE_STREAM_FUNCTIONS)
+static bool mat4_is_affine(mfloat_t* m0)
+{
+	return m0[3] == MFLOAT_C(0.0) && m0[7] == MFLOAT_C(0.0) && m0[11] == MFLOAT_C(0.0)
+		&& m0[15] == MFLOAT_C(1.0);
+}
+#endif
+
+#if !defined(NDEBUG)
+/* Orthonormal rotation columns, within the error that builds up when composing rotations */
+static bool mat4_is_rigid(mfloat_t* m0)
+{
+	mfloat_t epsilon = MFLOAT_C(1e-3);
+	int32_t i;
+	int32_t j;
+	if (!mat4_is_affine(m0)) {
+		return false;
+	}
+	for (i = 0; i < 3; ++i) {
+		for (j = 0; j < 3; ++j) {
+			mfloat_t d = m0[i * 4] * m0[j * 4] + m0[i * 4 + 1] * m0[j * 4 + 1] +
+						 m0[i * 4 + 2] * m0[j * 4 + 2];
+			if (MFABS(d - (i == j ? MFLOAT_C(1.0) : MFLOAT_C(0.0))) > epsilon) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+#endif
+
+mfloat_t* mat4_inverse_rigid(mfloat_t* result, mfloat_t* m0)
+{
+	mfloat_t a[AFFINE_SIZE];
+	assert(mat4_is_rigid(m0));
+	affine_from_mat4(a, m0);
+	affine_inverse_rigid(a, a);
+	return mat4_from_affine(result, a);
+}
+
+mfloat_t* mat4_inverse_affine(mfloat_t* result, mfloat_t* m0)
+{
+	mfloat_t a[AFFINE_SIZE];
+	assert(mat4_is_affine(m0));
+	affine_from_mat4(a, m0);
+	affine_inverse(a, a);
+	return mat4_from_affine(result, a);
+}
+
+mfloat_t* mat4_lerp(mfloat_t* result, mfloat_t* m0, mfloat_t* m1, mfloat_t f)
+{
+	result[0] = m0[0] + (m1[0] - m0[0]) * f;
+	result[1] = m0[1] + (m1[1] - m0[1]) * f;
+	result[2] = m0[2] + (m1[2] - m0[2]) * f;
+	result[3] = m0[3] + (m1[3] - m0[3]) * f;
 	result[4] = m0[4] + (m1[4] - m0[4]) * f;
 	result[5] = m0[5] + (m1[5] - m0[5]) * f;
 	result[6] = m0[6] + (m1[6] - m0[6]) * f;
@@ -3465,8 +4471,13 @@ mfloat_t* mat4_perspective(mfloat_t* result, mfloat_t fov_y, mfloat_t aspect, mf
 mfloat_t* mat4_perspective_fov(mfloat_t* result, mfloat_t fov, mfloat_t w, mfloat_t h, mfloat_t n,
 							   mfloat_t f)
 {
-	mfloat_t h2 = MCOS(fov * MFLOAT_C(0.5)) / MSIN(fov * MFLOAT_C(0.5));
-	mfloat_t w2 = h2 * h / w;
+	mfloat_t s;
+	mfloat_t c;
+	mfloat_t h2;
+	mfloat_t w2;
+	MSINCOS(fov * MFLOAT_C(0.5), &s, &c);
+	h2 = c / s;
+	w2 = h2 * h / w;
 	result[0] = w2;
 	result[1] = MFLOAT_C(0.0);
 	result[2] = MFLOAT_C(0.0);
@@ -3486,30 +4497,3210 @@ mfloat_t* mat4_perspective_fov(mfloat_t* result, mfloat_t fov, mfloat_t w, mfloa
 	return result;
 }
 
-mfloat_t* mat4_perspective_infinite(mfloat_t* result, mfloat_t fov_y, mfloat_t aspect, mfloat_t n)
+mfloat_t* mat4_perspective_infinite(mfloat_t* result, mfloat_t fov_y, mfloat_t aspect, mfloat_t n)
+{
+	mfloat_t range = MTAN(fov_y * MFLOAT_C(0.5)) * n;
+	mfloat_t left = -range * aspect;
+	mfloat_t right = range * aspect;
+	mfloat_t top = range;
+	mfloat_t bottom = -range;
+	result[0] = MFLOAT_C(2.0) * n / (right - left);
+	result[1] = MFLOAT_C(0.0);
+	result[2] = MFLOAT_C(0.0);
+	result[3] = MFLOAT_C(0.0);
+	result[4] = MFLOAT_C(0.0);
+	result[5] = MFLOAT_C(2.0) * n / (top - bottom);
+	result[6] = MFLOAT_C(0.0);
+	result[7] = MFLOAT_C(0.0);
+	result[8] = MFLOAT_C(0.0);
+	result[9] = MFLOAT_C(0.0);
+	result[10] = -MFLOAT_C(1.0);
+	result[11] = -MFLOAT_C(1.0);
+	result[12] = MFLOAT_C(0.0);
+	result[13] = MFLOAT_C(0.0);
+	result[14] = -MFLOAT_C(2.0) * n;
+	result[15] = MFLOAT_C(0.0);
+	return result;
+}
+
+mfloat_t* affine_identity(mfloat_t* result)
+{
+	result[0] = MFLOAT_C(1.0);
+	result[1] = MFLOAT_C(0.0);
+	result[2] = MFLOAT_C(0.0);
+	result[3] = MFLOAT_C(0.0);
+	result[4] = MFLOAT_C(1.0);
+	result[5] = MFLOAT_C(0.0);
+	result[6] = MFLOAT_C(0.0);
+	result[7] = MFLOAT_C(0.0);
+	result[8] = MFLOAT_C(1.0);
+	result[9] = MFLOAT_C(0.0);
+	result[10] = MFLOAT_C(0.0);
+	result[11] = MFLOAT_C(0.0);
+	return result;
+}
+
+mfloat_t* affine_from_mat4(mfloat_t* result, mfloat_t* m0)
+{
+	result[0] = m0[0];
+	result[1] = m0[1];
+	result[2] = m0[2];
+	result[3] = m0[4];
+	result[4] = m0[5];
+	result[5] = m0[6];
+	result[6] = m0[8];
+	result[7] = m0[9];
+	result[8] = m0[10];
+	result[9] = m0[12];
+	result[10] = m0[13];
+	result[11] = m0[14];
+	return result;
+}
+
+mfloat_t* mat4_from_affine(mfloat_t* result, mfloat_t* a0)
+{
+	result[0] = a0[0];
+	result[1] = a0[1];
+	result[2] = a0[2];
+	result[3] = MFLOAT_C(0.0);
+	result[4] = a0[3];
+	result[5] = a0[4];
+	result[6] = a0[5];
+	result[7] = MFLOAT_C(0.0);
+	result[8] = a0[6];
+	result[9] = a0[7];
+	result[10] = a0[8];
+	result[11] = MFLOAT_C(0.0);
+	result[12] = a0[9];
+	result[13] = a0[10];
+	result[14] = a0[11];
+	result[15] = MFLOAT_C(1.0);
+	return result;
+}
+
+MATHC_KERNEL mfloat_t* affine_multiply_scalar(mfloat_t* result, mfloat_t* a0, mfloat_t* a1)
+{
+	/* Both inputs are copied before the first store, so result may alias a0 or a1 */
+	mfloat_t m[AFFINE_SIZE];
+	mfloat_t b[AFFINE_SIZE];
+	int32_t i;
+	for (i = 0; i < AFFINE_SIZE; ++i) {
+		m[i] = a0[i];
+		b[i] = a1[i];
+	}
+	for (i = 0; i < 4; ++i) {
+		result[i * 3] = m[0] * b[i * 3] + m[3] * b[i * 3 + 1] + m[6] * b[i * 3 + 2];
+		result[i * 3 + 1] = m[1] * b[i * 3] + m[4] * b[i * 3 + 1] + m[7] * b[i * 3 + 2];
+		result[i * 3 + 2] = m[2] * b[i * 3] + m[5] * b[i * 3 + 1] + m[8] * b[i * 3 + 2];
+	}
+	result[9] += m[9];
+	result[10] += m[10];
+	result[11] += m[11];
+	return result;
+}
+
+#if defined(MATHC_HAS_SSE)
+MATHC_TARGET_SSE MATHC_KERNEL mfloat_t* affine_multiply_sse(mfloat_t* result, mfloat_t* a0,
+															mfloat_t* a1)
+{
+	/* Columns start 3 values apart, so each load also reads a value that a later store rewrites */
+	__m128 c0 = _mm_loadu_ps(a0);
+	__m128 c1 = _mm_loadu_ps(a0 + 3);
+	__m128 c2 = _mm_loadu_ps(a0 + 6);
+	__m128 c3 = _mm_loadu_ps(a0 + 8);
+	__m128 b[4];
+	__m128 multiplied[4];
+	int32_t i;
+	b[0] = _mm_loadu_ps(a1);
+	b[1] = _mm_loadu_ps(a1 + 3);
+	b[2] = _mm_loadu_ps(a1 + 6);
+	b[3] = _mm_loadu_ps(a1 + 8);
+	/* The translation is loaded from index 8 to stay inside the matrix, then shifted down */
+	c3 = _mm_shuffle_ps(c3, c3, _MM_SHUFFLE(3, 3, 2, 1));
+	b[3] = _mm_shuffle_ps(b[3], b[3], _MM_SHUFFLE(3, 3, 2, 1));
+	for (i = 0; i < 4; ++i) {
+		__m128 r = _mm_mul_ps(c0, _mm_shuffle_ps(b[i], b[i], 0x00));
+		r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_shuffle_ps(b[i], b[i], 0x55)));
+		r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_shuffle_ps(b[i], b[i], 0xAA)));
+		multiplied[i] = r;
+	}
+	multiplied[3] = _mm_add_ps(multiplied[3], c3);
+	/* Shifted back up behind the last value of the third column, to be stored at index 8 */
+	multiplied[3] = _mm_shuffle_ps(_mm_shuffle_ps(multiplied[2], multiplied[3],
+												  _MM_SHUFFLE(0, 0, 2, 2)),
+								   multiplied[3], _MM_SHUFFLE(2, 1, 2, 0));
+	/* Every input is loaded before the first store, so result may alias a0 or a1 */
+	_mm_storeu_ps(result, multiplied[0]);
+	_mm_storeu_ps(result + 3, multiplied[1]);
+	_mm_storeu_ps(result + 6, multiplied[2]);
+	_mm_storeu_ps(result + 8, multiplied[3]);
+	return result;
+}
+#endif
+
+mfloat_t* affine_multiply(mfloat_t* result, mfloat_t* a0, mfloat_t* a1)
+{
+#if defined(MATHC_USE_DISPATCH)
+	return mathc_dispatch_get()->affine_multiply(result, a0, a1);
+#elif defined(MATHC_HAS_SSE)
+	return affine_multiply_sse(result, a0, a1);
+#else
+	return affine_multiply_scalar(result, a0, a1);
+#endif
+}
+
+mfloat_t* affine_inverse(mfloat_t* result, mfloat_t* a0)
+{
+	mfloat_t inverse[AFFINE_SIZE];
+	mfloat_t inv_det;
+	inverse[0] = a0[4] * a0[8] - a0[5] * a0[7];
+	inverse[1] = a0[2] * a0[7] - a0[1] * a0[8];
+	inverse[2] = a0[1] * a0[5] - a0[2] * a0[4];
+	inverse[3] = a0[5] * a0[6] - a0[3] * a0[8];
+	inverse[4] = a0[0] * a0[8] - a0[2] * a0[6];
+	inverse[5] = a0[2] * a0[3] - a0[0] * a0[5];
+	inverse[6] = a0[3] * a0[7] - a0[4] * a0[6];
+	inverse[7] = a0[1] * a0[6] - a0[0] * a0[7];
+	inverse[8] = a0[0] * a0[4] - a0[1] * a0[3];
+	inv_det = MFLOAT_C(1.0) / (a0[0] * inverse[0] + a0[3] * inverse[1] + a0[6] * inverse[2]);
+	inverse[0] = inverse[0] * inv_det;
+	inverse[1] = inverse[1] * inv_det;
+	inverse[2] = inverse[2] * inv_det;
+	inverse[3] = inverse[3] * inv_det;
+	inverse[4] = inverse[4] * inv_det;
+	inverse[5] = inverse[5] * inv_det;
+	inverse[6] = inverse[6] * inv_det;
+	inverse[7] = inverse[7] * inv_det;
+	inverse[8] = inverse[8] * inv_det;
+	inverse[9] = -(inverse[0] * a0[9] + inverse[3] * a0[10] + inverse[6] * a0[11]);
+	inverse[10] = -(inverse[1] * a0[9] + inverse[4] * a0[10] + inverse[7] * a0[11]);
+	inverse[11] = -(inverse[2] * a0[9] + inverse[5] * a0[10] + inverse[8] * a0[11]);
+	result[0] = inverse[0];
+	result[1] = inverse[1];
+	result[2] = inverse[2];
+	result[3] = inverse[3];
+	result[4] = inverse[4];
+	result[5] = inverse[5];
+	result[6] = inverse[6];
+	result[7] = inverse[7];
+	result[8] = inverse[8];
+	result[9] = inverse[9];
+	result[10] = inverse[10];
+	result[11] = inverse[11];
+	return result;
+}
+
+mfloat_t* affine_inverse_rigid(mfloat_t* result, mfloat_t* a0)
+{
+	mfloat_t inverse[AFFINE_SIZE];
+	inverse[0] = a0[0];
+	inverse[1] = a0[3];
+	inverse[2] = a0[6];
+	inverse[3] = a0[1];
+	inverse[4] = a0[4];
+	inverse[5] = a0[7];
+	inverse[6] = a0[2];
+	inverse[7] = a0[5];
+	inverse[8] = a0[8];
+	inverse[9] = -(a0[0] * a0[9] + a0[1] * a0[10] + a0[2] * a0[11]);
+	inverse[10] = -(a0[3] * a0[9] + a0[4] * a0[10] + a0[5] * a0[11]);
+	inverse[11] = -(a0[6] * a0[9] + a0[7] * a0[10] + a0[8] * a0[11]);
+	result[0] = inverse[0];
+	result[1] = inverse[1];
+	result[2] = inverse[2];
+	result[3] = inverse[3];
+	result[4] = inverse[4];
+	result[5] = inverse[5];
+	result[6] = inverse[6];
+	result[7] = inverse[7];
+	result[8] = inverse[8];
+	result[9] = inverse[9];
+	result[10] = inverse[10];
+	result[11] = inverse[11];
+	return result;
+}
+
+mfloat_t* affine_transform_point(mfloat_t* result, mfloat_t* a0, mfloat_t* v0)
+{
+	mfloat_t x = v0[0];
+	mfloat_t y = v0[1];
+	mfloat_t z = v0[2];
+	result[0] = a0[0] * x + a0[3] * y + a0[6] * z + a0[9];
+	result[1] = a0[1] * x + a0[4] * y + a0[7] * z + a0[10];
+	result[2] = a0[2] * x + a0[5] * y + a0[8] * z + a0[11];
+	return result;
+}
+
+mfloat_t* affine_transform_direction(mfloat_t* result, mfloat_t* a0, mfloat_t* v0)
+{
+	mfloat_t x = v0[0];
+	mfloat_t y = v0[1];
+	mfloat_t z = v0[2];
+	result[0] = a0[0] * x + a0[3] * y + a0[6] * z;
+	result[1] = a0[1] * x + a0[4] * y + a0[7] * z;
+	result[2] = a0[2] * x + a0[5] * y + a0[8] * z;
+	return result;
+}
+
+mfloat_t* dualquat_identity(mfloat_t* result)
+{
+	result[0] = MFLOAT_C(0.0);
+	result[1] = MFLOAT_C(0.0);
+	result[2] = MFLOAT_C(0.0);
+	result[3] = MFLOAT_C(1.0);
+	result[4] = MFLOAT_C(0.0);
+	result[5] = MFLOAT_C(0.0);
+	result[6] = MFLOAT_C(0.0);
+	result[7] = MFLOAT_C(0.0);
+	return result;
+}
+
+mfloat_t* dualquat_from_quat_vec3(mfloat_t* result, mfloat_t* q0, mfloat_t* v0)
+{
+	mfloat_t real[QUAT_SIZE];
+	mfloat_t t[QUAT_SIZE];
+	real[0] = q0[0];
+	real[1] = q0[1];
+	real[2] = q0[2];
+	real[3] = q0[3];
+	t[0] = v0[0] * MFLOAT_C(0.5);
+	t[1] = v0[1] * MFLOAT_C(0.5);
+	t[2] = v0[2] * MFLOAT_C(0.5);
+	t[3] = MFLOAT_C(0.0);
+	quat_multiply(result + 4, t, real);
+	result[0] = real[0];
+	result[1] = real[1];
+	result[2] = real[2];
+	result[3] = real[3];
+	return result;
+}
+
+mfloat_t* quat_from_dualquat(mfloat_t* result, mfloat_t* dq0)
+{
+	result[0] = dq0[0];
+	result[1] = dq0[1];
+	result[2] = dq0[2];
+	result[3] = dq0[3];
+	return result;
+}
+
+mfloat_t* vec3_from_dualquat(mfloat_t* result, mfloat_t* dq0)
+{
+	/* The vector part of 2 * dual * conjugate(real) */
+	mfloat_t conjugate[QUAT_SIZE];
+	mfloat_t t[QUAT_SIZE];
+	quat_conjugate(conjugate, dq0);
+	quat_multiply(t, dq0 + 4, conjugate);
+	result[0] = t[0] * MFLOAT_C(2.0);
+	result[1] = t[1] * MFLOAT_C(2.0);
+	result[2] = t[2] * MFLOAT_C(2.0);
+	return result;
+}
+
+mfloat_t* dualquat_from_mat4(mfloat_t* result, mfloat_t* m0)
+{
+	mfloat_t q[QUAT_SIZE];
+	mfloat_t v[VEC3_SIZE];
+	/* quat_from_mat4() reads the rotation transposed from mat4_rotation_quat() */
+	quat_from_mat4(q, m0);
+	quat_conjugate(q, q);
+	v[0] = m0[12];
+	v[1] = m0[13];
+	v[2] = m0[14];
+	return dualquat_from_quat_vec3(result, q, v);
+}
+
+mfloat_t* mat4_from_dualquat(mfloat_t* result, mfloat_t* dq0)
+{
+	mfloat_t q[QUAT_SIZE];
+	mfloat_t v[VEC3_SIZE];
+	quat_from_dualquat(q, dq0);
+	vec3_from_dualquat(v, dq0);
+	mat4_rotation_quat(result, q);
+	result[12] = v[0];
+	result[13] = v[1];
+	result[14] = v[2];
+	return result;
+}
+
+mfloat_t* dualquat_multiply(mfloat_t* result, mfloat_t* dq0, mfloat_t* dq1)
+{
+	/* (r0 + e d0) * (r1 + e d1) = r0 * r1 + e (r0 * d1 + d0 * r1) */
+	mfloat_t real[QUAT_SIZE];
+	mfloat_t dual0[QUAT_SIZE];
+	mfloat_t dual1[QUAT_SIZE];
+	quat_multiply(real, dq0, dq1);
+	quat_multiply(dual0, dq0, dq1 + 4);
+	quat_multiply(dual1, dq0 + 4, dq1);
+	result[0] = real[0];
+	result[1] = real[1];
+	result[2] = real[2];
+	result[3] = real[3];
+	result[4] = dual0[0] + dual1[0];
+	result[5] = dual0[1] + dual1[1];
+	result[6] = dual0[2] + dual1[2];
+	result[7] = dual0[3] + dual1[3];
+	return result;
+}
+
+mfloat_t* dualquat_normalize(mfloat_t* result, mfloat_t* dq0)
+{
+	mfloat_t l = MFLOAT_C(1.0) / quat_length(dq0);
+	mfloat_t r[QUAT_SIZE];
+	mfloat_t d[QUAT_SIZE];
+	mfloat_t f = MFLOAT_C(0.0);
+	int32_t i;
+	for (i = 0; i < QUAT_SIZE; ++i) {
+		r[i] = dq0[i] * l;
+		d[i] = dq0[i + 4] * l;
+		f += r[i] * d[i];
+	}
+	for (i = 0; i < QUAT_SIZE; ++i) {
+		result[i] = r[i];
+		result[i + 4] = d[i] - r[i] * f;
+	}
+	return result;
+}
+
+mfloat_t* dualquat_transform_point(mfloat_t* result, mfloat_t* dq0, mfloat_t* v0)
+{
+	mfloat_t t[VEC3_SIZE];
+	vec3_from_dualquat(t, dq0);
+	quat_rotate_vec3(result, dq0, v0);
+	result[0] += t[0];
+	result[1] += t[1];
+	result[2] += t[2];
+	return result;
+}
+
+mfloat_t* transform_identity(mfloat_t* result)
+{
+	result[0] = MFLOAT_C(0.0);
+	result[1] = MFLOAT_C(0.0);
+	result[2] = MFLOAT_C(0.0);
+	result[3] = MFLOAT_C(0.0);
+	result[4] = MFLOAT_C(0.0);
+	result[5] = MFLOAT_C(0.0);
+	result[6] = MFLOAT_C(1.0);
+	result[7] = MFLOAT_C(1.0);
+	result[8] = MFLOAT_C(1.0);
+	result[9] = MFLOAT_C(1.0);
+	return result;
+}
+
+mfloat_t* transform_from_trs(mfloat_t* result, mfloat_t* v0, mfloat_t* q0, mfloat_t* v1)
+{
+	result[0] = v0[0];
+	result[1] = v0[1];
+	result[2] = v0[2];
+	result[3] = q0[0];
+	result[4] = q0[1];
+	result[5] = q0[2];
+	result[6] = q0[3];
+	result[7] = v1[0];
+	result[8] = v1[1];
+	result[9] = v1[2];
+	return result;
+}
+
+mfloat_t* transform_multiply(mfloat_t* result, mfloat_t* t0, mfloat_t* t1)
+{
+	mfloat_t position[VEC3_SIZE];
+	mfloat_t rotation[QUAT_SIZE];
+	position[0] = t0[7] * t1[0];
+	position[1] = t0[8] * t1[1];
+	position[2] = t0[9] * t1[2];
+	quat_rotate_vec3(position, t0 + 3, position);
+	quat_multiply(rotation, t0 + 3, t1 + 3);
+	result[0] = t0[0] + position[0];
+	result[1] = t0[1] + position[1];
+	result[2] = t0[2] + position[2];
+	result[3] = rotation[0];
+	result[4] = rotation[1];
+	result[5] = rotation[2];
+	result[6] = rotation[3];
+	result[7] = t0[7] * t1[7];
+	result[8] = t0[8] * t1[8];
+	result[9] = t0[9] * t1[9];
+	return result;
+}
+
+mfloat_t* transform_inverse(mfloat_t* result, mfloat_t* t0)
+{
+	/* The position is -p rotated back and scaled by the inverse scale */
+	mfloat_t position[VEC3_SIZE];
+	mfloat_t rotation[QUAT_SIZE];
+	quat_conjugate(rotation, t0 + 3);
+	position[0] = -t0[0];
+	position[1] = -t0[1];
+	position[2] = -t0[2];
+	quat_rotate_vec3(position, rotation, position);
+	result[7] = MFLOAT_C(1.0) / t0[7];
+	result[8] = MFLOAT_C(1.0) / t0[8];
+	result[9] = MFLOAT_C(1.0) / t0[9];
+	result[0] = position[0] * result[7];
+	result[1] = position[1] * result[8];
+	result[2] = position[2] * result[9];
+	result[3] = rotation[0];
+	result[4] = rotation[1];
+	result[5] = rotation[2];
+	result[6] = rotation[3];
+	return result;
+}
+
+mfloat_t* transform_transform_point(mfloat_t* result, mfloat_t* t0, mfloat_t* v0)
+{
+	result[0] = v0[0] * t0[7];
+	result[1] = v0[1] * t0[8];
+	result[2] = v0[2] * t0[9];
+	quat_rotate_vec3(result, t0 + 3, result);
+	result[0] += t0[0];
+	result[1] += t0[1];
+	result[2] += t0[2];
+	return result;
+}
+
+/* The columns of the rotation of t0 scaled by its scale, followed by its position */
+MATHC_KERNEL_BODY void transform_columns(mfloat_t* c0, mfloat_t* c1, mfloat_t* c2, mfloat_t* c3,
+										 mfloat_t* t0)
+{
+	mfloat_t xx = t0[3] * t0[3];
+	mfloat_t yy = t0[4] * t0[4];
+	mfloat_t zz = t0[5] * t0[5];
+	mfloat_t xy = t0[3] * t0[4];
+	mfloat_t zw = t0[5] * t0[6];
+	mfloat_t xz = t0[3] * t0[5];
+	mfloat_t yw = t0[4] * t0[6];
+	mfloat_t yz = t0[4] * t0[5];
+	mfloat_t xw = t0[3] * t0[6];
+	c0[0] = (MFLOAT_C(1.0) - MFLOAT_C(2.0) * (yy + zz)) * t0[7];
+	c0[1] = MFLOAT_C(2.0) * (xy + zw) * t0[7];
+	c0[2] = MFLOAT_C(2.0) * (xz - yw) * t0[7];
+	c1[0] = MFLOAT_C(2.0) * (xy - zw) * t0[8];
+	c1[1] = (MFLOAT_C(1.0) - MFLOAT_C(2.0) * (xx + zz)) * t0[8];
+	c1[2] = MFLOAT_C(2.0) * (yz + xw) * t0[8];
+	c2[0] = MFLOAT_C(2.0) * (xz + yw) * t0[9];
+	c2[1] = MFLOAT_C(2.0) * (yz - xw) * t0[9];
+	c2[2] = (MFLOAT_C(1.0) - MFLOAT_C(2.0) * (xx + yy)) * t0[9];
+	c3[0] = t0[0];
+	c3[1] = t0[1];
+	c3[2] = t0[2];
+}
+
+mfloat_t* mat4_from_transform(mfloat_t* result, mfloat_t* t0)
+{
+	transform_columns(result, result + 4, result + 8, result + 12, t0);
+	result[3] = MFLOAT_C(0.0);
+	result[7] = MFLOAT_C(0.0);
+	result[11] = MFLOAT_C(0.0);
+	result[15] = MFLOAT_C(1.0);
+	return result;
+}
+
+mfloat_t* affine_from_transform(mfloat_t* result, mfloat_t* t0)
+{
+	transform_columns(result, result + 3, result + 6, result + 9, t0);
+	return result;
+}
+
+/*
+Each plane adds a row of the matrix to its last row or subtracts it, except the
+near plane of a depth from 0 to 1, which is the depth row alone. `near_w` is the
+weight of the last row in the near plane, 1 or 0.
+*/
+static mfloat_t* frustum_from_rows(mfloat_t* result, mfloat_t* m0, mfloat_t near_w)
+{
+	mfloat_t planes[FRUSTUM_SIZE];
+	int32_t i;
+	for (i = 0; i < 4; ++i) {
+		mfloat_t r0 = m0[i * 4];
+		mfloat_t r1 = m0[i * 4 + 1];
+		mfloat_t r2 = m0[i * 4 + 2];
+		mfloat_t r3 = m0[i * 4 + 3];
+		planes[i] = r3 + r0;
+		planes[4 + i] = r3 - r0;
+		planes[8 + i] = r3 + r1;
+		planes[12 + i] = r3 - r1;
+		planes[16 + i] = near_w * r3 + r2;
+		planes[20 + i] = r3 - r2;
+	}
+	for (i = 0; i < FRUSTUM_SIZE; i += 4) {
+		mfloat_t l = MSQRT(planes[i] * planes[i] + planes[i + 1] * planes[i + 1]
+						   + planes[i + 2] * planes[i + 2]);
+		/* The far plane of an infinite projection has no normal, and contains everything */
+		if (l > MFLOAT_C(0.0)) {
+			l = MFLOAT_C(1.0) / l;
+		} else {
+			l = MFLOAT_C(1.0);
+		}
+		result[i] = planes[i] * l;
+		result[i + 1] = planes[i + 1] * l;
+		result[i + 2] = planes[i + 2] * l;
+		result[i + 3] = planes[i + 3] * l;
+	}
+	return result;
+}
+
+mfloat_t* frustum_from_mat4(mfloat_t* result, mfloat_t* m0)
+{
+	return frustum_from_rows(result, m0, MFLOAT_C(1.0));
+}
+
+mfloat_t* frustum_from_mat4_zo(mfloat_t* result, mfloat_t* m0)
+{
+	return frustum_from_rows(result, m0, MFLOAT_C(0.0));
+}
+#endif
+
+#if defined(MATHC_USE_FLOATING_POINT) && defined(MATHC_USE_EASING_FUNCTIONS)
+/*
+Lookups into an easing table, shared by the scalar and stream functions. `last`
+is the index of the last interval, the table size minus 2. The position is
+clamped so that any factor, NaN included, reads inside the table.
+*/
+MATHC_KERNEL_BODY mfloat_t mathc_easing_table_position(int last, mfloat_t f, int* i)
+{
+	mfloat_t end = (mfloat_t)(last + 1);
+	mfloat_t x = f * end;
+	x = x > MFLOAT_C(0.0) ? x : MFLOAT_C(0.0);
+	x = x < end ? x : end;
+	*i = (int)x;
+	*i = *i < last ? *i : last;
+	return x - (mfloat_t)*i;
+}
+
+MATHC_KERNEL_BODY mfloat_t mathc_easing_table_linear_body(mfloat_t* table, int last, mfloat_t f)
+{
+	int i;
+	mfloat_t t = mathc_easing_table_position(last, f, &i);
+	return table[i] + (table[i + 1] - table[i]) * t;
+}
+
+/* Catmull-Rom spline, with the missing neighbour of the end intervals extrapolated by a parabola */
+MATHC_KERNEL_BODY mfloat_t mathc_easing_table_cubic_body(mfloat_t* table, int last, mfloat_t f)
+{
+	int i;
+	mfloat_t t = mathc_easing_table_position(last, f, &i);
+	mfloat_t p1 = table[i];
+	mfloat_t p2 = table[i + 1];
+	mfloat_t a = table[i > 0 ? i - 1 : 0];
+	mfloat_t d = table[i < last ? i + 2 : last + 1];
+	mfloat_t p0 = i > 0 ? a : MFLOAT_C(3.0) * (p1 - p2) + d;
+	mfloat_t p3 = i < last ? d : MFLOAT_C(3.0) * (p2 - p1) + a;
+	return p1 + MFLOAT_C(0.5) * t *
+					(p2 - p0 +
+					 t * (MFLOAT_C(2.0) * p0 - MFLOAT_C(5.0) * p1 + MFLOAT_C(4.0) * p2 - p3 +
+						  t * (MFLOAT_C(3.0) * (p1 - p2) + p3 - p0)));
+}
+
+/*
+The easing curves, shared by the scalar functions and mathc_ease_n(). Both sides
+of each piecewise curve are computed and the result is chosen with
+mathc_select(), so the loops over them vectorize.
+*/
+MATHC_KERNEL_BODY mfloat_t quadratic_ease_out_body(mfloat_t f)
+{
+	return -f * (f - MFLOAT_C(2.0));
+}
+
+MATHC_KERNEL_BODY mfloat_t quadratic_ease_in_body(mfloat_t f)
+{
+	return f * f;
+}
+
+MATHC_KERNEL_BODY mfloat_t quadratic_ease_in_out_body(mfloat_t f)
+{
+	return mathc_select(f < MFLOAT_C(0.5), MFLOAT_C(2.0) * f * f,
+						-MFLOAT_C(2.0) * f * f + MFLOAT_C(4.0) * f - MFLOAT_C(1.0));
+}
+
+MATHC_KERNEL_BODY mfloat_t cubic_ease_out_body(mfloat_t f)
+{
+	mfloat_t a = f - MFLOAT_C(1.0);
+	return a * a * a + MFLOAT_C(1.0);
+}
+
+MATHC_KERNEL_BODY mfloat_t cubic_ease_in_body(mfloat_t f)
+{
+	return f * f * f;
+}
+
+MATHC_KERNEL_BODY mfloat_t cubic_ease_in_out_body(mfloat_t f)
+{
+	mfloat_t a = MFLOAT_C(2.0) * f - MFLOAT_C(2.0);
+	return mathc_select(f < MFLOAT_C(0.5), MFLOAT_C(4.0) * f * f * f,
+						MFLOAT_C(0.5) * a * a * a + MFLOAT_C(1.0));
+}
+
+MATHC_KERNEL_BODY mfloat_t quartic_ease_out_body(mfloat_t f)
+{
+	mfloat_t a = f - MFLOAT_C(1.0);
+	return a * a * a * (MFLOAT_C(1.0) - f) + MFLOAT_C(1.0);
+}
+
+MATHC_KERNEL_BODY mfloat_t quartic_ease_in_body(mfloat_t f)
+{
+	return f * f * f * f;
+}
+
+MATHC_KERNEL_BODY mfloat_t quartic_ease_in_out_body(mfloat_t f)
+{
+	mfloat_t a = f - MFLOAT_C(1.0);
+	return mathc_select(f < MFLOAT_C(0.5), MFLOAT_C(8.0) * f * f * f * f,
+						-MFLOAT_C(8.0) * a * a * a * a + MFLOAT_C(1.0));
+}
+
+MATHC_KERNEL_BODY mfloat_t quintic_ease_out_body(mfloat_t f)
+{
+	mfloat_t a = f - MFLOAT_C(1.0);
+	return a * a * a * a * a + MFLOAT_C(1.0);
+}
+
+MATHC_KERNEL_BODY mfloat_t quintic_ease_in_body(mfloat_t f)
+{
+	return f * f * f * f * f;
+}
+
+MATHC_KERNEL_BODY mfloat_t quintic_ease_in_out_body(mfloat_t f)
+{
+	mfloat_t a = MFLOAT_C(2.0) * f - MFLOAT_C(2.0);
+	return mathc_select(f < MFLOAT_C(0.5), MFLOAT_C(16.0) * f * f * f * f * f,
+						MFLOAT_C(0.5) * a * a * a * a * a + MFLOAT_C(1.0));
+}
+
+MATHC_KERNEL_BODY mfloat_t sine_ease_out_body(mfloat_t f)
+{
+	return MATHC_SIN(f * MPI_2);
+}
+
+MATHC_KERNEL_BODY mfloat_t sine_ease_in_body(mfloat_t f)
+{
+	return MATHC_SIN((f - MFLOAT_C(1.0)) * MPI_2) + MFLOAT_C(1.0);
+}
+
+MATHC_KERNEL_BODY mfloat_t sine_ease_in_out_body(mfloat_t f)
+{
+	return MFLOAT_C(0.5) * (MFLOAT_C(1.0) - MATHC_COS(f * MPI));
+}
+
+MATHC_KERNEL_BODY mfloat_t circular_ease_out_body(mfloat_t f)
+{
+	return MATHC_SQRT((MFLOAT_C(2.0) - f) * f);
+}
+
+MATHC_KERNEL_BODY mfloat_t circular_ease_in_body(mfloat_t f)
+{
+	return MFLOAT_C(1.0) - MATHC_SQRT(MFLOAT_C(1.0) - (f * f));
+}
+
+/* One square root of the argument of the half that is used, which is never negative */
+MATHC_KERNEL_BODY mfloat_t circular_ease_in_out_body(mfloat_t f)
+{
+	int low = f < MFLOAT_C(0.5);
+	mfloat_t r = MATHC_SQRT(MATHC_SELECT_ARGUMENT(
+		low, MFLOAT_C(1.0) - MFLOAT_C(4.0) * f * f,
+		-(MFLOAT_C(2.0) * f - MFLOAT_C(3.0)) * (MFLOAT_C(2.0) * f - MFLOAT_C(1.0))));
+	return mathc_select(low, MFLOAT_C(0.5) * (MFLOAT_C(1.0) - r),
+						MFLOAT_C(0.5) * (r + MFLOAT_C(1.0)));
+}
+
+MATHC_KERNEL_BODY mfloat_t exponential_ease_out_body(mfloat_t f)
+{
+	mfloat_t a = MFLOAT_C(1.0) - MATHC_EXP2(-MFLOAT_C(10.0) * f);
+	a = mathc_select(MFABS(f - MFLOAT_C(1.0)) < MFLT_EPSILON, MFLOAT_C(1.0), a);
+	return mathc_select(MFABS(f) < MFLT_EPSILON, MFLOAT_C(0.0), a);
+}
+
+MATHC_KERNEL_BODY mfloat_t exponential_ease_in_body(mfloat_t f)
+{
+	return mathc_select(MFABS(f) > MFLT_EPSILON, MATHC_EXP2(MFLOAT_C(10.0) * (f - MFLOAT_C(1.0))),
+						f);
+}
+
+MATHC_KERNEL_BODY mfloat_t exponential_ease_in_out_body(mfloat_t f)
+{
+	int low = f < MFLOAT_C(0.5);
+	mfloat_t p = MATHC_EXP2(MATHC_SELECT_ARGUMENT(low, (MFLOAT_C(20.0) * f) - MFLOAT_C(10.0),
+												  -MFLOAT_C(20.0) * f + MFLOAT_C(10.0)));
+	mfloat_t a = mathc_select(low, MFLOAT_C(0.5) * p, -MFLOAT_C(0.5) * p + MFLOAT_C(1.0));
+	a = mathc_select(MFABS(f - MFLOAT_C(1.0)) < MFLT_EPSILON, MFLOAT_C(1.0), a);
+	return mathc_select(MFABS(f) < MFLT_EPSILON, MFLOAT_C(0.0), a);
+}
+
+MATHC_KERNEL_BODY mfloat_t elastic_ease_out_body(mfloat_t f)
+{
+	return MATHC_SIN(-MFLOAT_C(13.0) * MPI_2 * (f + MFLOAT_C(1.0))) *
+			   MATHC_EXP2(-MFLOAT_C(10.0) * f) + MFLOAT_C(1.0);
+}
+
+MATHC_KERNEL_BODY mfloat_t elastic_ease_in_body(mfloat_t f)
+{
+	return MATHC_SIN(MFLOAT_C(13.0) * MPI_2 * f) *
+		   MATHC_EXP2(MFLOAT_C(10.0) * (f - MFLOAT_C(1.0)));
+}
+
+MATHC_KERNEL_BODY mfloat_t elastic_ease_in_out_body(mfloat_t f)
+{
+	int low = f < MFLOAT_C(0.5);
+	mfloat_t g = MFLOAT_C(2.0) * f - MFLOAT_C(1.0);
+	mfloat_t s = MATHC_SIN(MATHC_SELECT_ARGUMENT(low, MFLOAT_C(13.0) * MPI_2 * (MFLOAT_C(2.0) * f),
+												 -MFLOAT_C(13.0) * MPI_2 * (g + MFLOAT_C(1.0))));
+	mfloat_t e = MATHC_EXP2(MATHC_SELECT_ARGUMENT(low, MFLOAT_C(10.0) * g, -MFLOAT_C(10.0) * g));
+	return mathc_select(low, MFLOAT_C(0.5) * s * e, MFLOAT_C(0.5) * (s * e + MFLOAT_C(2.0)));
+}
+
+MATHC_KERNEL_BODY mfloat_t back_ease_out_body(mfloat_t f)
+{
+	mfloat_t a = MFLOAT_C(1.0) - f;
+	return MFLOAT_C(1.0) - (a * a * a - a * MATHC_SIN(a * MPI));
+}
+
+MATHC_KERNEL_BODY mfloat_t back_ease_in_body(mfloat_t f)
+{
+	return f * f * f - f * MATHC_SIN(f * MPI);
+}
+
+/* The second half takes the sine of `f * MPI`, not of `a * MPI` like the first half */
+MATHC_KERNEL_BODY mfloat_t back_ease_in_out_body(mfloat_t f)
+{
+	int low = f < MFLOAT_C(0.5);
+	mfloat_t a = mathc_select(low, MFLOAT_C(2.0) * f,
+							  MFLOAT_C(1.0) - (MFLOAT_C(2.0) * f - MFLOAT_C(1.0)));
+	mfloat_t g = a * a * a - a * MATHC_SIN(MATHC_SELECT_ARGUMENT(low, a, f) * MPI);
+	return mathc_select(low, MFLOAT_C(0.5) * g,
+						MFLOAT_C(0.5) * (MFLOAT_C(1.0) - g) + MFLOAT_C(0.5));
+}
+
+/* The four parabolas of the bounce, with their coefficients selected from the segment of `f` */
+MATHC_KERNEL_BODY mfloat_t bounce_ease_out_body(mfloat_t f)
+{
+	int s0 = f < MFLOAT_C(4.0) / MFLOAT_C(11.0);
+	int s1 = f < MFLOAT_C(8.0) / MFLOAT_C(11.0);
+	int s2 = f < MFLOAT_C(9.0) / MFLOAT_C(10.0);
+	mfloat_t a = mathc_select(s2, MFLOAT_C(4356.0) / MFLOAT_C(361.0),
+							  MFLOAT_C(54.0) / MFLOAT_C(5.0));
+	mfloat_t b = mathc_select(s2, -MFLOAT_C(35442.0) / MFLOAT_C(1805.0),
+							  -MFLOAT_C(513.0) / MFLOAT_C(25.0));
+	mfloat_t c = mathc_select(s2, MFLOAT_C(16061.0) / MFLOAT_C(1805.0),
+							  MFLOAT_C(268.0) / MFLOAT_C(25.0));
+	a = mathc_select(s1, MFLOAT_C(363.0) / MFLOAT_C(40.0), a);
+	b = mathc_select(s1, -MFLOAT_C(99.0) / MFLOAT_C(10.0), b);
+	c = mathc_select(s1, MFLOAT_C(17.0) / MFLOAT_C(5.0), c);
+	a = mathc_select(s0, MFLOAT_C(121.0) / MFLOAT_C(16.0), a);
+	b = mathc_select(s0, MFLOAT_C(0.0), b);
+	c = mathc_select(s0, MFLOAT_C(0.0), c);
+	return (a * f * f) + (b * f) + c;
+}
+
+MATHC_KERNEL_BODY mfloat_t bounce_ease_in_body(mfloat_t f)
+{
+	return MFLOAT_C(1.0) - bounce_ease_out_body(MFLOAT_C(1.0) - f);
+}
+
+MATHC_KERNEL_BODY mfloat_t bounce_ease_in_out_body(mfloat_t f)
+{
+	int low = f < MFLOAT_C(0.5);
+	mfloat_t g = bounce_ease_out_body(mathc_select(low, MFLOAT_C(1.0) - f * MFLOAT_C(2.0),
+												   f * MFLOAT_C(2.0) - MFLOAT_C(1.0)));
+	return mathc_select(low, MFLOAT_C(0.5) * (MFLOAT_C(1.0) - g),
+						MFLOAT_C(0.5) * g + MFLOAT_C(0.5));
+}
+
+/* Newton-Raphson steps need a slope of x(t) at least this steep to converge */
+#define MATHC_CUBIC_BEZIER_NEWTON_SLOPE MFLOAT_C(0.001)
+#define MATHC_CUBIC_BEZIER_NEWTON_STEPS 4
+#define MATHC_CUBIC_BEZIER_BISECTION_STEPS 24
+/* Largest error of x(t) accepted from the Newton-Raphson steps */
+#define MATHC_CUBIC_BEZIER_TOLERANCE MFLOAT_C(2e-7)
+
+/* Finds the parameter t of the curve where x(t) is `x`, in [0, 1] */
+static mfloat_t mathc_cubic_bezier_solve(struct mathc_cubic_bezier* bezier, mfloat_t x)
+{
+	mfloat_t step = MFLOAT_C(1.0) / (mfloat_t)(MATHC_CUBIC_BEZIER_SAMPLES - 1);
+	mfloat_t width;
+	mfloat_t t;
+	mfloat_t slope;
+	mfloat_t low;
+	mfloat_t high;
+	int i = 0;
+	int k;
+	while (i < MATHC_CUBIC_BEZIER_SAMPLES - 2 && bezier->samples[i + 1] <= x) {
+		++i;
+	}
+	/* Start from the chord between the samples around `x` */
+	width = bezier->samples[i + 1] - bezier->samples[i];
+	t = (mfloat_t)i * step;
+	if (width > MFLOAT_C(0.0)) {
+		t = t + (x - bezier->samples[i]) / width * step;
+	}
+	for (k = 0; k < MATHC_CUBIC_BEZIER_NEWTON_STEPS; ++k) {
+		mfloat_t error = ((bezier->ax * t + bezier->bx) * t + bezier->cx) * t - x;
+		if (MFABS(error) <= MATHC_CUBIC_BEZIER_TOLERANCE) {
+			return t;
+		}
+		slope = (MFLOAT_C(3.0) * bezier->ax * t + MFLOAT_C(2.0) * bezier->bx) * t + bezier->cx;
+		if (slope < MATHC_CUBIC_BEZIER_NEWTON_SLOPE) {
+			break;
+		}
+		t = MFMIN(MFMAX(t - error / slope, MFLOAT_C(0.0)), MFLOAT_C(1.0));
+	}
+	/* The curve is too flat, or too curved, around `x` for the steps to converge */
+	low = (mfloat_t)i * step;
+	high = low + step;
+	for (k = 0; k < MATHC_CUBIC_BEZIER_BISECTION_STEPS; ++k) {
+		t = (low + high) * MFLOAT_C(0.5);
+		if (((bezier->ax * t + bezier->bx) * t + bezier->cx) * t < x) {
+			low = t;
+		} else {
+			high = t;
+		}
+	}
+	return (low + high) * MFLOAT_C(0.5);
+}
+#endif
+
+#if defined(MATHC_USE_FLOATING_POINT) && defined(MATHC_USE_STREAM_FUNCTIONS)
+/*
+The stream functions keep every loop free of cross-component dependencies, so
+each one touches a single output array and vectorizes without aliasing
+concerns. Functions where one output needs several inputs work through a small
+block buffer on the stack, which keeps in-place calls correct.
+*/
+#define MATHC_STREAM_BLOCK 64
+
+#if defined(MATHC_USE_DISPATCH)
+/* Compiles a stream function body once per target, so its loops vectorize to the target width */
+#define MATHC_STREAM_TARGETS(name, params, args) \
+	MATHC_KERNEL void name##_scalar params \
+	{ \
+		name##_body args; \
+	} \
+	MATHC_TARGET_AVX2 MATHC_KERNEL void name##_avx2 params \
+	{ \
+		name##_body args; \
+	} \
+	MATHC_TARGET_AVX512 MATHC_KERNEL void name##_avx512 params \
+	{ \
+		name##_body args; \
+	}
+#endif
+
+void vec3_add_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+				mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) rx[i] = x0[i] + x1[i];
+	for (i = 0; i < n; ++i) ry[i] = y0[i] + y1[i];
+	for (i = 0; i < n; ++i) rz[i] = z0[i] + z1[i];
+}
+
+void vec3_subtract_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0,
+					 mfloat_t* z0, mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) rx[i] = x0[i] - x1[i];
+	for (i = 0; i < n; ++i) ry[i] = y0[i] - y1[i];
+	for (i = 0; i < n; ++i) rz[i] = z0[i] - z1[i];
+}
+
+void vec3_multiply_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0,
+					 mfloat_t* z0, mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) rx[i] = x0[i] * x1[i];
+	for (i = 0; i < n; ++i) ry[i] = y0[i] * y1[i];
+	for (i = 0; i < n; ++i) rz[i] = z0[i] * z1[i];
+}
+
+void vec3_multiply_f_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0,
+					   mfloat_t* z0, mfloat_t f, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) rx[i] = x0[i] * f;
+	for (i = 0; i < n; ++i) ry[i] = y0[i] * f;
+	for (i = 0; i < n; ++i) rz[i] = z0[i] * f;
+}
+
+MATHC_KERNEL_BODY void vec3_multiply_mat3_n_body(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz,
+												 mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+												 mfloat_t* m0, size_t n)
+{
+	mfloat_t bx[MATHC_STREAM_BLOCK];
+	mfloat_t by[MATHC_STREAM_BLOCK];
+	mfloat_t bz[MATHC_STREAM_BLOCK];
+	mfloat_t m[MAT3_SIZE];
+	size_t begin;
+	size_t count;
+	size_t i;
+	mat3_assign(m, m0);
+	for (begin = 0; begin < n; begin += count) {
+		count = n - begin < MATHC_STREAM_BLOCK ? n - begin : MATHC_STREAM_BLOCK;
+		for (i = 0; i < count; ++i) {
+			mfloat_t x = x0[begin + i];
+			mfloat_t y = y0[begin + i];
+			mfloat_t z = z0[begin + i];
+			bx[i] = m[0] * x + m[3] * y + m[6] * z;
+			by[i] = m[1] * x + m[4] * y + m[7] * z;
+			bz[i] = m[2] * x + m[5] * y + m[8] * z;
+		}
+		for (i = 0; i < count; ++i) rx[begin + i] = bx[i];
+		for (i = 0; i < count; ++i) ry[begin + i] = by[i];
+		for (i = 0; i < count; ++i) rz[begin + i] = bz[i];
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(vec3_multiply_mat3_n, (mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+											mfloat_t* y0, mfloat_t* z0, mfloat_t* m0, size_t n),
+					 (rx, ry, rz, x0, y0, z0, m0, n))
+#endif
+
+void vec3_multiply_mat3_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0,
+						  mfloat_t* z0, mfloat_t* m0, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->vec3_multiply_mat3_n(rx, ry, rz, x0, y0, z0, m0, n);
+#else
+	vec3_multiply_mat3_n_body(rx, ry, rz, x0, y0, z0, m0, n);
+#endif
+}
+
+void vec3_negative_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0,
+					 mfloat_t* z0, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) rx[i] = -x0[i];
+	for (i = 0; i < n; ++i) ry[i] = -y0[i];
+	for (i = 0; i < n; ++i) rz[i] = -z0[i];
+}
+
+MATHC_KERNEL_BODY void vec3_cross_n_body(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+										 mfloat_t* y0, mfloat_t* z0, mfloat_t* x1, mfloat_t* y1,
+										 mfloat_t* z1, size_t n)
+{
+	mfloat_t bx[MATHC_STREAM_BLOCK];
+	mfloat_t by[MATHC_STREAM_BLOCK];
+	mfloat_t bz[MATHC_STREAM_BLOCK];
+	size_t begin;
+	size_t count;
+	size_t i;
+	for (begin = 0; begin < n; begin += count) {
+		count = n - begin < MATHC_STREAM_BLOCK ? n - begin : MATHC_STREAM_BLOCK;
+		for (i = 0; i < count; ++i) {
+			size_t j = begin + i;
+			bx[i] = y0[j] * z1[j] - z0[j] * y1[j];
+			by[i] = z0[j] * x1[j] - x0[j] * z1[j];
+			bz[i] = x0[j] * y1[j] - y0[j] * x1[j];
+		}
+		for (i = 0; i < count; ++i) rx[begin + i] = bx[i];
+		for (i = 0; i < count; ++i) ry[begin + i] = by[i];
+		for (i = 0; i < count; ++i) rz[begin + i] = bz[i];
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(vec3_cross_n, (mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+									mfloat_t* y0, mfloat_t* z0, mfloat_t* x1, mfloat_t* y1,
+									mfloat_t* z1, size_t n),
+					 (rx, ry, rz, x0, y0, z0, x1, y1, z1, n))
+#endif
+
+void vec3_cross_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0,
+				  mfloat_t* z0, mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->vec3_cross_n(rx, ry, rz, x0, y0, z0, x1, y1, z1, n);
+#else
+	vec3_cross_n_body(rx, ry, rz, x0, y0, z0, x1, y1, z1, n);
+#endif
+}
+
+MATHC_KERNEL_BODY void vec3_normalize_n_body(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+											 mfloat_t* y0, mfloat_t* z0, size_t n)
+{
+	mfloat_t l[MATHC_STREAM_BLOCK];
+	size_t begin;
+	size_t count;
+	size_t i;
+	for (begin = 0; begin < n; begin += count) {
+		mfloat_t* x = x0 + begin;
+		mfloat_t* y = y0 + begin;
+		mfloat_t* z = z0 + begin;
+		count = n - begin < MATHC_STREAM_BLOCK ? n - begin : MATHC_STREAM_BLOCK;
+#if defined(MATHC_USE_FAST_NORMALIZE) && defined(MATHC_HAS_RSQRT)
+		for (i = 0; i < count; ++i) {
+			l[i] = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+		}
+		for (i = 0; i + 4 <= count; i += 4) {
+			_mm_storeu_ps(l + i, mathc_rsqrt_ps(_mm_loadu_ps(l + i)));
+		}
+		for (; i < count; ++i) {
+			l[i] = mathc_rsqrt(l[i]);
+		}
+#else
+		for (i = 0; i < count; ++i) {
+			l[i] = MFLOAT_C(1.0) / MSQRT(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+		}
+#endif
+		for (i = 0; i < count; ++i) rx[begin + i] = x[i] * l[i];
+		for (i = 0; i < count; ++i) ry[begin + i] = y[i] * l[i];
+		for (i = 0; i < count; ++i) rz[begin + i] = z[i] * l[i];
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(vec3_normalize_n, (mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+										mfloat_t* y0, mfloat_t* z0, size_t n),
+					 (rx, ry, rz, x0, y0, z0, n))
+#endif
+
+void vec3_normalize_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0,
+					  mfloat_t* z0, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->vec3_normalize_n(rx, ry, rz, x0, y0, z0, n);
+#else
+	vec3_normalize_n_body(rx, ry, rz, x0, y0, z0, n);
+#endif
+}
+
+void vec3_lerp_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0,
+				 mfloat_t* z0, mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, mfloat_t f, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) rx[i] = x0[i] + (x1[i] - x0[i]) * f;
+	for (i = 0; i < n; ++i) ry[i] = y0[i] + (y1[i] - y0[i]) * f;
+	for (i = 0; i < n; ++i) rz[i] = z0[i] + (z1[i] - z0[i]) * f;
+}
+
+MATHC_KERNEL_BODY void vec3_dot_n_body(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+									   mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		result[i] = x0[i] * x1[i] + y0[i] * y1[i] + z0[i] * z1[i];
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(vec3_dot_n, (mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+								  mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, size_t n),
+					 (result, x0, y0, z0, x1, y1, z1, n))
+#endif
+
+void vec3_dot_n(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* x1,
+				mfloat_t* y1, mfloat_t* z1, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->vec3_dot_n(result, x0, y0, z0, x1, y1, z1, n);
+#else
+	vec3_dot_n_body(result, x0, y0, z0, x1, y1, z1, n);
+#endif
+}
+
+MATHC_KERNEL_BODY void vec3_length_n_body(mfloat_t* result, mfloat_t* x0, mfloat_t* y0,
+										  mfloat_t* z0, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		result[i] = MSQRT(x0[i] * x0[i] + y0[i] * y0[i] + z0[i] * z0[i]);
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(vec3_length_n, (mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+									 size_t n),
+					 (result, x0, y0, z0, n))
+#endif
+
+void vec3_length_n(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->vec3_length_n(result, x0, y0, z0, n);
+#else
+	vec3_length_n_body(result, x0, y0, z0, n);
+#endif
+}
+
+void vec3_length_squared_n(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		result[i] = x0[i] * x0[i] + y0[i] * y0[i] + z0[i] * z0[i];
+	}
+}
+
+MATHC_KERNEL_BODY void vec3_distance_n_body(mfloat_t* result, mfloat_t* x0, mfloat_t* y0,
+											mfloat_t* z0, mfloat_t* x1, mfloat_t* y1, mfloat_t* z1,
+											size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		mfloat_t dx = x0[i] - x1[i];
+		mfloat_t dy = y0[i] - y1[i];
+		mfloat_t dz = z0[i] - z1[i];
+		result[i] = MSQRT(dx * dx + dy * dy + dz * dz);
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(vec3_distance_n, (mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+									   mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, size_t n),
+					 (result, x0, y0, z0, x1, y1, z1, n))
+#endif
+
+void vec3_distance_n(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* x1,
+					 mfloat_t* y1, mfloat_t* z1, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->vec3_distance_n(result, x0, y0, z0, x1, y1, z1, n);
+#else
+	vec3_distance_n_body(result, x0, y0, z0, x1, y1, z1, n);
+#endif
+}
+
+/*
+Strided vec3 buffers hold one vector every `stride` values of mfloat_t, so
+positions inside interleaved vertex data can be transformed in place. A stride
+of 0 means packed vectors.
+*/
+#define MATHC_STRIDE(stride) ((stride) == 0 ? (size_t)VEC3_SIZE : (stride))
+
+MATHC_KERNEL void mat4_transform_points_n_scalar(mfloat_t* result, size_t result_stride,
+												 mfloat_t* v0, size_t v0_stride, mfloat_t* m0,
+												 size_t n)
+{
+	mfloat_t m[MAT4_SIZE];
+	size_t i;
+	mat4_assign(m, m0);
+	if (mat4_is_affine(m)) {
+		for (i = 0; i < n; ++i) {
+			mfloat_t* v = v0 + i * v0_stride;
+			mfloat_t* r = result + i * result_stride;
+			mfloat_t x = v[0];
+			mfloat_t y = v[1];
+			mfloat_t z = v[2];
+			r[0] = m[0] * x + m[4] * y + m[8] * z + m[12];
+			r[1] = m[1] * x + m[5] * y + m[9] * z + m[13];
+			r[2] = m[2] * x + m[6] * y + m[10] * z + m[14];
+		}
+	} else {
+		for (i = 0; i < n; ++i) {
+			mfloat_t* v = v0 + i * v0_stride;
+			mfloat_t* r = result + i * result_stride;
+			mfloat_t x = v[0];
+			mfloat_t y = v[1];
+			mfloat_t z = v[2];
+			mfloat_t w = MFLOAT_C(1.0) / (m[3] * x + m[7] * y + m[11] * z + m[15]);
+			r[0] = (m[0] * x + m[4] * y + m[8] * z + m[12]) * w;
+			r[1] = (m[1] * x + m[5] * y + m[9] * z + m[13]) * w;
+			r[2] = (m[2] * x + m[6] * y + m[10] * z + m[14]) * w;
+		}
+	}
+}
+
+MATHC_KERNEL void mat4_transform_directions_n_scalar(mfloat_t* result, size_t result_stride,
+													 mfloat_t* v0, size_t v0_stride, mfloat_t* m0,
+													 size_t n)
+{
+	mfloat_t m[MAT4_SIZE];
+	size_t i;
+	mat4_assign(m, m0);
+	for (i = 0; i < n; ++i) {
+		mfloat_t* v = v0 + i * v0_stride;
+		mfloat_t* r = result + i * result_stride;
+		mfloat_t x = v[0];
+		mfloat_t y = v[1];
+		mfloat_t z = v[2];
+		r[0] = m[0] * x + m[4] * y + m[8] * z;
+		r[1] = m[1] * x + m[5] * y + m[9] * z;
+		r[2] = m[2] * x + m[6] * y + m[10] * z;
+	}
+}
+
+#if defined(MATHC_HAS_SSE)
+/* Stores the first three lanes, leaving the value after the vector untouched */
+MATHC_TARGET_SSE MATHC_KERNEL_BODY void vec3_store_sse(mfloat_t* result, __m128 v)
+{
+	_mm_storel_pi((__m64*)result, v);
+	_mm_store_ss(result + 2, _mm_movehl_ps(v, v));
+}
+
+MATHC_TARGET_SSE MATHC_KERNEL void mat4_transform_points_n_sse(mfloat_t* result,
+															   size_t result_stride, mfloat_t* v0,
+															   size_t v0_stride, mfloat_t* m0,
+															   size_t n)
+{
+	/* One vector per register, with w computed in the last lane */
+	__m128 c0 = _mm_loadu_ps(m0);
+	__m128 c1 = _mm_loadu_ps(m0 + 4);
+	__m128 c2 = _mm_loadu_ps(m0 + 8);
+	__m128 c3 = _mm_loadu_ps(m0 + 12);
+	bool affine = mat4_is_affine(m0);
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		mfloat_t* v = v0 + i * v0_stride;
+		__m128 r = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(v[0])), _mm_mul_ps(c1, _mm_set1_ps(v[1])));
+		r = _mm_add_ps(r, _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(v[2])), c3));
+		if (!affine) {
+			r = _mm_div_ps(r, _mm_shuffle_ps(r, r, 0xFF));
+		}
+		vec3_store_sse(result + i * result_stride, r);
+	}
+}
+
+MATHC_TARGET_SSE MATHC_KERNEL void mat4_transform_directions_n_sse(mfloat_t* result,
+																   size_t result_stride,
+																   mfloat_t* v0, size_t v0_stride,
+																   mfloat_t* m0, size_t n)
+{
+	__m128 c0 = _mm_loadu_ps(m0);
+	__m128 c1 = _mm_loadu_ps(m0 + 4);
+	__m128 c2 = _mm_loadu_ps(m0 + 8);
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		mfloat_t* v = v0 + i * v0_stride;
+		__m128 r = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(v[0])), _mm_mul_ps(c1, _mm_set1_ps(v[1])));
+		r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(v[2])));
+		vec3_store_sse(result + i * result_stride, r);
+	}
+}
+#endif
+
+#if defined(MATHC_HAS_AVX2)
+/* Loads the vector components of a and b as the low and high halves of three registers */
+MATHC_TARGET_AVX2 MATHC_KERNEL_BODY void vec3_pair_load_avx2(__m256* x, __m256* y, __m256* z,
+															 mfloat_t* a, mfloat_t* b)
+{
+	*x = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(a[0])), _mm_set1_ps(b[0]), 1);
+	*y = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(a[1])), _mm_set1_ps(b[1]), 1);
+	*z = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(a[2])), _mm_set1_ps(b[2]), 1);
+}
+
+MATHC_TARGET_AVX2 MATHC_KERNEL void mat4_transform_points_n_avx2(mfloat_t* result,
+																 size_t result_stride,
+																 mfloat_t* v0, size_t v0_stride,
+																 mfloat_t* m0, size_t n)
+{
+	/* Two vectors per register; every input of a pair is loaded before its stores */
+	__m256 c0 = _mm256_broadcast_ps((const __m128*)m0);
+	__m256 c1 = _mm256_broadcast_ps((const __m128*)(m0 + 4));
+	__m256 c2 = _mm256_broadcast_ps((const __m128*)(m0 + 8));
+	__m256 c3 = _mm256_broadcast_ps((const __m128*)(m0 + 12));
+	bool affine = mat4_is_affine(m0);
+	size_t i;
+	for (i = 0; i + 1 < n; i += 2) {
+		mfloat_t* r = result + i * result_stride;
+		__m256 x;
+		__m256 y;
+		__m256 z;
+		__m256 p;
+		vec3_pair_load_avx2(&x, &y, &z, v0 + i * v0_stride, v0 + (i + 1) * v0_stride);
+		p = _mm256_add_ps(_mm256_mul_ps(c0, x), _mm256_mul_ps(c1, y));
+		p = _mm256_add_ps(p, _mm256_add_ps(_mm256_mul_ps(c2, z), c3));
+		if (!affine) {
+			p = _mm256_div_ps(p, _mm256_permute_ps(p, 0xFF));
+		}
+		vec3_store_sse(r, _mm256_castps256_ps128(p));
+		vec3_store_sse(r + result_stride, _mm256_extractf128_ps(p, 1));
+	}
+	if (i < n) {
+		mat4_transform_points_n_sse(result + i * result_stride, result_stride,
+									v0 + i * v0_stride, v0_stride, m0, 1);
+	}
+}
+
+MATHC_TARGET_AVX2 MATHC_KERNEL void mat4_transform_directions_n_avx2(mfloat_t* result,
+																	 size_t result_stride,
+																	 mfloat_t* v0, size_t v0_stride,
+																	 mfloat_t* m0, size_t n)
+{
+	__m256 c0 = _mm256_broadcast_ps((const __m128*)m0);
+	__m256 c1 = _mm256_broadcast_ps((const __m128*)(m0 + 4));
+	__m256 c2 = _mm256_broadcast_ps((const __m128*)(m0 + 8));
+	size_t i;
+	for (i = 0; i + 1 < n; i += 2) {
+		mfloat_t* r = result + i * result_stride;
+		__m256 x;
+		__m256 y;
+		__m256 z;
+		__m256 p;
+		vec3_pair_load_avx2(&x, &y, &z, v0 + i * v0_stride, v0 + (i + 1) * v0_stride);
+		p = _mm256_add_ps(_mm256_mul_ps(c0, x), _mm256_mul_ps(c1, y));
+		p = _mm256_add_ps(p, _mm256_mul_ps(c2, z));
+		vec3_store_sse(r, _mm256_castps256_ps128(p));
+		vec3_store_sse(r + result_stride, _mm256_extractf128_ps(p, 1));
+	}
+	if (i < n) {
+		mat4_transform_directions_n_sse(result + i * result_stride, result_stride,
+										v0 + i * v0_stride, v0_stride, m0, 1);
+	}
+}
+#endif
+
+void mat4_transform_points_n(mfloat_t* result, size_t result_stride, mfloat_t* v0,
+							 size_t v0_stride, mfloat_t* m0, size_t n)
+{
+	result_stride = MATHC_STRIDE(result_stride);
+	v0_stride = MATHC_STRIDE(v0_stride);
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->mat4_transform_points_n(result, result_stride, v0, v0_stride, m0, n);
+#elif defined(MATHC_HAS_AVX2)
+	mat4_transform_points_n_avx2(result, result_stride, v0, v0_stride, m0, n);
+#elif defined(MATHC_HAS_SSE)
+	mat4_transform_points_n_sse(result, result_stride, v0, v0_stride, m0, n);
+#else
+	mat4_transform_points_n_scalar(result, result_stride, v0, v0_stride, m0, n);
+#endif
+}
+
+void mat4_transform_directions_n(mfloat_t* result, size_t result_stride, mfloat_t* v0,
+								 size_t v0_stride, mfloat_t* m0, size_t n)
+{
+	result_stride = MATHC_STRIDE(result_stride);
+	v0_stride = MATHC_STRIDE(v0_stride);
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->mat4_transform_directions_n(result, result_stride, v0, v0_stride, m0,
+													   n);
+#elif defined(MATHC_HAS_AVX2)
+	mat4_transform_directions_n_avx2(result, result_stride, v0, v0_stride, m0, n);
+#elif defined(MATHC_HAS_SSE)
+	mat4_transform_directions_n_sse(result, result_stride, v0, v0_stride, m0, n);
+#else
+	mat4_transform_directions_n_scalar(result, result_stride, v0, v0_stride, m0, n);
+#endif
+}
+
+/*
+The multiply kernels take the distance between two matrices in values of
+mfloat_t, where a stride of 0 uses the same matrix for every item. That matrix
+is loaded once when it is on the left.
+*/
+#define MATHC_MAT4_STRIDE(stride) ((stride) == 0 ? (size_t)MAT4_SIZE : (stride))
+
+MATHC_KERNEL void mat4_multiply_n_scalar(mfloat_t* result, size_t result_stride, mfloat_t* m0,
+										 size_t m0_stride, mfloat_t* m1, size_t m1_stride,
+										 size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		mat4_multiply_scalar(result + i * result_stride, m0 + i * m0_stride, m1 + i * m1_stride);
+	}
+}
+
+#if defined(MATHC_HAS_SSE)
+MATHC_TARGET_SSE MATHC_KERNEL void mat4_multiply_n_sse(mfloat_t* result, size_t result_stride,
+													   mfloat_t* m0, size_t m0_stride,
+													   mfloat_t* m1, size_t m1_stride, size_t n)
+{
+	size_t i;
+	if (m0_stride == 0) {
+		__m128 c0 = _mm_loadu_ps(m0);
+		__m128 c1 = _mm_loadu_ps(m0 + 4);
+		__m128 c2 = _mm_loadu_ps(m0 + 8);
+		__m128 c3 = _mm_loadu_ps(m0 + 12);
+		for (i = 0; i < n; ++i) {
+			mat4_multiply_columns_sse(result + i * result_stride, c0, c1, c2, c3,
+									  m1 + i * m1_stride);
+		}
+		return;
+	}
+	for (i = 0; i < n; ++i) {
+		mfloat_t* a = m0 + i * m0_stride;
+		mat4_multiply_columns_sse(result + i * result_stride, _mm_loadu_ps(a),
+								  _mm_loadu_ps(a + 4), _mm_loadu_ps(a + 8), _mm_loadu_ps(a + 12),
+								  m1 + i * m1_stride);
+	}
+}
+#endif
+
+#if defined(MATHC_HAS_AVX2)
+MATHC_TARGET_AVX2 MATHC_KERNEL void mat4_multiply_n_avx2(mfloat_t* result, size_t result_stride,
+														 mfloat_t* m0, size_t m0_stride,
+														 mfloat_t* m1, size_t m1_stride, size_t n)
+{
+	size_t i;
+	if (m0_stride == 0) {
+		__m256 c0 = _mm256_broadcast_ps((const __m128*)m0);
+		__m256 c1 = _mm256_broadcast_ps((const __m128*)(m0 + 4));
+		__m256 c2 = _mm256_broadcast_ps((const __m128*)(m0 + 8));
+		__m256 c3 = _mm256_broadcast_ps((const __m128*)(m0 + 12));
+		for (i = 0; i < n; ++i) {
+			mat4_multiply_columns_avx2(result + i * result_stride, c0, c1, c2, c3,
+									   m1 + i * m1_stride);
+		}
+		return;
+	}
+	for (i = 0; i < n; ++i) {
+		mfloat_t* a = m0 + i * m0_stride;
+		mat4_multiply_columns_avx2(result + i * result_stride,
+								   _mm256_broadcast_ps((const __m128*)a),
+								   _mm256_broadcast_ps((const __m128*)(a + 4)),
+								   _mm256_broadcast_ps((const __m128*)(a + 8)),
+								   _mm256_broadcast_ps((const __m128*)(a + 12)),
+								   m1 + i * m1_stride);
+	}
+}
+#endif
+
+#if defined(MATHC_HAS_AVX512)
+MATHC_TARGET_AVX512 MATHC_KERNEL void mat4_multiply_n_avx512(mfloat_t* result,
+															 size_t result_stride, mfloat_t* m0,
+															 size_t m0_stride, mfloat_t* m1,
+															 size_t m1_stride, size_t n)
+{
+	size_t i;
+	if (m0_stride == 0) {
+		__m512 c0 = _mm512_broadcast_f32x4(_mm_loadu_ps(m0));
+		__m512 c1 = _mm512_broadcast_f32x4(_mm_loadu_ps(m0 + 4));
+		__m512 c2 = _mm512_broadcast_f32x4(_mm_loadu_ps(m0 + 8));
+		__m512 c3 = _mm512_broadcast_f32x4(_mm_loadu_ps(m0 + 12));
+		for (i = 0; i < n; ++i) {
+			mat4_multiply_columns_avx512(result + i * result_stride, c0, c1, c2, c3,
+										 m1 + i * m1_stride);
+		}
+		return;
+	}
+	for (i = 0; i < n; ++i) {
+		mfloat_t* a = m0 + i * m0_stride;
+		mat4_multiply_columns_avx512(result + i * result_stride,
+									 _mm512_broadcast_f32x4(_mm_loadu_ps(a)),
+									 _mm512_broadcast_f32x4(_mm_loadu_ps(a + 4)),
+									 _mm512_broadcast_f32x4(_mm_loadu_ps(a + 8)),
+									 _mm512_broadcast_f32x4(_mm_loadu_ps(a + 12)),
+									 m1 + i * m1_stride);
+	}
+}
+#endif
+
+static void mat4_multiply_n_strided(mfloat_t* result, size_t result_stride, mfloat_t* m0,
+									size_t m0_stride, mfloat_t* m1, size_t m1_stride, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->mat4_multiply_n(result, result_stride, m0, m0_stride, m1, m1_stride, n);
+#elif defined(MATHC_HAS_AVX2)
+	mat4_multiply_n_avx2(result, result_stride, m0, m0_stride, m1, m1_stride, n);
+#elif defined(MATHC_HAS_SSE)
+	mat4_multiply_n_sse(result, result_stride, m0, m0_stride, m1, m1_stride, n);
+#else
+	mat4_multiply_n_scalar(result, result_stride, m0, m0_stride, m1, m1_stride, n);
+#endif
+}
+
+void mat4_multiply_n(mfloat_t* result, size_t result_stride, mfloat_t* m0, size_t m0_stride,
+					 mfloat_t* m1, size_t m1_stride, size_t n)
+{
+	mat4_multiply_n_strided(result, MATHC_MAT4_STRIDE(result_stride), m0,
+							MATHC_MAT4_STRIDE(m0_stride), m1, MATHC_MAT4_STRIDE(m1_stride), n);
+}
+
+void mat4_multiply_broadcast_left_n(mfloat_t* result, size_t result_stride, mfloat_t* m0,
+									mfloat_t* m1, size_t m1_stride, size_t n)
+{
+	mat4_multiply_n_strided(result, MATHC_MAT4_STRIDE(result_stride), m0, 0, m1,
+							MATHC_MAT4_STRIDE(m1_stride), n);
+}
+
+void mat4_multiply_broadcast_right_n(mfloat_t* result, size_t result_stride, mfloat_t* m0,
+									 size_t m0_stride, mfloat_t* m1, size_t n)
+{
+	mat4_multiply_n_strided(result, MATHC_MAT4_STRIDE(result_stride), m0,
+							MATHC_MAT4_STRIDE(m0_stride), m1, 0, n);
+}
+
+/*
+The culling tests every plane without branches and builds one word of the mask
+for every 32 objects, so the loop over the objects of a word vectorizes. The
+bits come from a table since SSE2 has no shift by a different count per lane.
+*/
+#define MATHC_CULL_WORD 32
+
+static const uint32_t mathc_cull_bits[MATHC_CULL_WORD] = {
+	0x1u, 0x2u, 0x4u, 0x8u, 0x10u, 0x20u, 0x40u, 0x80u, 0x100u, 0x200u, 0x400u, 0x800u, 0x1000u,
+	0x2000u, 0x4000u, 0x8000u, 0x10000u, 0x20000u, 0x40000u, 0x80000u, 0x100000u, 0x200000u,
+	0x400000u, 0x800000u, 0x1000000u, 0x2000000u, 0x4000000u, 0x8000000u, 0x10000000u, 0x20000000u,
+	0x40000000u, 0x80000000u};
+
+MATHC_KERNEL_BODY void frustum_cull_spheres_n_body(uint32_t* result, mfloat_t* frustum,
+												   mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+												   mfloat_t* radius, size_t n)
+{
+	mfloat_t p[FRUSTUM_SIZE];
+	size_t i;
+	size_t j;
+	for (j = 0; j < FRUSTUM_SIZE; ++j) {
+		p[j] = frustum[j];
+	}
+	for (i = 0; i < n; i += MATHC_CULL_WORD) {
+		size_t count = n - i < MATHC_CULL_WORD ? n - i : MATHC_CULL_WORD;
+		uint32_t bits = 0;
+		for (j = 0; j < count; ++j) {
+			mfloat_t x = x0[i + j];
+			mfloat_t y = y0[i + j];
+			mfloat_t z = z0[i + j];
+			mfloat_t r = -radius[i + j];
+			uint32_t visible = (p[0] * x + p[1] * y + p[2] * z + p[3] >= r)
+				& (p[4] * x + p[5] * y + p[6] * z + p[7] >= r)
+				& (p[8] * x + p[9] * y + p[10] * z + p[11] >= r)
+				& (p[12] * x + p[13] * y + p[14] * z + p[15] >= r)
+				& (p[16] * x + p[17] * y + p[18] * z + p[19] >= r)
+				& (p[20] * x + p[21] * y + p[22] * z + p[23] >= r);
+			bits |= mathc_cull_bits[j] & (0u - visible);
+		}
+		result[i / MATHC_CULL_WORD] = bits;
+	}
+}
+
+MATHC_KERNEL_BODY void frustum_cull_aabbs_n_body(uint32_t* result, mfloat_t* frustum,
+												 mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+												 mfloat_t* ex, mfloat_t* ey, mfloat_t* ez,
+												 size_t n)
+{
+	/* The box reaches furthest into a plane along the absolute value of its normal */
+	mfloat_t p[FRUSTUM_SIZE];
+	mfloat_t a[FRUSTUM_SIZE];
+	size_t i;
+	size_t j;
+	for (j = 0; j < FRUSTUM_SIZE; ++j) {
+		p[j] = frustum[j];
+		a[j] = MFABS(frustum[j]);
+	}
+	for (i = 0; i < n; i += MATHC_CULL_WORD) {
+		size_t count = n - i < MATHC_CULL_WORD ? n - i : MATHC_CULL_WORD;
+		uint32_t bits = 0;
+		for (j = 0; j < count; ++j) {
+			mfloat_t x = x0[i + j];
+			mfloat_t y = y0[i + j];
+			mfloat_t z = z0[i + j];
+			mfloat_t w = ex[i + j];
+			mfloat_t h = ey[i + j];
+			mfloat_t d = ez[i + j];
+			mfloat_t s0 = p[0] * x + p[1] * y + p[2] * z + p[3] + a[0] * w + a[1] * h
+				+ a[2] * d;
+			mfloat_t s1 = p[4] * x + p[5] * y + p[6] * z + p[7] + a[4] * w + a[5] * h
+				+ a[6] * d;
+			mfloat_t s2 = p[8] * x + p[9] * y + p[10] * z + p[11] + a[8] * w + a[9] * h
+				+ a[10] * d;
+			mfloat_t s3 = p[12] * x + p[13] * y + p[14] * z + p[15] + a[12] * w + a[13] * h
+				+ a[14] * d;
+			mfloat_t s4 = p[16] * x + p[17] * y + p[18] * z + p[19] + a[16] * w + a[17] * h
+				+ a[18] * d;
+			mfloat_t s5 = p[20] * x + p[21] * y + p[22] * z + p[23] + a[20] * w + a[21] * h
+				+ a[22] * d;
+			uint32_t visible = (s0 >= MFLOAT_C(0.0)) & (s1 >= MFLOAT_C(0.0)) & (s2 >= MFLOAT_C(0.0))
+				& (s3 >= MFLOAT_C(0.0)) & (s4 >= MFLOAT_C(0.0)) & (s5 >= MFLOAT_C(0.0));
+			bits |= mathc_cull_bits[j] & (0u - visible);
+		}
+		result[i / MATHC_CULL_WORD] = bits;
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(frustum_cull_spheres_n, (uint32_t* result, mfloat_t* frustum, mfloat_t* x0,
+											  mfloat_t* y0, mfloat_t* z0, mfloat_t* radius,
+											  size_t n),
+					 (result, frustum, x0, y0, z0, radius, n))
+MATHC_STREAM_TARGETS(frustum_cull_aabbs_n, (uint32_t* result, mfloat_t* frustum, mfloat_t* x0,
+											mfloat_t* y0, mfloat_t* z0, mfloat_t* ex,
+											mfloat_t* ey, mfloat_t* ez, size_t n),
+					 (result, frustum, x0, y0, z0, ex, ey, ez, n))
+#endif
+
+void frustum_cull_spheres_n(uint32_t* result, mfloat_t* frustum, mfloat_t* x0, mfloat_t* y0,
+							mfloat_t* z0, mfloat_t* radius, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->frustum_cull_spheres_n(result, frustum, x0, y0, z0, radius, n);
+#else
+	frustum_cull_spheres_n_body(result, frustum, x0, y0, z0, radius, n);
+#endif
+}
+
+void frustum_cull_aabbs_n(uint32_t* result, mfloat_t* frustum, mfloat_t* x0, mfloat_t* y0,
+						  mfloat_t* z0, mfloat_t* ex, mfloat_t* ey, mfloat_t* ez, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->frustum_cull_aabbs_n(result, frustum, x0, y0, z0, ex, ey, ez, n);
+#else
+	frustum_cull_aabbs_n_body(result, frustum, x0, y0, z0, ex, ey, ez, n);
+#endif
+}
+
+/*
+The ray intersections compute the distance to every object of a block without
+branches, infinite when the ray misses, and then search the block for the
+nearest one. `distance` holds the distance to beat and `index` is only written
+when an object is nearer.
+*/
+union mathc_ray_block {
+	mfloat_t t[MATHC_STREAM_BLOCK];
+#if defined(MATHC_USE_SINGLE_FLOATING_POINT)
+	int32_t bits[MATHC_STREAM_BLOCK];
+#endif
+};
+
+/*
+Position of the nearest distance of a block, or `count` when none is nearer
+than `nearest`. In single precision, distances that aren't negative compare
+like their bits as integers, and the minimum of integers vectorizes, unlike the
+minimum of floats that must handle NaN.
+*/
+MATHC_KERNEL_BODY size_t mathc_ray_nearest(union mathc_ray_block* block, size_t count,
+										   mfloat_t* nearest)
+{
+	size_t i;
+#if defined(MATHC_USE_SINGLE_FLOATING_POINT)
+	union mathc_float_bits limit;
+	int32_t smallest;
+	limit.f = *nearest;
+	smallest = limit.i;
+	for (i = 0; i < count; ++i) {
+		smallest = block->bits[i] < smallest ? block->bits[i] : smallest;
+	}
+	if (smallest == limit.i) {
+		return count;
+	}
+	for (i = 0; block->bits[i] != smallest; ++i) {
+	}
+	*nearest = block->t[i];
+	return i;
+#else
+	size_t result = count;
+	for (i = 0; i < count; ++i) {
+		if (block->t[i] < *nearest) {
+			*nearest = block->t[i];
+			result = i;
+		}
+	}
+	return result;
+#endif
+}
+
+MATHC_KERNEL_BODY void ray_intersect_aabbs_n_body(mfloat_t* distance, size_t* index,
+												  mfloat_t* origin, mfloat_t* direction,
+												  mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+												  mfloat_t* ex, mfloat_t* ey, mfloat_t* ez,
+												  size_t n)
+{
+	/* The slab of each axis is entered on the side facing the origin, so no min or max */
+	union mathc_ray_block block;
+	mfloat_t ox = origin[0];
+	mfloat_t oy = origin[1];
+	mfloat_t oz = origin[2];
+	mfloat_t ix = MFLOAT_C(1.0) / direction[0];
+	mfloat_t iy = MFLOAT_C(1.0) / direction[1];
+	mfloat_t iz = MFLOAT_C(1.0) / direction[2];
+	mfloat_t sx = ix < MFLOAT_C(0.0) ? -MFLOAT_C(1.0) : MFLOAT_C(1.0);
+	mfloat_t sy = iy < MFLOAT_C(0.0) ? -MFLOAT_C(1.0) : MFLOAT_C(1.0);
+	mfloat_t sz = iz < MFLOAT_C(0.0) ? -MFLOAT_C(1.0) : MFLOAT_C(1.0);
+	mfloat_t nearest = *distance;
+	size_t begin;
+	size_t count;
+	size_t i;
+	for (begin = 0; begin < n; begin += count) {
+		count = n - begin < MATHC_STREAM_BLOCK ? n - begin : MATHC_STREAM_BLOCK;
+		for (i = 0; i < count; ++i) {
+			mfloat_t x = x0[begin + i] - ox;
+			mfloat_t y = y0[begin + i] - oy;
+			mfloat_t z = z0[begin + i] - oz;
+			mfloat_t w = ex[begin + i] * sx;
+			mfloat_t h = ey[begin + i] * sy;
+			mfloat_t d = ez[begin + i] * sz;
+			mfloat_t enter_x = (x - w) * ix;
+			mfloat_t enter_y = (y - h) * iy;
+			mfloat_t enter_z = (z - d) * iz;
+			mfloat_t leave_x = (x + w) * ix;
+			mfloat_t leave_y = (y + h) * iy;
+			mfloat_t leave_z = (z + d) * iz;
+			mfloat_t enter = enter_x > MFLOAT_C(0.0) ? enter_x : MFLOAT_C(0.0);
+			mfloat_t leave = leave_x < leave_y ? leave_x : leave_y;
+			enter = enter_y > enter ? enter_y : enter;
+			enter = enter_z > enter ? enter_z : enter;
+			leave = leave_z < leave ? leave_z : leave;
+			block.t[i] = enter <= leave ? enter : INFINITY;
+		}
+		i = mathc_ray_nearest(&block, count, &nearest);
+		if (i < count) {
+			*index = begin + i;
+		}
+	}
+	*distance = nearest;
+}
+
+MATHC_KERNEL_BODY void ray_intersect_triangles_n_body(mfloat_t* distance, size_t* index,
+													  mfloat_t* origin, mfloat_t* direction,
+													  mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+													  mfloat_t* x1, mfloat_t* y1, mfloat_t* z1,
+													  mfloat_t* x2, mfloat_t* y2, mfloat_t* z2,
+													  size_t n)
+{
+	/* Moller-Trumbore, where a degenerate triangle divides by 0 and fails every test */
+	union mathc_ray_block block;
+	mfloat_t ox = origin[0];
+	mfloat_t oy = origin[1];
+	mfloat_t oz = origin[2];
+	mfloat_t dx = direction[0];
+	mfloat_t dy = direction[1];
+	mfloat_t dz = direction[2];
+	mfloat_t nearest = *distance;
+	size_t begin;
+	size_t count;
+	size_t i;
+	for (begin = 0; begin < n; begin += count) {
+		count = n - begin < MATHC_STREAM_BLOCK ? n - begin : MATHC_STREAM_BLOCK;
+		for (i = 0; i < count; ++i) {
+			mfloat_t e1x = x1[begin + i] - x0[begin + i];
+			mfloat_t e1y = y1[begin + i] - y0[begin + i];
+			mfloat_t e1z = z1[begin + i] - z0[begin + i];
+			mfloat_t e2x = x2[begin + i] - x0[begin + i];
+			mfloat_t e2y = y2[begin + i] - y0[begin + i];
+			mfloat_t e2z = z2[begin + i] - z0[begin + i];
+			mfloat_t sx = ox - x0[begin + i];
+			mfloat_t sy = oy - y0[begin + i];
+			mfloat_t sz = oz - z0[begin + i];
+			mfloat_t px = dy * e2z - dz * e2y;
+			mfloat_t py = dz * e2x - dx * e2z;
+			mfloat_t pz = dx * e2y - dy * e2x;
+			mfloat_t qx = sy * e1z - sz * e1y;
+			mfloat_t qy = sz * e1x - sx * e1z;
+			mfloat_t qz = sx * e1y - sy * e1x;
+			mfloat_t inverse = MFLOAT_C(1.0) / (e1x * px + e1y * py + e1z * pz);
+			mfloat_t u = (sx * px + sy * py + sz * pz) * inverse;
+			mfloat_t v = (dx * qx + dy * qy + dz * qz) * inverse;
+			mfloat_t d = (e2x * qx + e2y * qy + e2z * qz) * inverse;
+			int32_t hit = (u >= MFLOAT_C(0.0)) & (v >= MFLOAT_C(0.0)) & (u + v <= MFLOAT_C(1.0))
+				& (d >= MFLOAT_C(0.0));
+			block.t[i] = hit ? d : INFINITY;
+		}
+		i = mathc_ray_nearest(&block, count, &nearest);
+		if (i < count) {
+			*index = begin + i;
+		}
+	}
+	*distance = nearest;
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(ray_intersect_aabbs_n, (mfloat_t* distance, size_t* index, mfloat_t* origin,
+											 mfloat_t* direction, mfloat_t* x0, mfloat_t* y0,
+											 mfloat_t* z0, mfloat_t* ex, mfloat_t* ey,
+											 mfloat_t* ez, size_t n),
+					 (distance, index, origin, direction, x0, y0, z0, ex, ey, ez, n))
+MATHC_STREAM_TARGETS(ray_intersect_triangles_n,
+					 (mfloat_t* distance, size_t* index, mfloat_t* origin, mfloat_t* direction,
+					  mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* x1, mfloat_t* y1,
+					  mfloat_t* z1, mfloat_t* x2, mfloat_t* y2, mfloat_t* z2, size_t n),
+					 (distance, index, origin, direction, x0, y0, z0, x1, y1, z1, x2, y2, z2, n))
+#endif
+
+bool ray_intersect_aabbs_n(mfloat_t* distance, size_t* index, mfloat_t* origin,
+						   mfloat_t* direction, mfloat_t max_distance, mfloat_t* x0, mfloat_t* y0,
+						   mfloat_t* z0, mfloat_t* ex, mfloat_t* ey, mfloat_t* ez, size_t n)
+{
+	mfloat_t nearest = max_distance;
+	size_t i = n;
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->ray_intersect_aabbs_n(&nearest, &i, origin, direction, x0, y0, z0, ex,
+												ey, ez, n);
+#else
+	ray_intersect_aabbs_n_body(&nearest, &i, origin, direction, x0, y0, z0, ex, ey, ez, n);
+#endif
+	if (i == n) {
+		return false;
+	}
+	*distance = nearest;
+	*index = i;
+	return true;
+}
+
+bool ray_intersect_triangles_n(mfloat_t* distance, size_t* index, mfloat_t* origin,
+							   mfloat_t* direction, mfloat_t max_distance, mfloat_t* x0,
+							   mfloat_t* y0, mfloat_t* z0, mfloat_t* x1, mfloat_t* y1,
+							   mfloat_t* z1, mfloat_t* x2, mfloat_t* y2, mfloat_t* z2, size_t n)
+{
+	mfloat_t nearest = max_distance;
+	size_t i = n;
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->ray_intersect_triangles_n(&nearest, &i, origin, direction, x0, y0, z0,
+													x1, y1, z1, x2, y2, z2, n);
+#else
+	ray_intersect_triangles_n_body(&nearest, &i, origin, direction, x0, y0, z0, x1, y1, z1, x2,
+								   y2, z2, n);
+#endif
+	if (i == n) {
+		return false;
+	}
+	*distance = nearest;
+	*index = i;
+	return true;
+}
+
+/*
+Linear blend skinning with the bones of a palette of `rows` by 4 column-major
+matrices, so the affine and mat4 palettes share the body and the last row of a
+mat4 is never read. The blended matrix of each vertex stays in registers.
+*/
+MATHC_KERNEL_BODY void skin_n_body(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx,
+								   mfloat_t* rny, mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0,
+								   mfloat_t* z0, mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+								   uint16_t* bones, mfloat_t* weights, mfloat_t* palette,
+								   size_t rows, size_t n)
+{
+	size_t size = rows * 4;
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		mfloat_t* b0 = palette + bones[i * SKIN_BONES] * size;
+		mfloat_t* b1 = palette + bones[i * SKIN_BONES + 1] * size;
+		mfloat_t* b2 = palette + bones[i * SKIN_BONES + 2] * size;
+		mfloat_t* b3 = palette + bones[i * SKIN_BONES + 3] * size;
+		mfloat_t w0 = weights[i * SKIN_BONES];
+		mfloat_t w1 = weights[i * SKIN_BONES + 1];
+		mfloat_t w2 = weights[i * SKIN_BONES + 2];
+		mfloat_t w3 = weights[i * SKIN_BONES + 3];
+		mfloat_t m[AFFINE_SIZE];
+		mfloat_t x;
+		mfloat_t y;
+		mfloat_t z;
+		size_t c;
+		size_t r;
+		for (c = 0; c < 4; ++c) {
+			for (r = 0; r < 3; ++r) {
+				size_t j = c * rows + r;
+				m[c * 3 + r] = w0 * b0[j] + w1 * b1[j] + w2 * b2[j] + w3 * b3[j];
+			}
+		}
+		x = x0[i];
+		y = y0[i];
+		z = z0[i];
+		rx[i] = m[0] * x + m[3] * y + m[6] * z + m[9];
+		ry[i] = m[1] * x + m[4] * y + m[7] * z + m[10];
+		rz[i] = m[2] * x + m[5] * y + m[8] * z + m[11];
+		if (rnx != NULL) {
+			x = nx0[i];
+			y = ny0[i];
+			z = nz0[i];
+			rnx[i] = m[0] * x + m[3] * y + m[6] * z;
+			rny[i] = m[1] * x + m[4] * y + m[7] * z;
+			rnz[i] = m[2] * x + m[5] * y + m[8] * z;
+		}
+	}
+}
+
+MATHC_KERNEL void skin_affine_n_scalar(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx,
+									   mfloat_t* rny, mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0,
+									   mfloat_t* z0, mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+									   uint16_t* bones, mfloat_t* weights, mfloat_t* palette,
+									   size_t n)
+{
+	skin_n_body(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights, palette, 3,
+				n);
+}
+
+MATHC_KERNEL void skin_mat4_n_scalar(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx,
+									 mfloat_t* rny, mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0,
+									 mfloat_t* z0, mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+									 uint16_t* bones, mfloat_t* weights, mfloat_t* palette,
+									 size_t n)
+{
+	skin_n_body(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights, palette, 4,
+				n);
+}
+
+#if defined(MATHC_HAS_SSE)
+/*
+Blends the columns of the bones of vertex i. The 12 values of an affine bone are
+blended as three registers and shuffled into columns afterwards, so no load
+reads past the end of the palette.
+*/
+MATHC_TARGET_SSE MATHC_KERNEL_BODY void skin_columns_sse(__m128* c, uint16_t* bones,
+														 mfloat_t* weights, mfloat_t* palette,
+														 size_t rows, size_t i)
+{
+	size_t size = rows * 4;
+	int32_t k;
+	int32_t j;
+	for (j = 0; j < 4; ++j) {
+		c[j] = _mm_setzero_ps();
+	}
+	for (k = 0; k < SKIN_BONES; ++k) {
+		mfloat_t* b = palette + bones[i * SKIN_BONES + k] * size;
+		__m128 w = _mm_set1_ps(weights[i * SKIN_BONES + k]);
+		for (j = 0; j < (int32_t)rows; ++j) {
+			c[j] = _mm_add_ps(c[j], _mm_mul_ps(w, _mm_loadu_ps(b + j * 4)));
+		}
+	}
+	if (rows == 3) {
+		__m128 v0 = c[0];
+		__m128 v1 = c[1];
+		__m128 v2 = c[2];
+		c[1] = _mm_shuffle_ps(_mm_shuffle_ps(v0, v1, 0x0F), v1, 0x18);
+		c[2] = _mm_shuffle_ps(v1, v2, 0x0E);
+		c[3] = _mm_shuffle_ps(v2, v2, 0x39);
+	}
+}
+
+/*
+Four vertices per step: each blended matrix transforms one vertex into the lanes
+of a register, and the four registers are transposed into the result streams.
+Every input of a step is loaded before its stores.
+*/
+MATHC_TARGET_SSE MATHC_KERNEL_BODY void skin_n_sse(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz,
+												   mfloat_t* rnx, mfloat_t* rny, mfloat_t* rnz,
+												   mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+												   mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+												   uint16_t* bones, mfloat_t* weights,
+												   mfloat_t* palette, size_t rows, size_t n)
+{
+	size_t i;
+	for (i = 0; i + 4 <= n; i += 4) {
+		__m128 p[4];
+		__m128 q[4];
+		int32_t v;
+		for (v = 0; v < 4; ++v) {
+			size_t k = i + v;
+			__m128 c[4];
+			skin_columns_sse(c, bones, weights, palette, rows, k);
+			p[v] = _mm_add_ps(_mm_mul_ps(c[0], _mm_set1_ps(x0[k])),
+							  _mm_mul_ps(c[1], _mm_set1_ps(y0[k])));
+			p[v] = _mm_add_ps(p[v], _mm_add_ps(_mm_mul_ps(c[2], _mm_set1_ps(z0[k])), c[3]));
+			if (rnx != NULL) {
+				q[v] = _mm_add_ps(_mm_mul_ps(c[0], _mm_set1_ps(nx0[k])),
+								  _mm_mul_ps(c[1], _mm_set1_ps(ny0[k])));
+				q[v] = _mm_add_ps(q[v], _mm_mul_ps(c[2], _mm_set1_ps(nz0[k])));
+			}
+		}
+		_MM_TRANSPOSE4_PS(p[0], p[1], p[2], p[3]);
+		_mm_storeu_ps(rx + i, p[0]);
+		_mm_storeu_ps(ry + i, p[1]);
+		_mm_storeu_ps(rz + i, p[2]);
+		if (rnx != NULL) {
+			_MM_TRANSPOSE4_PS(q[0], q[1], q[2], q[3]);
+			_mm_storeu_ps(rnx + i, q[0]);
+			_mm_storeu_ps(rny + i, q[1]);
+			_mm_storeu_ps(rnz + i, q[2]);
+		}
+	}
+	if (i < n) {
+		if (rnx != NULL) {
+			rnx += i;
+			rny += i;
+			rnz += i;
+			nx0 += i;
+			ny0 += i;
+			nz0 += i;
+		}
+		skin_n_body(rx + i, ry + i, rz + i, rnx, rny, rnz, x0 + i, y0 + i, z0 + i, nx0, ny0, nz0,
+					bones + i * SKIN_BONES, weights + i * SKIN_BONES, palette, rows, n - i);
+	}
+}
+
+MATHC_TARGET_SSE MATHC_KERNEL void skin_affine_n_sse(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz,
+													 mfloat_t* rnx, mfloat_t* rny, mfloat_t* rnz,
+													 mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+													 mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+													 uint16_t* bones, mfloat_t* weights,
+													 mfloat_t* palette, size_t n)
+{
+	skin_n_sse(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights, palette, 3, n);
+}
+
+MATHC_TARGET_SSE MATHC_KERNEL void skin_mat4_n_sse(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz,
+												   mfloat_t* rnx, mfloat_t* rny, mfloat_t* rnz,
+												   mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+												   mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+												   uint16_t* bones, mfloat_t* weights,
+												   mfloat_t* palette, size_t n)
+{
+	skin_n_sse(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights, palette, 4, n);
+}
+#endif
+
+void skin_affine_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx, mfloat_t* rny,
+				   mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* nx0,
+				   mfloat_t* ny0, mfloat_t* nz0, uint16_t* bones, mfloat_t* weights,
+				   mfloat_t* palette, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->skin_affine_n(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0,
+										bones, weights, palette, n);
+#elif defined(MATHC_HAS_SSE)
+	skin_affine_n_sse(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights,
+					  palette, n);
+#else
+	skin_affine_n_scalar(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights,
+						 palette, n);
+#endif
+}
+
+void skin_mat4_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx, mfloat_t* rny,
+				 mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* nx0,
+				 mfloat_t* ny0, mfloat_t* nz0, uint16_t* bones, mfloat_t* weights,
+				 mfloat_t* palette, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->skin_mat4_n(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones,
+									  weights, palette, n);
+#elif defined(MATHC_HAS_SSE)
+	skin_mat4_n_sse(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights, palette,
+					n);
+#else
+	skin_mat4_n_scalar(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights,
+					   palette, n);
+#endif
+}
+
+/*
+Dual quaternion linear blending: the bones are weighted, flipped to the side of
+the first bone by the sign of the dot product of their rotations, and summed.
+The sum is scaled by the inverse length of its rotation, without removing the
+dual component along it, since the translation 2 * dual * conjugate(real)
+ignores that component. The rotation is applied like quat_rotate_vec3().
+*/
+MATHC_KERNEL_BODY void skin_dualquat_n_body(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz,
+											mfloat_t* rnx, mfloat_t* rny, mfloat_t* rnz,
+											mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+											mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+											uint16_t* bones, mfloat_t* weights,
+											mfloat_t* palette, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		mfloat_t* b0 = palette + bones[i * SKIN_BONES] * DUALQUAT_SIZE;
+		mfloat_t b[DUALQUAT_SIZE];
+		mfloat_t l;
+		mfloat_t tx;
+		mfloat_t ty;
+		mfloat_t tz;
+		mfloat_t x;
+		mfloat_t y;
+		mfloat_t z;
+		mfloat_t cx;
+		mfloat_t cy;
+		mfloat_t cz;
+		int32_t j;
+		int32_t k;
+		for (j = 0; j < DUALQUAT_SIZE; ++j) {
+			b[j] = b0[j] * weights[i * SKIN_BONES];
+		}
+		for (k = 1; k < SKIN_BONES; ++k) {
+			mfloat_t* bk = palette + bones[i * SKIN_BONES + k] * DUALQUAT_SIZE;
+			mfloat_t w = weights[i * SKIN_BONES + k];
+			mfloat_t d = b0[0] * bk[0] + b0[1] * bk[1] + b0[2] * bk[2] + b0[3] * bk[3];
+			w = mathc_select(d < MFLOAT_C(0.0), -w, w);
+			for (j = 0; j < DUALQUAT_SIZE; ++j) {
+				b[j] += bk[j] * w;
+			}
+		}
+		l = MFLOAT_C(1.0) / MSQRT(b[0] * b[0] + b[1] * b[1] + b[2] * b[2] + b[3] * b[3]);
+		for (j = 0; j < DUALQUAT_SIZE; ++j) {
+			b[j] *= l;
+		}
+		tx = MFLOAT_C(2.0) * (b[3] * b[4] - b[7] * b[0] + b[1] * b[6] - b[2] * b[5]);
+		ty = MFLOAT_C(2.0) * (b[3] * b[5] - b[7] * b[1] + b[2] * b[4] - b[0] * b[6]);
+		tz = MFLOAT_C(2.0) * (b[3] * b[6] - b[7] * b[2] + b[0] * b[5] - b[1] * b[4]);
+		x = x0[i];
+		y = y0[i];
+		z = z0[i];
+		cx = MFLOAT_C(2.0) * (b[1] * z - b[2] * y);
+		cy = MFLOAT_C(2.0) * (b[2] * x - b[0] * z);
+		cz = MFLOAT_C(2.0) * (b[0] * y - b[1] * x);
+		rx[i] = x + b[3] * cx + b[1] * cz - b[2] * cy + tx;
+		ry[i] = y + b[3] * cy + b[2] * cx - b[0] * cz + ty;
+		rz[i] = z + b[3] * cz + b[0] * cy - b[1] * cx + tz;
+		if (rnx != NULL) {
+			x = nx0[i];
+			y = ny0[i];
+			z = nz0[i];
+			cx = MFLOAT_C(2.0) * (b[1] * z - b[2] * y);
+			cy = MFLOAT_C(2.0) * (b[2] * x - b[0] * z);
+			cz = MFLOAT_C(2.0) * (b[0] * y - b[1] * x);
+			rnx[i] = x + b[3] * cx + b[1] * cz - b[2] * cy;
+			rny[i] = y + b[3] * cy + b[2] * cx - b[0] * cz;
+			rnz[i] = z + b[3] * cz + b[0] * cy - b[1] * cx;
+		}
+	}
+}
+
+MATHC_KERNEL void skin_dualquat_n_scalar(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx,
+										 mfloat_t* rny, mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0,
+										 mfloat_t* z0, mfloat_t* nx0, mfloat_t* ny0,
+										 mfloat_t* nz0, uint16_t* bones, mfloat_t* weights,
+										 mfloat_t* palette, size_t n)
+{
+	skin_dualquat_n_body(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights,
+						 palette, n);
+}
+
+#if defined(MATHC_HAS_SSE)
+/* Rotates the vectors (x, y, z) by the rotations (qx, qy, qz, qw), four of each */
+MATHC_TARGET_SSE MATHC_KERNEL_BODY void skin_rotate_sse(__m128* r, __m128* q, __m128 x, __m128 y,
+														__m128 z)
+{
+	__m128 two = _mm_set1_ps(2.0f);
+	__m128 cx = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(q[1], z), _mm_mul_ps(q[2], y)));
+	__m128 cy = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(q[2], x), _mm_mul_ps(q[0], z)));
+	__m128 cz = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(q[0], y), _mm_mul_ps(q[1], x)));
+	r[0] = _mm_add_ps(_mm_add_ps(x, _mm_mul_ps(q[3], cx)),
+					  _mm_sub_ps(_mm_mul_ps(q[1], cz), _mm_mul_ps(q[2], cy)));
+	r[1] = _mm_add_ps(_mm_add_ps(y, _mm_mul_ps(q[3], cy)),
+					  _mm_sub_ps(_mm_mul_ps(q[2], cx), _mm_mul_ps(q[0], cz)));
+	r[2] = _mm_add_ps(_mm_add_ps(z, _mm_mul_ps(q[3], cz)),
+					  _mm_sub_ps(_mm_mul_ps(q[0], cy), _mm_mul_ps(q[1], cx)));
+}
+
+/*
+Four vertices per step. The bones of the four vertices are transposed so each
+register holds one component of four dual quaternions, and the blend and the
+transforms run on those registers. Compiled for SSE and for AVX2, where the
+products and sums contract into FMA.
+*/
+MATHC_TARGET_SSE MATHC_KERNEL_BODY void skin_dualquat_sse(mfloat_t* rx, mfloat_t* ry,
+														  mfloat_t* rz, mfloat_t* rnx,
+														  mfloat_t* rny, mfloat_t* rnz,
+														  mfloat_t* x0, mfloat_t* y0,
+														  mfloat_t* z0, mfloat_t* nx0,
+														  mfloat_t* ny0, mfloat_t* nz0,
+														  uint16_t* bones, mfloat_t* weights,
+														  mfloat_t* palette, size_t n)
+{
+	__m128 sign = _mm_set1_ps(-0.0f);
+	size_t i;
+	for (i = 0; i + 4 <= n; i += 4) {
+		__m128 w[SKIN_BONES];
+		__m128 b[DUALQUAT_SIZE];
+		__m128 first[QUAT_SIZE];
+		__m128 p[VEC3_SIZE];
+		__m128 l;
+		__m128 tx;
+		__m128 ty;
+		__m128 tz;
+		int32_t j;
+		int32_t k;
+		for (j = 0; j < 4; ++j) {
+			w[j] = _mm_loadu_ps(weights + (i + j) * SKIN_BONES);
+		}
+		_MM_TRANSPOSE4_PS(w[0], w[1], w[2], w[3]);
+		for (k = 0; k < SKIN_BONES; ++k) {
+			__m128 r[QUAT_SIZE];
+			__m128 d[QUAT_SIZE];
+			__m128 wk = w[k];
+			for (j = 0; j < 4; ++j) {
+				mfloat_t* bone = palette + bones[(i + j) * SKIN_BONES + k] * DUALQUAT_SIZE;
+				r[j] = _mm_loadu_ps(bone);
+				d[j] = _mm_loadu_ps(bone + 4);
+			}
+			_MM_TRANSPOSE4_PS(r[0], r[1], r[2], r[3]);
+			_MM_TRANSPOSE4_PS(d[0], d[1], d[2], d[3]);
+			if (k == 0) {
+				for (j = 0; j < QUAT_SIZE; ++j) {
+					first[j] = r[j];
+					b[j] = _mm_setzero_ps();
+					b[j + 4] = _mm_setzero_ps();
+				}
+			} else {
+				__m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(first[0], r[0]),
+												   _mm_mul_ps(first[1], r[1])),
+										_mm_add_ps(_mm_mul_ps(first[2], r[2]),
+												   _mm_mul_ps(first[3], r[3])));
+				wk = _mm_xor_ps(wk, _mm_and_ps(dot, sign));
+			}
+			for (j = 0; j < QUAT_SIZE; ++j) {
+				b[j] = _mm_add_ps(b[j], _mm_mul_ps(r[j], wk));
+				b[j + 4] = _mm_add_ps(b[j + 4], _mm_mul_ps(d[j], wk));
+			}
+		}
+		l = _mm_add_ps(_mm_add_ps(_mm_mul_ps(b[0], b[0]), _mm_mul_ps(b[1], b[1])),
+					   _mm_add_ps(_mm_mul_ps(b[2], b[2]), _mm_mul_ps(b[3], b[3])));
+		l = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(l));
+		for (j = 0; j < DUALQUAT_SIZE; ++j) {
+			b[j] = _mm_mul_ps(b[j], l);
+		}
+		tx = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(b[3], b[4]), _mm_mul_ps(b[7], b[0])),
+						_mm_sub_ps(_mm_mul_ps(b[1], b[6]), _mm_mul_ps(b[2], b[5])));
+		ty = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(b[3], b[5]), _mm_mul_ps(b[7], b[1])),
+						_mm_sub_ps(_mm_mul_ps(b[2], b[4]), _mm_mul_ps(b[0], b[6])));
+		tz = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(b[3], b[6]), _mm_mul_ps(b[7], b[2])),
+						_mm_sub_ps(_mm_mul_ps(b[0], b[5]), _mm_mul_ps(b[1], b[4])));
+		skin_rotate_sse(p, b, _mm_loadu_ps(x0 + i), _mm_loadu_ps(y0 + i), _mm_loadu_ps(z0 + i));
+		if (rnx != NULL) {
+			__m128 q[VEC3_SIZE];
+			skin_rotate_sse(q, b, _mm_loadu_ps(nx0 + i), _mm_loadu_ps(ny0 + i),
+							_mm_loadu_ps(nz0 + i));
+			_mm_storeu_ps(rnx + i, q[0]);
+			_mm_storeu_ps(rny + i, q[1]);
+			_mm_storeu_ps(rnz + i, q[2]);
+		}
+		_mm_storeu_ps(rx + i, _mm_add_ps(p[0], _mm_add_ps(tx, tx)));
+		_mm_storeu_ps(ry + i, _mm_add_ps(p[1], _mm_add_ps(ty, ty)));
+		_mm_storeu_ps(rz + i, _mm_add_ps(p[2], _mm_add_ps(tz, tz)));
+	}
+	if (i < n) {
+		if (rnx != NULL) {
+			rnx += i;
+			rny += i;
+			rnz += i;
+			nx0 += i;
+			ny0 += i;
+			nz0 += i;
+		}
+		skin_dualquat_n_body(rx + i, ry + i, rz + i, rnx, rny, rnz, x0 + i, y0 + i, z0 + i, nx0,
+							 ny0, nz0, bones + i * SKIN_BONES, weights + i * SKIN_BONES, palette,
+							 n - i);
+	}
+}
+
+MATHC_TARGET_SSE MATHC_KERNEL void skin_dualquat_n_sse(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz,
+													   mfloat_t* rnx, mfloat_t* rny,
+													   mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0,
+													   mfloat_t* z0, mfloat_t* nx0,
+													   mfloat_t* ny0, mfloat_t* nz0,
+													   uint16_t* bones, mfloat_t* weights,
+													   mfloat_t* palette, size_t n)
+{
+	skin_dualquat_sse(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights,
+					  palette, n);
+}
+#endif
+
+#if defined(MATHC_HAS_AVX2)
+MATHC_TARGET_AVX2 MATHC_KERNEL void skin_dualquat_n_avx2(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz,
+														 mfloat_t* rnx, mfloat_t* rny,
+														 mfloat_t* rnz, mfloat_t* x0,
+														 mfloat_t* y0, mfloat_t* z0,
+														 mfloat_t* nx0, mfloat_t* ny0,
+														 mfloat_t* nz0, uint16_t* bones,
+														 mfloat_t* weights, mfloat_t* palette,
+														 size_t n)
+{
+	skin_dualquat_sse(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights,
+					  palette, n);
+}
+#endif
+
+void skin_dualquat_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx, mfloat_t* rny,
+					 mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* nx0,
+					 mfloat_t* ny0, mfloat_t* nz0, uint16_t* bones, mfloat_t* weights,
+					 mfloat_t* palette, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->skin_dualquat_n(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0,
+										  bones, weights, palette, n);
+#elif defined(MATHC_HAS_AVX2)
+	skin_dualquat_n_avx2(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights,
+						 palette, n);
+#elif defined(MATHC_HAS_SSE)
+	skin_dualquat_n_sse(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights,
+						palette, n);
+#else
+	skin_dualquat_n_scalar(rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0, bones, weights,
+						   palette, n);
+#endif
+}
+
+void transform_hierarchy_n(mfloat_t* result, mfloat_t* local, int32_t* parents, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		mfloat_t* world = result + i * TRANSFORM_SIZE;
+		if (parents[i] < 0) {
+			int32_t j;
+			for (j = 0; j < TRANSFORM_SIZE; ++j) {
+				world[j] = local[i * TRANSFORM_SIZE + j];
+			}
+		} else {
+			transform_multiply(world, result + parents[i] * TRANSFORM_SIZE,
+							   local + i * TRANSFORM_SIZE);
+		}
+	}
+}
+
+/*
+The local matrix of each node is built in registers from its transform and only
+the world matrix is stored, where the children read it back. Only the first
+three rows of the parent take part in the product, its last row is 0, 0, 0, 1.
+*/
+MATHC_KERNEL_BODY void mat4_from_transform_hierarchy_n_body(mfloat_t* result, mfloat_t* local,
+															int32_t* parents, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		mfloat_t* m = result + i * MAT4_SIZE;
+		mfloat_t c[4][VEC3_SIZE];
+		int32_t j;
+		int32_t r;
+		transform_columns(c[0], c[1], c[2], c[3], local + i * TRANSFORM_SIZE);
+		if (parents[i] < 0) {
+			for (j = 0; j < 4; ++j) {
+				m[j * 4] = c[j][0];
+				m[j * 4 + 1] = c[j][1];
+				m[j * 4 + 2] = c[j][2];
+			}
+		} else {
+			mfloat_t* p = result + parents[i] * MAT4_SIZE;
+			for (j = 0; j < 4; ++j) {
+				for (r = 0; r < 3; ++r) {
+					m[j * 4 + r] = p[r] * c[j][0] + p[4 + r] * c[j][1] + p[8 + r] * c[j][2];
+				}
+			}
+			m[12] += p[12];
+			m[13] += p[13];
+			m[14] += p[14];
+		}
+		m[3] = MFLOAT_C(0.0);
+		m[7] = MFLOAT_C(0.0);
+		m[11] = MFLOAT_C(0.0);
+		m[15] = MFLOAT_C(1.0);
+	}
+}
+
+MATHC_KERNEL void mat4_from_transform_hierarchy_n_scalar(mfloat_t* result, mfloat_t* local,
+														 int32_t* parents, size_t n)
+{
+	mat4_from_transform_hierarchy_n_body(result, local, parents, n);
+}
+
+#if defined(MATHC_HAS_SSE)
+/* Each column of the world matrix is the columns of the parent weighted by a local column */
+MATHC_TARGET_SSE MATHC_KERNEL_BODY void mat4_from_transform_hierarchy_sse(mfloat_t* result,
+																		  mfloat_t* local,
+																		  int32_t* parents,
+																		  size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		mfloat_t* m = result + i * MAT4_SIZE;
+		mfloat_t c[4][VEC3_SIZE];
+		transform_columns(c[0], c[1], c[2], c[3], local + i * TRANSFORM_SIZE);
+		if (parents[i] < 0) {
+			_mm_storeu_ps(m, _mm_setr_ps(c[0][0], c[0][1], c[0][2], 0.0f));
+			_mm_storeu_ps(m + 4, _mm_setr_ps(c[1][0], c[1][1], c[1][2], 0.0f));
+			_mm_storeu_ps(m + 8, _mm_setr_ps(c[2][0], c[2][1], c[2][2], 0.0f));
+			_mm_storeu_ps(m + 12, _mm_setr_ps(c[3][0], c[3][1], c[3][2], 1.0f));
+		} else {
+			mfloat_t* p = result + parents[i] * MAT4_SIZE;
+			__m128 p0 = _mm_loadu_ps(p);
+			__m128 p1 = _mm_loadu_ps(p + 4);
+			__m128 p2 = _mm_loadu_ps(p + 8);
+			__m128 p3 = _mm_loadu_ps(p + 12);
+			int32_t j;
+			for (j = 0; j < 4; ++j) {
+				__m128 column = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p0, _mm_set1_ps(c[j][0])),
+													  _mm_mul_ps(p1, _mm_set1_ps(c[j][1]))),
+										   _mm_mul_ps(p2, _mm_set1_ps(c[j][2])));
+				if (j == 3) {
+					column = _mm_add_ps(column, p3);
+				}
+				_mm_storeu_ps(m + j * 4, column);
+			}
+		}
+	}
+}
+
+MATHC_TARGET_SSE MATHC_KERNEL void mat4_from_transform_hierarchy_n_sse(mfloat_t* result,
+																	   mfloat_t* local,
+																	   int32_t* parents, size_t n)
+{
+	mat4_from_transform_hierarchy_sse(result, local, parents, n);
+}
+#endif
+
+#if defined(MATHC_HAS_AVX2)
+/*
+The AVX2 tier is the SSE kernel compiled with an AVX2 target: a column is four
+floats, so the gain is only the FMA the products and sums contract into.
+*/
+MATHC_TARGET_AVX2 MATHC_KERNEL void mat4_from_transform_hierarchy_n_avx2(mfloat_t* result,
+																		 mfloat_t* local,
+																		 int32_t* parents,
+																		 size_t n)
+{
+	mat4_from_transform_hierarchy_sse(result, local, parents, n);
+}
+#endif
+
+void mat4_from_transform_hierarchy_n(mfloat_t* result, mfloat_t* local, int32_t* parents, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->mat4_from_transform_hierarchy_n(result, local, parents, n);
+#elif defined(MATHC_HAS_AVX2)
+	mat4_from_transform_hierarchy_n_avx2(result, local, parents, n);
+#elif defined(MATHC_HAS_SSE)
+	mat4_from_transform_hierarchy_n_sse(result, local, parents, n);
+#else
+	mat4_from_transform_hierarchy_n_scalar(result, local, parents, n);
+#endif
+}
+
+/*
+Sine and cosine of a block of angles. In single precision this is always the
+polynomial, which vectorizes and is within 1e-7 of the exact values for angles
+in [-10000, 10000].
+*/
+MATHC_KERNEL_BODY void mathc_sincos_n(mfloat_t* s, mfloat_t* c, mfloat_t* angles, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) {
+#if defined(MATHC_USE_SINGLE_FLOATING_POINT)
+		mathc_sincos_poly(angles[i], &s[i], &c[i]);
+#else
+		MSINCOS(angles[i], &s[i], &c[i]);
+#endif
+	}
+}
+
+MATHC_KERNEL_BODY void mat4_rotation_axis_n_body(mfloat_t* result, mfloat_t* axes,
+												 mfloat_t* angles, size_t n)
+{
+	mfloat_t s[MATHC_STREAM_BLOCK];
+	mfloat_t c[MATHC_STREAM_BLOCK];
+	size_t begin;
+	size_t count;
+	size_t i;
+	for (begin = 0; begin < n; begin += count) {
+		count = n - begin < MATHC_STREAM_BLOCK ? n - begin : MATHC_STREAM_BLOCK;
+		mathc_sincos_n(s, c, angles + begin, count);
+		for (i = 0; i < count; ++i) {
+			mat4_rotation_axis_sincos(result + (begin + i) * MAT4_SIZE,
+									  axes + (begin + i) * VEC3_SIZE, s[i], c[i]);
+		}
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(mat4_rotation_axis_n,
+					 (mfloat_t* result, mfloat_t* axes, mfloat_t* angles, size_t n),
+					 (result, axes, angles, n))
+#endif
+
+void mat4_rotation_axis_n(mfloat_t* result, mfloat_t* axes, mfloat_t* angles, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->mat4_rotation_axis_n(result, axes, angles, n);
+#else
+	mat4_rotation_axis_n_body(result, axes, angles, n);
+#endif
+}
+
+MATHC_KERNEL_BODY void quat_from_axis_angle_n_body(mfloat_t* result, mfloat_t* axes,
+												   mfloat_t* angles, size_t n)
+{
+	mfloat_t half[MATHC_STREAM_BLOCK];
+	mfloat_t s[MATHC_STREAM_BLOCK];
+	mfloat_t c[MATHC_STREAM_BLOCK];
+	size_t begin;
+	size_t count;
+	size_t i;
+	for (begin = 0; begin < n; begin += count) {
+		count = n - begin < MATHC_STREAM_BLOCK ? n - begin : MATHC_STREAM_BLOCK;
+		for (i = 0; i < count; ++i) {
+			half[i] = angles[begin + i] * MFLOAT_C(0.5);
+		}
+		mathc_sincos_n(s, c, half, count);
+		for (i = 0; i < count; ++i) {
+			quat_from_axis_sincos(result + (begin + i) * QUAT_SIZE, axes + (begin + i) * VEC3_SIZE,
+								  s[i], c[i]);
+		}
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(quat_from_axis_angle_n,
+					 (mfloat_t* result, mfloat_t* axes, mfloat_t* angles, size_t n),
+					 (result, axes, angles, n))
+#endif
+
+void quat_from_axis_angle_n(mfloat_t* result, mfloat_t* axes, mfloat_t* angles, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->quat_from_axis_angle_n(result, axes, angles, n);
+#else
+	quat_from_axis_angle_n_body(result, axes, angles, n);
+#endif
+}
+
+/*
+The quaternion blends compute the weights of q0 and q1 for a block, then write
+each component as q0 * a + q1 * b. The weight of q1 carries the sign of the dot
+product, which moves q1 into the hemisphere of q0 without a branch.
+*/
+MATHC_KERNEL_BODY void quat_blend_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw,
+									mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* w0,
+									mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, mfloat_t* w1,
+									mfloat_t* a, mfloat_t* b, size_t count)
+{
+	size_t i;
+	for (i = 0; i < count; ++i) rx[i] = x0[i] * a[i] + x1[i] * b[i];
+	for (i = 0; i < count; ++i) ry[i] = y0[i] * a[i] + y1[i] * b[i];
+	for (i = 0; i < count; ++i) rz[i] = z0[i] * a[i] + z1[i] * b[i];
+	for (i = 0; i < count; ++i) rw[i] = w0[i] * a[i] + w1[i] * b[i];
+}
+
+/* Scales the weights so that the blend of q0 and q1 has unit length */
+MATHC_KERNEL_BODY void quat_blend_normalize_n(mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+											  mfloat_t* w0, mfloat_t* x1, mfloat_t* y1,
+											  mfloat_t* z1, mfloat_t* w1, mfloat_t* d,
+											  mfloat_t* a, mfloat_t* b, size_t count)
+{
+	mfloat_t l[MATHC_STREAM_BLOCK];
+	size_t i;
+	for (i = 0; i < count; ++i) {
+		mfloat_t l0 = x0[i] * x0[i] + y0[i] * y0[i] + z0[i] * z0[i] + w0[i] * w0[i];
+		mfloat_t l1 = x1[i] * x1[i] + y1[i] * y1[i] + z1[i] * z1[i] + w1[i] * w1[i];
+		l[i] = a[i] * a[i] * l0 + MFLOAT_C(2.0) * a[i] * b[i] * d[i] + b[i] * b[i] * l1;
+	}
+#if defined(MATHC_USE_FAST_NORMALIZE) && defined(MATHC_HAS_RSQRT)
+	for (i = 0; i + 4 <= count; i += 4) {
+		_mm_storeu_ps(l + i, mathc_rsqrt_ps(_mm_loadu_ps(l + i)));
+	}
+	for (; i < count; ++i) {
+		l[i] = mathc_rsqrt(l[i]);
+	}
+#else
+	for (i = 0; i < count; ++i) {
+		l[i] = MFLOAT_C(1.0) / MATHC_SQRT(l[i]);
+	}
+#endif
+	for (i = 0; i < count; ++i) {
+		a[i] = a[i] * l[i];
+		b[i] = b[i] * l[i];
+	}
+}
+
+MATHC_KERNEL_BODY void quat_dot_n(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+								  mfloat_t* w0, mfloat_t* x1, mfloat_t* y1, mfloat_t* z1,
+								  mfloat_t* w1, size_t count)
+{
+	size_t i;
+	for (i = 0; i < count; ++i) {
+		result[i] = x0[i] * x1[i] + y0[i] * y1[i] + z0[i] * z1[i] + w0[i] * w1[i];
+	}
+}
+
+MATHC_KERNEL_BODY void quat_nlerp_n_body(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw,
+										 mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* w0,
+										 mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, mfloat_t* w1,
+										 mfloat_t f, size_t n)
+{
+	mfloat_t d[MATHC_STREAM_BLOCK];
+	mfloat_t a[MATHC_STREAM_BLOCK];
+	mfloat_t b[MATHC_STREAM_BLOCK];
+	size_t begin;
+	size_t count;
+	size_t i;
+	for (begin = 0; begin < n; begin += count) {
+		count = n - begin < MATHC_STREAM_BLOCK ? n - begin : MATHC_STREAM_BLOCK;
+		quat_dot_n(d, x0 + begin, y0 + begin, z0 + begin, w0 + begin, x1 + begin, y1 + begin,
+				   z1 + begin, w1 + begin, count);
+		for (i = 0; i < count; ++i) {
+			a[i] = MFLOAT_C(1.0) - f;
+			b[i] = mathc_select(d[i] < MFLOAT_C(0.0), -f, f);
+		}
+		quat_blend_normalize_n(x0 + begin, y0 + begin, z0 + begin, w0 + begin, x1 + begin,
+							   y1 + begin, z1 + begin, w1 + begin, d, a, b, count);
+		quat_blend_n(rx + begin, ry + begin, rz + begin, rw + begin, x0 + begin, y0 + begin,
+					 z0 + begin, w0 + begin, x1 + begin, y1 + begin, z1 + begin, w1 + begin, a, b,
+					 count);
+	}
+}
+
+MATHC_KERNEL_BODY void quat_slerp_n_body(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw,
+										 mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* w0,
+										 mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, mfloat_t* w1,
+										 mfloat_t f, size_t n)
+{
+	mfloat_t d[MATHC_STREAM_BLOCK];
+	mfloat_t a[MATHC_STREAM_BLOCK];
+	mfloat_t b[MATHC_STREAM_BLOCK];
+	size_t begin;
+	size_t count;
+	size_t i;
+	for (begin = 0; begin < n; begin += count) {
+		count = n - begin < MATHC_STREAM_BLOCK ? n - begin : MATHC_STREAM_BLOCK;
+		quat_dot_n(d, x0 + begin, y0 + begin, z0 + begin, w0 + begin, x1 + begin, y1 + begin,
+				   z1 + begin, w1 + begin, count);
+		for (i = 0; i < count; ++i) {
+			mfloat_t sign = mathc_select(d[i] < MFLOAT_C(0.0), -MFLOAT_C(1.0), MFLOAT_C(1.0));
+			mfloat_t c = d[i] * sign;
+			mfloat_t theta = MATHC_ACOS(MATHC_SELECT_ARGUMENT(c < MFLOAT_C(1.0), c, MFLOAT_C(1.0)));
+			mfloat_t sin_theta = MATHC_SIN(theta);
+			mfloat_t s0 = MATHC_SIN((MFLOAT_C(1.0) - f) * theta) / sin_theta;
+			mfloat_t s1 = MATHC_SIN(f * theta) / sin_theta;
+			/* Close rotations are interpolated linearly, like quat_slerp() */
+			a[i] = mathc_select(c > MFLOAT_C(0.9995), MFLOAT_C(1.0) - f, s0);
+			b[i] = mathc_select(c > MFLOAT_C(0.9995), f, s1) * sign;
+		}
+		quat_blend_n(rx + begin, ry + begin, rz + begin, rw + begin, x0 + begin, y0 + begin,
+					 z0 + begin, w0 + begin, x1 + begin, y1 + begin, z1 + begin, w1 + begin, a, b,
+					 count);
+	}
+}
+
+/*
+An nlerp with the factor corrected by a polynomial in the factor and the cosine
+of the angle between the rotations, fitted so that the rotation advances at the
+constant rate of a slerp, from "Approximating slerp" by Arseny Kapoulkine.
+*/
+MATHC_KERNEL_BODY void quat_slerp_fast_n_body(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz,
+											  mfloat_t* rw, mfloat_t* x0, mfloat_t* y0,
+											  mfloat_t* z0, mfloat_t* w0, mfloat_t* x1,
+											  mfloat_t* y1, mfloat_t* z1, mfloat_t* w1, mfloat_t f,
+											  size_t n)
+{
+	mfloat_t d[MATHC_STREAM_BLOCK];
+	mfloat_t a[MATHC_STREAM_BLOCK];
+	mfloat_t b[MATHC_STREAM_BLOCK];
+	mfloat_t h = f - MFLOAT_C(0.5);
+	size_t begin;
+	size_t count;
+	size_t i;
+	for (begin = 0; begin < n; begin += count) {
+		count = n - begin < MATHC_STREAM_BLOCK ? n - begin : MATHC_STREAM_BLOCK;
+		quat_dot_n(d, x0 + begin, y0 + begin, z0 + begin, w0 + begin, x1 + begin, y1 + begin,
+				   z1 + begin, w1 + begin, count);
+		for (i = 0; i < count; ++i) {
+			mfloat_t sign = mathc_select(d[i] < MFLOAT_C(0.0), -MFLOAT_C(1.0), MFLOAT_C(1.0));
+			mfloat_t c = d[i] * sign;
+			mfloat_t k0 = MFLOAT_C(1.0904) +
+						  c * (-MFLOAT_C(3.2452) + c * (MFLOAT_C(3.55645) - c * MFLOAT_C(1.43519)));
+			mfloat_t k1 = MFLOAT_C(0.848013) + c * (-MFLOAT_C(1.06021) + c * MFLOAT_C(0.215638));
+			mfloat_t t = f + f * h * (f - MFLOAT_C(1.0)) * (k0 * h * h + k1);
+			a[i] = MFLOAT_C(1.0) - t;
+			b[i] = t * sign;
+		}
+		quat_blend_normalize_n(x0 + begin, y0 + begin, z0 + begin, w0 + begin, x1 + begin,
+							   y1 + begin, z1 + begin, w1 + begin, d, a, b, count);
+		quat_blend_n(rx + begin, ry + begin, rz + begin, rw + begin, x0 + begin, y0 + begin,
+					 z0 + begin, w0 + begin, x1 + begin, y1 + begin, z1 + begin, w1 + begin, a, b,
+					 count);
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(quat_nlerp_n,
+					 (mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw, mfloat_t* x0,
+					  mfloat_t* y0, mfloat_t* z0, mfloat_t* w0, mfloat_t* x1, mfloat_t* y1,
+					  mfloat_t* z1, mfloat_t* w1, mfloat_t f, size_t n),
+					 (rx, ry, rz, rw, x0, y0, z0, w0, x1, y1, z1, w1, f, n))
+MATHC_STREAM_TARGETS(quat_slerp_n,
+					 (mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw, mfloat_t* x0,
+					  mfloat_t* y0, mfloat_t* z0, mfloat_t* w0, mfloat_t* x1, mfloat_t* y1,
+					  mfloat_t* z1, mfloat_t* w1, mfloat_t f, size_t n),
+					 (rx, ry, rz, rw, x0, y0, z0, w0, x1, y1, z1, w1, f, n))
+MATHC_STREAM_TARGETS(quat_slerp_fast_n,
+					 (mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw, mfloat_t* x0,
+					  mfloat_t* y0, mfloat_t* z0, mfloat_t* w0, mfloat_t* x1, mfloat_t* y1,
+					  mfloat_t* z1, mfloat_t* w1, mfloat_t f, size_t n),
+					 (rx, ry, rz, rw, x0, y0, z0, w0, x1, y1, z1, w1, f, n))
+#endif
+
+void quat_nlerp_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw, mfloat_t* x0,
+				  mfloat_t* y0, mfloat_t* z0, mfloat_t* w0, mfloat_t* x1, mfloat_t* y1,
+				  mfloat_t* z1, mfloat_t* w1, mfloat_t f, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->quat_nlerp_n(rx, ry, rz, rw, x0, y0, z0, w0, x1, y1, z1, w1, f, n);
+#else
+	quat_nlerp_n_body(rx, ry, rz, rw, x0, y0, z0, w0, x1, y1, z1, w1, f, n);
+#endif
+}
+
+void quat_slerp_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw, mfloat_t* x0,
+				  mfloat_t* y0, mfloat_t* z0, mfloat_t* w0, mfloat_t* x1, mfloat_t* y1,
+				  mfloat_t* z1, mfloat_t* w1, mfloat_t f, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->quat_slerp_n(rx, ry, rz, rw, x0, y0, z0, w0, x1, y1, z1, w1, f, n);
+#else
+	quat_slerp_n_body(rx, ry, rz, rw, x0, y0, z0, w0, x1, y1, z1, w1, f, n);
+#endif
+}
+
+void quat_slerp_fast_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw, mfloat_t* x0,
+					   mfloat_t* y0, mfloat_t* z0, mfloat_t* w0, mfloat_t* x1, mfloat_t* y1,
+					   mfloat_t* z1, mfloat_t* w1, mfloat_t f, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->quat_slerp_fast_n(rx, ry, rz, rw, x0, y0, z0, w0, x1, y1, z1, w1, f, n);
+#else
+	quat_slerp_fast_n_body(rx, ry, rz, rw, x0, y0, z0, w0, x1, y1, z1, w1, f, n);
+#endif
+}
+
+void quat_rotate_vec3_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* q0, mfloat_t* x0,
+						mfloat_t* y0, mfloat_t* z0, size_t n)
+{
+	mfloat_t m[MAT3_SIZE];
+	mat3_rotation_quat(m, q0);
+	vec3_multiply_mat3_n(rx, ry, rz, x0, y0, z0, m, n);
+}
+
+MATHC_KERNEL_BODY void vec2_angle_n_body(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		result[i] = MATHC_ATAN2(y0[i], x0[i]);
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(vec2_angle_n, (mfloat_t* result, mfloat_t* x0, mfloat_t* y0, size_t n),
+					 (result, x0, y0, n))
+#endif
+
+void vec2_angle_n(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->vec2_angle_n(result, x0, y0, n);
+#else
+	vec2_angle_n_body(result, x0, y0, n);
+#endif
+}
+
+#if defined(MATHC_USE_EASING_FUNCTIONS)
+/* One loop for each curve, so the choice of curve stays out of the loops */
+#define MATHC_EASE_CASE(easing, name) \
+	case easing: \
+		for (i = 0; i < n; ++i) { \
+			result[i] = name##_body(f[i]); \
+		} \
+		break;
+
+MATHC_KERNEL_BODY void mathc_ease_n_body(mfloat_t* result, mfloat_t* f, enum mathc_easing easing,
+										 size_t n)
+{
+	size_t i;
+	switch (easing) {
+		MATHC_EASE_CASE(MATHC_EASING_QUADRATIC_OUT, quadratic_ease_out)
+		MATHC_EASE_CASE(MATHC_EASING_QUADRATIC_IN, quadratic_ease_in)
+		MATHC_EASE_CASE(MATHC_EASING_QUADRATIC_IN_OUT, quadratic_ease_in_out)
+		MATHC_EASE_CASE(MATHC_EASING_CUBIC_OUT, cubic_ease_out)
+		MATHC_EASE_CASE(MATHC_EASING_CUBIC_IN, cubic_ease_in)
+		MATHC_EASE_CASE(MATHC_EASING_CUBIC_IN_OUT, cubic_ease_in_out)
+		MATHC_EASE_CASE(MATHC_EASING_QUARTIC_OUT, quartic_ease_out)
+		MATHC_EASE_CASE(MATHC_EASING_QUARTIC_IN, quartic_ease_in)
+		MATHC_EASE_CASE(MATHC_EASING_QUARTIC_IN_OUT, quartic_ease_in_out)
+		MATHC_EASE_CASE(MATHC_EASING_QUINTIC_OUT, quintic_ease_out)
+		MATHC_EASE_CASE(MATHC_EASING_QUINTIC_IN, quintic_ease_in)
+		MATHC_EASE_CASE(MATHC_EASING_QUINTIC_IN_OUT, quintic_ease_in_out)
+		MATHC_EASE_CASE(MATHC_EASING_SINE_OUT, sine_ease_out)
+		MATHC_EASE_CASE(MATHC_EASING_SINE_IN, sine_ease_in)
+		MATHC_EASE_CASE(MATHC_EASING_SINE_IN_OUT, sine_ease_in_out)
+		MATHC_EASE_CASE(MATHC_EASING_CIRCULAR_OUT, circular_ease_out)
+		MATHC_EASE_CASE(MATHC_EASING_CIRCULAR_IN, circular_ease_in)
+		MATHC_EASE_CASE(MATHC_EASING_CIRCULAR_IN_OUT, circular_ease_in_out)
+		MATHC_EASE_CASE(MATHC_EASING_EXPONENTIAL_OUT, exponential_ease_out)
+		MATHC_EASE_CASE(MATHC_EASING_EXPONENTIAL_IN, exponential_ease_in)
+		MATHC_EASE_CASE(MATHC_EASING_EXPONENTIAL_IN_OUT, exponential_ease_in_out)
+		MATHC_EASE_CASE(MATHC_EASING_ELASTIC_OUT, elastic_ease_out)
+		MATHC_EASE_CASE(MATHC_EASING_ELASTIC_IN, elastic_ease_in)
+		MATHC_EASE_CASE(MATHC_EASING_ELASTIC_IN_OUT, elastic_ease_in_out)
+		MATHC_EASE_CASE(MATHC_EASING_BACK_OUT, back_ease_out)
+		MATHC_EASE_CASE(MATHC_EASING_BACK_IN, back_ease_in)
+		MATHC_EASE_CASE(MATHC_EASING_BACK_IN_OUT, back_ease_in_out)
+		MATHC_EASE_CASE(MATHC_EASING_BOUNCE_OUT, bounce_ease_out)
+		MATHC_EASE_CASE(MATHC_EASING_BOUNCE_IN, bounce_ease_in)
+		MATHC_EASE_CASE(MATHC_EASING_BOUNCE_IN_OUT, bounce_ease_in_out)
+	default:
+		for (i = 0; i < n; ++i) {
+			result[i] = f[i];
+		}
+		break;
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(mathc_ease_n,
+					 (mfloat_t* result, mfloat_t* f, enum mathc_easing easing, size_t n),
+					 (result, f, easing, n))
+#endif
+
+void mathc_ease_n(mfloat_t* result, mfloat_t* f, enum mathc_easing easing, size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->mathc_ease_n(result, f, easing, n);
+#else
+	mathc_ease_n_body(result, f, easing, n);
+#endif
+}
+
+MATHC_KERNEL_BODY void mathc_easing_table_linear_n_body(mfloat_t* result, mfloat_t* f,
+														mfloat_t* table, size_t size, size_t n)
+{
+	int last = (int)size - 2;
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		result[i] = mathc_easing_table_linear_body(table, last, f[i]);
+	}
+}
+
+MATHC_KERNEL_BODY void mathc_easing_table_cubic_n_body(mfloat_t* result, mfloat_t* f,
+													   mfloat_t* table, size_t size, size_t n)
+{
+	int last = (int)size - 2;
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		result[i] = mathc_easing_table_cubic_body(table, last, f[i]);
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(mathc_easing_table_linear_n,
+					 (mfloat_t* result, mfloat_t* f, mfloat_t* table, size_t size, size_t n),
+					 (result, f, table, size, n))
+MATHC_STREAM_TARGETS(mathc_easing_table_cubic_n,
+					 (mfloat_t* result, mfloat_t* f, mfloat_t* table, size_t size, size_t n),
+					 (result, f, table, size, n))
+#endif
+
+void mathc_easing_table_linear_n(mfloat_t* result, mfloat_t* f, mfloat_t* table, size_t size,
+								 size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->mathc_easing_table_linear_n(result, f, table, size, n);
+#else
+	mathc_easing_table_linear_n_body(result, f, table, size, n);
+#endif
+}
+
+void mathc_easing_table_cubic_n(mfloat_t* result, mfloat_t* f, mfloat_t* table, size_t size,
+								size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->mathc_easing_table_cubic_n(result, f, table, size, n);
+#else
+	mathc_easing_table_cubic_n_body(result, f, table, size, n);
+#endif
+}
+
+/*
+Runs the same Newton-Raphson steps on every value, from the chord between the
+samples around it, which is found with selects instead of a search. The values
+where the steps didn't converge are solved again with the scalar solver.
+*/
+MATHC_KERNEL_BODY void mathc_cubic_bezier_ease_n_body(mfloat_t* result, mfloat_t* f,
+													  struct mathc_cubic_bezier* bezier,
+													  size_t n)
+{
+	mfloat_t step = MFLOAT_C(1.0) / (mfloat_t)(MATHC_CUBIC_BEZIER_SAMPLES - 1);
+	mfloat_t ax = bezier->ax;
+	mfloat_t bx = bezier->bx;
+	mfloat_t cx = bezier->cx;
+	mfloat_t ay = bezier->ay;
+	mfloat_t by = bezier->by;
+	mfloat_t cy = bezier->cy;
+	mfloat_t samples[MATHC_CUBIC_BEZIER_SAMPLES];
+	mfloat_t x[MATHC_STREAM_BLOCK];
+	mfloat_t t[MATHC_STREAM_BLOCK];
+	size_t begin;
+	size_t count;
+	size_t i;
+	int k;
+	for (k = 0; k < MATHC_CUBIC_BEZIER_SAMPLES; ++k) {
+		samples[k] = bezier->samples[k];
+	}
+	if (bezier->linear) {
+		for (i = 0; i < n; ++i) {
+			result[i] = mathc_cubic_bezier_ease(bezier, f[i]);
+		}
+		return;
+	}
+	for (begin = 0; begin < n; begin += count) {
+		count = n - begin < MATHC_STREAM_BLOCK ? n - begin : MATHC_STREAM_BLOCK;
+		for (i = 0; i < count; ++i) {
+			mfloat_t v = f[begin + i];
+			v = mathc_select(v > MFLOAT_C(0.0), v, MFLOAT_C(0.0));
+			x[i] = mathc_select(v < MFLOAT_C(1.0), v, MFLOAT_C(1.0));
+		}
+		for (i = 0; i < count; ++i) {
+			mfloat_t low_t = MFLOAT_C(0.0);
+			mfloat_t low_x = samples[0];
+			mfloat_t high_x = samples[1];
+			mfloat_t width;
+			mfloat_t u;
+			for (k = 1; k < MATHC_CUBIC_BEZIER_SAMPLES - 1; ++k) {
+				int above = samples[k] <= x[i];
+				low_t = mathc_select(above, (mfloat_t)k * step, low_t);
+				low_x = mathc_select(above, samples[k], low_x);
+				high_x = mathc_select(above, samples[k + 1], high_x);
+			}
+			width = high_x - low_x;
+			u = low_t + mathc_select(width > MFLOAT_C(0.0), (x[i] - low_x) / width * step,
+									 MFLOAT_C(0.0));
+			for (k = 0; k < MATHC_CUBIC_BEZIER_NEWTON_STEPS; ++k) {
+				mfloat_t error = ((ax * u + bx) * u + cx) * u - x[i];
+				mfloat_t slope = (MFLOAT_C(3.0) * ax * u + MFLOAT_C(2.0) * bx) * u + cx;
+				u = u - mathc_select(slope >= MATHC_CUBIC_BEZIER_NEWTON_SLOPE, error / slope,
+									 MFLOAT_C(0.0));
+			}
+			u = mathc_select(u > MFLOAT_C(0.0), u, MFLOAT_C(0.0));
+			t[i] = mathc_select(u < MFLOAT_C(1.0), u, MFLOAT_C(1.0));
+		}
+		for (i = 0; i < count; ++i) {
+			mfloat_t error = ((ax * t[i] + bx) * t[i] + cx) * t[i] - x[i];
+			if (MFABS(error) > MATHC_CUBIC_BEZIER_TOLERANCE) {
+				t[i] = mathc_cubic_bezier_solve(bezier, x[i]);
+			}
+		}
+		for (i = 0; i < count; ++i) {
+			result[begin + i] = ((ay * t[i] + by) * t[i] + cy) * t[i];
+		}
+	}
+}
+
+#if defined(MATHC_USE_DISPATCH)
+MATHC_STREAM_TARGETS(mathc_cubic_bezier_ease_n,
+					 (mfloat_t* result, mfloat_t* f, struct mathc_cubic_bezier* bezier,
+					  size_t n),
+					 (result, f, bezier, n))
+#endif
+
+void mathc_cubic_bezier_ease_n(mfloat_t* result, mfloat_t* f, struct mathc_cubic_bezier* bezier,
+							   size_t n)
+{
+#if defined(MATHC_USE_DISPATCH)
+	mathc_dispatch_get()->mathc_cubic_bezier_ease_n(result, f, bezier, n);
+#else
+	mathc_cubic_bezier_ease_n_body(result, f, bezier, n);
+#endif
+}
+#endif
+#endif
+
+#if defined(MATHC_USE_FLOATING_POINT)
+#if defined(MATHC_X86)
+static void mathc_cpuid(unsigned int leaf, unsigned int subleaf, unsigned int* registers)
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuidex(info, (int)leaf, (int)subleaf);
+	registers[0] = (unsigned int)info[0];
+	registers[1] = (unsigned int)info[1];
+	registers[2] = (unsigned int)info[2];
+	registers[3] = (unsigned int)info[3];
+#else
+	__cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+}
+
+/* Register state the operating system saves on context switches */
+static unsigned long long mathc_xgetbv(void)
+{
+#if defined(_MSC_VER)
+	return _xgetbv(0);
+#else
+	unsigned int eax;
+	unsigned int edx;
+	__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+#endif
+
+unsigned int mathc_cpu_features(void)
+{
+	unsigned int features = 0;
+#if defined(MATHC_X86)
+	unsigned int registers[4];
+	unsigned int max_leaf;
+	mathc_cpuid(0, 0, registers);
+	max_leaf = registers[0];
+	if (max_leaf >= 1) {
+		unsigned long long xcr0 = 0;
+		bool avx;
+		bool ymm;
+		bool zmm;
+		mathc_cpuid(1, 0, registers);
+		if (registers[2] & (1u << 27)) {
+			xcr0 = mathc_xgetbv();
+		}
+		avx = (registers[2] & (1u << 28)) != 0;
+		ymm = (xcr0 & 0x6) == 0x6;
+		zmm = (xcr0 & 0xE6) == 0xE6;
+		if (registers[2] & (1u << 19)) {
+			features |= MATHC_CPU_SSE41;
+		}
+		if ((registers[2] & (1u << 12)) && avx && ymm) {
+			features |= MATHC_CPU_FMA;
+		}
+		if (max_leaf >= 7) {
+			mathc_cpuid(7, 0, registers);
+			if ((registers[1] & (1u << 5)) && avx && ymm) {
+				features |= MATHC_CPU_AVX2;
+			}
+			if ((registers[1] & (1u << 16)) && zmm) {
+				features |= MATHC_CPU_AVX512F;
+			}
+		}
+	}
+#endif
+	return features;
+}
+
+enum mathc_simd mathc_simd_detect(void)
+{
+#if defined(MATHC_USE_DISPATCH)
+	unsigned int features = mathc_cpu_features();
+	unsigned int avx2 = MATHC_CPU_AVX2 | MATHC_CPU_FMA;
+	unsigned int avx512 = avx2 | MATHC_CPU_AVX512F;
+	if ((features & avx512) == avx512) {
+		return MATHC_SIMD_AVX512;
+	} else if ((features & avx2) == avx2) {
+		return MATHC_SIMD_AVX2;
+	} else if (features & MATHC_CPU_SSE41) {
+		return MATHC_SIMD_SSE;
+	}
+	return MATHC_SIMD_SCALAR;
+#elif defined(MATHC_HAS_AVX2)
+	return MATHC_SIMD_AVX2;
+#elif defined(MATHC_HAS_SSE)
+	return MATHC_SIMD_SSE;
+#else
+	return MATHC_SIMD_SCALAR;
+#endif
+}
+
+enum mathc_simd mathc_simd_get(void)
+{
+#if defined(MATHC_USE_DISPATCH)
+	return mathc_dispatch_get()->simd;
+#else
+	return mathc_simd_detect();
+#endif
+}
+
+#if defined(MATHC_USE_DISPATCH)
+static void mathc_dispatch_fill(struct mathc_dispatch* table, enum mathc_simd simd)
+{
+	table->vec4_multiply_mat4 = vec4_multiply_mat4_scalar;
+	table->quat_slerp = quat_slerp_scalar;
+	table->mat4_multiply = mat4_multiply_scalar;
+	table->mat4_inverse = mat4_inverse_scalar;
+	table->affine_multiply = affine_multiply_scalar;
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+	table->vec3_multiply_mat3_n = vec3_multiply_mat3_n_scalar;
+	table->vec3_cross_n = vec3_cross_n_scalar;
+	table->vec3_normalize_n = vec3_normalize_n_scalar;
+	table->vec3_dot_n = vec3_dot_n_scalar;
+	table->vec3_length_n = vec3_length_n_scalar;
+	table->vec3_distance_n = vec3_distance_n_scalar;
+	table->mat4_rotation_axis_n = mat4_rotation_axis_n_scalar;
+	table->quat_from_axis_angle_n = quat_from_axis_angle_n_scalar;
+	table->quat_nlerp_n = quat_nlerp_n_scalar;
+	table->quat_slerp_n = quat_slerp_n_scalar;
+	table->quat_slerp_fast_n = quat_slerp_fast_n_scalar;
+	table->vec2_angle_n = vec2_angle_n_scalar;
+#if defined(MATHC_USE_EASING_FUNCTIONS)
+	table->mathc_ease_n = mathc_ease_n_scalar;
+	table->mathc_easing_table_linear_n = mathc_easing_table_linear_n_scalar;
+	table->mathc_easing_table_cubic_n = mathc_easing_table_cubic_n_scalar;
+	table->mathc_cubic_bezier_ease_n = mathc_cubic_bezier_ease_n_scalar;
+#endif
+	table->mat4_transform_points_n = mat4_transform_points_n_scalar;
+	table->mat4_transform_directions_n = mat4_transform_directions_n_scalar;
+	table->mat4_multiply_n = mat4_multiply_n_scalar;
+	table->frustum_cull_spheres_n = frustum_cull_spheres_n_scalar;
+	table->frustum_cull_aabbs_n = frustum_cull_aabbs_n_scalar;
+	table->ray_intersect_aabbs_n = ray_intersect_aabbs_n_scalar;
+	table->ray_intersect_triangles_n = ray_intersect_triangles_n_scalar;
+	table->skin_affine_n = skin_affine_n_scalar;
+	table->skin_mat4_n = skin_mat4_n_scalar;
+	table->skin_dualquat_n = skin_dualquat_n_scalar;
+	table->mat4_from_transform_hierarchy_n = mat4_from_transform_hierarchy_n_scalar;
+#endif
+	if (simd >= MATHC_SIMD_SSE) {
+		table->vec4_multiply_mat4 = vec4_multiply_mat4_sse;
+		table->quat_slerp = quat_slerp_sse;
+		table->mat4_multiply = mat4_multiply_sse;
+		table->mat4_inverse = mat4_inverse_sse;
+		table->affine_multiply = affine_multiply_sse;
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+		table->mat4_transform_points_n = mat4_transform_points_n_sse;
+		table->mat4_transform_directions_n = mat4_transform_directions_n_sse;
+		table->mat4_multiply_n = mat4_multiply_n_sse;
+		table->skin_affine_n = skin_affine_n_sse;
+		table->skin_mat4_n = skin_mat4_n_sse;
+		table->skin_dualquat_n = skin_dualquat_n_sse;
+		table->mat4_from_transform_hierarchy_n = mat4_from_transform_hierarchy_n_sse;
+#endif
+	}
+	if (simd >= MATHC_SIMD_AVX2) {
+		table->vec4_multiply_mat4 = vec4_multiply_mat4_avx2;
+		table->mat4_multiply = mat4_multiply_avx2;
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+		table->vec3_multiply_mat3_n = vec3_multiply_mat3_n_avx2;
+		table->vec3_cross_n = vec3_cross_n_avx2;
+		table->vec3_normalize_n = vec3_normalize_n_avx2;
+		table->vec3_dot_n = vec3_dot_n_avx2;
+		table->vec3_length_n = vec3_length_n_avx2;
+		table->vec3_distance_n = vec3_distance_n_avx2;
+		table->mat4_rotation_axis_n = mat4_rotation_axis_n_avx2;
+		table->quat_from_axis_angle_n = quat_from_axis_angle_n_avx2;
+		table->quat_nlerp_n = quat_nlerp_n_avx2;
+		table->quat_slerp_n = quat_slerp_n_avx2;
+		table->quat_slerp_fast_n = quat_slerp_fast_n_avx2;
+		table->vec2_angle_n = vec2_angle_n_avx2;
+#if defined(MATHC_USE_EASING_FUNCTIONS)
+		table->mathc_ease_n = mathc_ease_n_avx2;
+		table->mathc_easing_table_linear_n = mathc_easing_table_linear_n_avx2;
+		table->mathc_easing_table_cubic_n = mathc_easing_table_cubic_n_avx2;
+		table->mathc_cubic_bezier_ease_n = mathc_cubic_bezier_ease_n_avx2;
+#endif
+		table->mat4_transform_points_n = mat4_transform_points_n_avx2;
+		table->mat4_transform_directions_n = mat4_transform_directions_n_avx2;
+		table->mat4_multiply_n = mat4_multiply_n_avx2;
+		table->frustum_cull_spheres_n = frustum_cull_spheres_n_avx2;
+		table->frustum_cull_aabbs_n = frustum_cull_aabbs_n_avx2;
+		table->ray_intersect_aabbs_n = ray_intersect_aabbs_n_avx2;
+		table->ray_intersect_triangles_n = ray_intersect_triangles_n_avx2;
+		table->skin_dualquat_n = skin_dualquat_n_avx2;
+		table->mat4_from_transform_hierarchy_n = mat4_from_transform_hierarchy_n_avx2;
+#endif
+	}
+	if (simd >= MATHC_SIMD_AVX512) {
+		table->mat4_multiply = mat4_multiply_avx512;
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+		table->vec3_multiply_mat3_n = vec3_multiply_mat3_n_avx512;
+		table->vec3_cross_n = vec3_cross_n_avx512;
+		table->vec3_normalize_n = vec3_normalize_n_avx512;
+		table->vec3_dot_n = vec3_dot_n_avx512;
+		table->vec3_length_n = vec3_length_n_avx512;
+		table->vec3_distance_n = vec3_distance_n_avx512;
+		table->mat4_rotation_axis_n = mat4_rotation_axis_n_avx512;
+		table->quat_from_axis_angle_n = quat_from_axis_angle_n_avx512;
+		table->quat_nlerp_n = quat_nlerp_n_avx512;
+		table->quat_slerp_n = quat_slerp_n_avx512;
+		table->quat_slerp_fast_n = quat_slerp_fast_n_avx512;
+		table->vec2_angle_n = vec2_angle_n_avx512;
+#if defined(MATHC_USE_EASING_FUNCTIONS)
+		table->mathc_ease_n = mathc_ease_n_avx512;
+		table->mathc_easing_table_linear_n = mathc_easing_table_linear_n_avx512;
+		table->mathc_easing_table_cubic_n = mathc_easing_table_cubic_n_avx512;
+		table->mathc_cubic_bezier_ease_n = mathc_cubic_bezier_ease_n_avx512;
+#endif
+		table->mat4_multiply_n = mat4_multiply_n_avx512;
+		table->frustum_cull_spheres_n = frustum_cull_spheres_n_avx512;
+		table->frustum_cull_aabbs_n = frustum_cull_aabbs_n_avx512;
+		table->ray_intersect_aabbs_n = ray_intersect_aabbs_n_avx512;
+		table->ray_intersect_triangles_n = ray_intersect_triangles_n_avx512;
+#endif
+	}
+	table->simd = simd;
+}
+#endif
+
+bool mathc_simd_set(enum mathc_simd simd)
 {
-	mfloat_t range = MTAN(fov_y * MFLOAT_C(0.5)) * n;
-	mfloat_t left = -range * aspect;
-	mfloat_t right = range * aspect;
-	mfloat_t top = range;
-	mfloat_t bottom = -range;
-	result[0] = MFLOAT_C(2.0) * n / (right - left);
-	result[1] = MFLOAT_C(0.0);
-	result[2] = MFLOAT_C(0.0);
-	result[3] = MFLOAT_C(0.0);
-	result[4] = MFLOAT_C(0.0);
-	result[5] = MFLOAT_C(2.0) * n / (top - bottom);
-	result[6] = MFLOAT_C(0.0);
-	result[7] = MFLOAT_C(0.0);
-	result[8] = MFLOAT_C(0.0);
-	result[9] = MFLOAT_C(0.0);
-	result[10] = -MFLOAT_C(1.0);
-	result[11] = -MFLOAT_C(1.0);
-	result[12] = MFLOAT_C(0.0);
-	result[13] = MFLOAT_C(0.0);
-	result[14] = -MFLOAT_C(2.0) * n;
-	result[15] = MFLOAT_C(0.0);
-	return result;
+#if defined(MATHC_USE_DISPATCH)
+	if (simd < MATHC_SIMD_SCALAR || simd > mathc_simd_detect()) {
+		return false;
+	}
+	/* Runs the first fill now, so it can't replace the tier chosen here later */
+	mathc_dispatch_get();
+	MATHC_DISPATCH_PUBLISH(&mathc_dispatch_tables[simd]);
+	return true;
+#else
+	return simd == mathc_simd_detect();
+#endif
 }
 #endif
 
@@ -4021,15 +8212,14 @@ bool svec2_is_equal(struct vec2 v0, struct vec2 v1)
 struct vec2 svec2(mfloat_t x, mfloat_t y)
 {
 	struct vec2 result;
-	vec2((mfloat_t*)&result, x, y);
+	result.x = x;
+	result.y = y;
 	return result;
 }
 
 struct vec2 svec2_assign(struct vec2 v0)
 {
-	struct vec2 result;
-	vec2_assign((mfloat_t*)&result, (mfloat_t*)&v0);
-	return result;
+	return v0;
 }
 
 #if defined(MATHC_USE_INT)
@@ -4044,14 +8234,16 @@ struct vec2 svec2_assign_vec2i(struct vec2i v0)
 struct vec2 svec2_zero(void)
 {
 	struct vec2 result;
-	vec2_zero((mfloat_t*)&result);
+	result.x = MFLOAT_C(0.0);
+	result.y = MFLOAT_C(0.0);
 	return result;
 }
 
 struct vec2 svec2_one(void)
 {
 	struct vec2 result;
-	vec2_one((mfloat_t*)&result);
+	result.x = MFLOAT_C(1.0);
+	result.y = MFLOAT_C(1.0);
 	return result;
 }
 
@@ -4065,63 +8257,72 @@ struct vec2 svec2_sign(struct vec2 v0)
 struct vec2 svec2_add(struct vec2 v0, struct vec2 v1)
 {
 	struct vec2 result;
-	vec2_add((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = v0.x + v1.x;
+	result.y = v0.y + v1.y;
 	return result;
 }
 
 struct vec2 svec2_add_f(struct vec2 v0, mfloat_t f)
 {
 	struct vec2 result;
-	vec2_add_f((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	result.x = v0.x + f;
+	result.y = v0.y + f;
 	return result;
 }
 
 struct vec2 svec2_subtract(struct vec2 v0, struct vec2 v1)
 {
 	struct vec2 result;
-	vec2_subtract((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = v0.x - v1.x;
+	result.y = v0.y - v1.y;
 	return result;
 }
 
 struct vec2 svec2_subtract_f(struct vec2 v0, mfloat_t f)
 {
 	struct vec2 result;
-	vec2_subtract_f((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	result.x = v0.x - f;
+	result.y = v0.y - f;
 	return result;
 }
 
 struct vec2 svec2_multiply(struct vec2 v0, struct vec2 v1)
 {
 	struct vec2 result;
-	vec2_multiply((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = v0.x * v1.x;
+	result.y = v0.y * v1.y;
 	return result;
 }
 
 struct vec2 svec2_multiply_f(struct vec2 v0, mfloat_t f)
 {
 	struct vec2 result;
-	vec2_multiply_f((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	result.x = v0.x * f;
+	result.y = v0.y * f;
 	return result;
 }
 
 struct vec2 svec2_multiply_mat2(struct vec2 v0, struct mat2 m0)
 {
 	struct vec2 result;
-	vec2_multiply_mat2((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&m0);
+	result.x = m0.m11 * v0.x + m0.m12 * v0.y;
+	result.y = m0.m21 * v0.x + m0.m22 * v0.y;
 	return result;
 }
 
 struct vec2 svec2_divide(struct vec2 v0, struct vec2 v1)
 {
 	struct vec2 result;
-	vec2_divide((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = v0.x / v1.x;
+	result.y = v0.y / v1.y;
 	return result;
 }
 
 struct vec2 svec2_divide_f(struct vec2 v0, mfloat_t f)
 {
 	struct vec2 result;
-	vec2_divide_f((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	result.x = v0.x / f;
+	result.y = v0.y / f;
 	return result;
 }
 
@@ -4142,69 +8343,92 @@ struct vec2 svec2_snap_f(struct vec2 v0, mfloat_t f)
 struct vec2 svec2_negative(struct vec2 v0)
 {
 	struct vec2 result;
-	vec2_negative((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = -v0.x;
+	result.y = -v0.y;
 	return result;
 }
 
 struct vec2 svec2_abs(struct vec2 v0)
 {
 	struct vec2 result;
-	vec2_abs((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = MFABS(v0.x);
+	result.y = MFABS(v0.y);
 	return result;
 }
 
 struct vec2 svec2_floor(struct vec2 v0)
 {
 	struct vec2 result;
-	vec2_floor((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = MFLOOR(v0.x);
+	result.y = MFLOOR(v0.y);
 	return result;
 }
 
 struct vec2 svec2_ceil(struct vec2 v0)
 {
 	struct vec2 result;
-	vec2_ceil((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = MCEIL(v0.x);
+	result.y = MCEIL(v0.y);
 	return result;
 }
 
 struct vec2 svec2_round(struct vec2 v0)
 {
 	struct vec2 result;
-	vec2_round((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = MROUND(v0.x);
+	result.y = MROUND(v0.y);
 	return result;
 }
 
 struct vec2 svec2_max(struct vec2 v0, struct vec2 v1)
 {
 	struct vec2 result;
-	vec2_max((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = MFMAX(v0.x, v1.x);
+	result.y = MFMAX(v0.y, v1.y);
 	return result;
 }
 
 struct vec2 svec2_min(struct vec2 v0, struct vec2 v1)
 {
 	struct vec2 result;
-	vec2_min((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = MFMIN(v0.x, v1.x);
+	result.y = MFMIN(v0.y, v1.y);
 	return result;
 }
 
 struct vec2 svec2_clamp(struct vec2 v0, struct vec2 v1, struct vec2 v2)
 {
 	struct vec2 result;
-	vec2_clamp((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1, (mfloat_t*)&v2);
+	result.x = MFMIN(MFMAX(v0.x, v1.x), v2.x);
+	result.y = MFMIN(MFMAX(v0.y, v1.y), v2.y);
 	return result;
 }
 
 struct vec2 svec2_normalize(struct vec2 v0)
+{
+#if defined(MATHC_USE_FAST_NORMALIZE)
+	return svec2_normalize_fast(v0);
+#else
+	struct vec2 result;
+	mfloat_t l = MSQRT(v0.x * v0.x + v0.y * v0.y);
+	result.x = v0.x / l;
+	result.y = v0.y / l;
+	return result;
+#endif
+}
+
+struct vec2 svec2_normalize_fast(struct vec2 v0)
 {
 	struct vec2 result;
-	vec2_normalize((mfloat_t*)&result, (mfloat_t*)&v0);
+	mfloat_t l = mathc_rsqrt(v0.x * v0.x + v0.y * v0.y);
+	result.x = v0.x * l;
+	result.y = v0.y * l;
 	return result;
 }
 
 mfloat_t svec2_dot(struct vec2 v0, struct vec2 v1)
 {
-	return vec2_dot((mfloat_t*)&v0, (mfloat_t*)&v1);
+	return v0.x * v1.x + v0.y * v1.y;
 }
 
 struct vec2 svec2_project(struct vec2 v0, struct vec2 v1)
@@ -4231,7 +8455,8 @@ struct vec2 svec2_reflect(struct vec2 v0, struct vec2 normal)
 struct vec2 svec2_tangent(struct vec2 v0)
 {
 	struct vec2 result;
-	vec2_tangent((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = v0.y;
+	result.y = -v0.x;
 	return result;
 }
 
@@ -4245,7 +8470,8 @@ struct vec2 svec2_rotate(struct vec2 v0, mfloat_t f)
 struct vec2 svec2_lerp(struct vec2 v0, struct vec2 v1, mfloat_t f)
 {
 	struct vec2 result;
-	vec2_lerp((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1, f);
+	result.x = v0.x + (v1.x - v0.x) * f;
+	result.y = v0.y + (v1.y - v0.y) * f;
 	return result;
 }
 
@@ -4272,22 +8498,22 @@ mfloat_t svec2_angle(struct vec2 v0)
 
 mfloat_t svec2_length(struct vec2 v0)
 {
-	return vec2_length((mfloat_t*)&v0);
+	return MSQRT(v0.x * v0.x + v0.y * v0.y);
 }
 
 mfloat_t svec2_length_squared(struct vec2 v0)
 {
-	return vec2_length_squared((mfloat_t*)&v0);
+	return v0.x * v0.x + v0.y * v0.y;
 }
 
 mfloat_t svec2_distance(struct vec2 v0, struct vec2 v1)
 {
-	return vec2_distance((mfloat_t*)&v0, (mfloat_t*)&v1);
+	return MSQRT((v0.x - v1.x) * (v0.x - v1.x) + (v0.y - v1.y) * (v0.y - v1.y));
 }
 
 mfloat_t svec2_distance_squared(struct vec2 v0, struct vec2 v1)
 {
-	return vec2_distance_squared((mfloat_t*)&v0, (mfloat_t*)&v1);
+	return (v0.x - v1.x) * (v0.x - v1.x) + (v0.y - v1.y) * (v0.y - v1.y);
 }
 
 bool svec3_is_zero(struct vec3 v0)
@@ -4303,15 +8529,15 @@ bool svec3_is_equal(struct vec3 v0, struct vec3 v1)
 struct vec3 svec3(mfloat_t x, mfloat_t y, mfloat_t z)
 {
 	struct vec3 result;
-	vec3((mfloat_t*)&result, x, y, z);
+	result.x = x;
+	result.y = y;
+	result.z = z;
 	return result;
 }
 
 struct vec3 svec3_assign(struct vec3 v0)
 {
-	struct vec3 result;
-	vec3_assign((mfloat_t*)&result, (mfloat_t*)&v0);
-	return result;
+	return v0;
 }
 
 #if defined(MATHC_USE_INT)
@@ -4326,14 +8552,18 @@ struct vec3 svec3_assign_vec3i(struct vec3i v0)
 struct vec3 svec3_zero(void)
 {
 	struct vec3 result;
-	vec3_zero((mfloat_t*)&result);
+	result.x = MFLOAT_C(0.0);
+	result.y = MFLOAT_C(0.0);
+	result.z = MFLOAT_C(0.0);
 	return result;
 }
 
 struct vec3 svec3_one(void)
 {
 	struct vec3 result;
-	vec3_one((mfloat_t*)&result);
+	result.x = MFLOAT_C(1.0);
+	result.y = MFLOAT_C(1.0);
+	result.z = MFLOAT_C(1.0);
 	return result;
 }
 
@@ -4347,63 +8577,81 @@ struct vec3 svec3_sign(struct vec3 v0)
 struct vec3 svec3_add(struct vec3 v0, struct vec3 v1)
 {
 	struct vec3 result;
-	vec3_add((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = v0.x + v1.x;
+	result.y = v0.y + v1.y;
+	result.z = v0.z + v1.z;
 	return result;
 }
 
 struct vec3 svec3_add_f(struct vec3 v0, mfloat_t f)
 {
 	struct vec3 result;
-	vec3_add_f((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	result.x = v0.x + f;
+	result.y = v0.y + f;
+	result.z = v0.z + f;
 	return result;
 }
 
 struct vec3 svec3_subtract(struct vec3 v0, struct vec3 v1)
 {
 	struct vec3 result;
-	vec3_subtract((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = v0.x - v1.x;
+	result.y = v0.y - v1.y;
+	result.z = v0.z - v1.z;
 	return result;
 }
 
 struct vec3 svec3_subtract_f(struct vec3 v0, mfloat_t f)
 {
 	struct vec3 result;
-	vec3_subtract_f((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	result.x = v0.x - f;
+	result.y = v0.y - f;
+	result.z = v0.z - f;
 	return result;
 }
 
 struct vec3 svec3_multiply(struct vec3 v0, struct vec3 v1)
 {
 	struct vec3 result;
-	vec3_multiply((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = v0.x * v1.x;
+	result.y = v0.y * v1.y;
+	result.z = v0.z * v1.z;
 	return result;
 }
 
 struct vec3 svec3_multiply_f(struct vec3 v0, mfloat_t f)
 {
 	struct vec3 result;
-	vec3_multiply_f((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	result.x = v0.x * f;
+	result.y = v0.y * f;
+	result.z = v0.z * f;
 	return result;
 }
 
 struct vec3 svec3_multiply_mat3(struct vec3 v0, struct mat3 m0)
 {
 	struct vec3 result;
-	vec3_multiply_mat3((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&m0);
+	result.x = m0.m11 * v0.x + m0.m12 * v0.y + m0.m13 * v0.z;
+	result.y = m0.m21 * v0.x + m0.m22 * v0.y + m0.m23 * v0.z;
+	result.z = m0.m31 * v0.x + m0.m32 * v0.y + m0.m33 * v0.z;
 	return result;
 }
 
 struct vec3 svec3_divide(struct vec3 v0, struct vec3 v1)
 {
 	struct vec3 result;
-	vec3_divide((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = v0.x / v1.x;
+	result.y = v0.y / v1.y;
+	result.z = v0.z / v1.z;
 	return result;
 }
 
 struct vec3 svec3_divide_f(struct vec3 v0, mfloat_t f)
 {
 	struct vec3 result;
-	vec3_divide_f((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	result.x = v0.x / f;
+	result.y = v0.y / f;
+	result.z = v0.z / f;
 	return result;
 }
 
@@ -4424,76 +8672,111 @@ struct vec3 svec3_snap_f(struct vec3 v0, mfloat_t f)
 struct vec3 svec3_negative(struct vec3 v0)
 {
 	struct vec3 result;
-	vec3_negative((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = -v0.x;
+	result.y = -v0.y;
+	result.z = -v0.z;
 	return result;
 }
 
 struct vec3 svec3_abs(struct vec3 v0)
 {
 	struct vec3 result;
-	vec3_abs((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = MFABS(v0.x);
+	result.y = MFABS(v0.y);
+	result.z = MFABS(v0.z);
 	return result;
 }
 
 struct vec3 svec3_floor(struct vec3 v0)
 {
 	struct vec3 result;
-	vec3_floor((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = MFLOOR(v0.x);
+	result.y = MFLOOR(v0.y);
+	result.z = MFLOOR(v0.z);
 	return result;
 }
 
 struct vec3 svec3_ceil(struct vec3 v0)
 {
 	struct vec3 result;
-	vec3_ceil((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = MCEIL(v0.x);
+	result.y = MCEIL(v0.y);
+	result.z = MCEIL(v0.z);
 	return result;
 }
 
 struct vec3 svec3_round(struct vec3 v0)
 {
 	struct vec3 result;
-	vec3_round((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = MROUND(v0.x);
+	result.y = MROUND(v0.y);
+	result.z = MROUND(v0.z);
 	return result;
 }
 
 struct vec3 svec3_max(struct vec3 v0, struct vec3 v1)
 {
 	struct vec3 result;
-	vec3_max((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = MFMAX(v0.x, v1.x);
+	result.y = MFMAX(v0.y, v1.y);
+	result.z = MFMAX(v0.z, v1.z);
 	return result;
 }
 
 struct vec3 svec3_min(struct vec3 v0, struct vec3 v1)
 {
 	struct vec3 result;
-	vec3_min((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = MFMIN(v0.x, v1.x);
+	result.y = MFMIN(v0.y, v1.y);
+	result.z = MFMIN(v0.z, v1.z);
 	return result;
 }
 
 struct vec3 svec3_clamp(struct vec3 v0, struct vec3 v1, struct vec3 v2)
 {
 	struct vec3 result;
-	vec3_clamp((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1, (mfloat_t*)&v2);
+	result.x = MFMIN(MFMAX(v0.x, v1.x), v2.x);
+	result.y = MFMIN(MFMAX(v0.y, v1.y), v2.y);
+	result.z = MFMIN(MFMAX(v0.z, v1.z), v2.z);
 	return result;
 }
 
 struct vec3 svec3_cross(struct vec3 v0, struct vec3 v1)
 {
 	struct vec3 result;
-	vec3_cross((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = v0.y * v1.z - v0.z * v1.y;
+	result.y = v0.z * v1.x - v0.x * v1.z;
+	result.z = v0.x * v1.y - v0.y * v1.x;
 	return result;
 }
 
 struct vec3 svec3_normalize(struct vec3 v0)
+{
+#if defined(MATHC_USE_FAST_NORMALIZE)
+	return svec3_normalize_fast(v0);
+#else
+	struct vec3 result;
+	mfloat_t l = MSQRT(v0.x * v0.x + v0.y * v0.y + v0.z * v0.z);
+	result.x = v0.x / l;
+	result.y = v0.y / l;
+	result.z = v0.z / l;
+	return result;
+#endif
+}
+
+struct vec3 svec3_normalize_fast(struct vec3 v0)
 {
 	struct vec3 result;
-	vec3_normalize((mfloat_t*)&result, (mfloat_t*)&v0);
+	mfloat_t l = mathc_rsqrt(v0.x * v0.x + v0.y * v0.y + v0.z * v0.z);
+	result.x = v0.x * l;
+	result.y = v0.y * l;
+	result.z = v0.z * l;
 	return result;
 }
 
 mfloat_t svec3_dot(struct vec3 v0, struct vec3 v1)
 {
-	return vec3_dot((mfloat_t*)&v0, (mfloat_t*)&v1);
+	return v0.x * v1.x + v0.y * v1.y + v0.z * v1.z;
 }
 
 struct vec3 svec3_project(struct vec3 v0, struct vec3 v1)
@@ -4529,7 +8812,9 @@ struct vec3 svec3_rotate(struct vec3 v0, struct vec3 rotation_axis, mfloat_t f)
 struct vec3 svec3_lerp(struct vec3 v0, struct vec3 v1, mfloat_t f)
 {
 	struct vec3 result;
-	vec3_lerp((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1, f);
+	result.x = v0.x + (v1.x - v0.x) * f;
+	result.y = v0.y + (v1.y - v0.y) * f;
+	result.z = v0.z + (v1.z - v0.z) * f;
 	return result;
 }
 
@@ -4551,22 +8836,24 @@ struct vec3 svec3_bezier4(struct vec3 v0, struct vec3 v1, struct vec3 v2, struct
 
 mfloat_t svec3_length(struct vec3 v0)
 {
-	return vec3_length((mfloat_t*)&v0);
+	return MSQRT(v0.x * v0.x + v0.y * v0.y + v0.z * v0.z);
 }
 
 mfloat_t svec3_length_squared(struct vec3 v0)
 {
-	return vec3_length_squared((mfloat_t*)&v0);
+	return v0.x * v0.x + v0.y * v0.y + v0.z * v0.z;
 }
 
 mfloat_t svec3_distance(struct vec3 v0, struct vec3 v1)
 {
-	return vec3_distance((mfloat_t*)&v0, (mfloat_t*)&v1);
+	return MSQRT((v0.x - v1.x) * (v0.x - v1.x) + (v0.y - v1.y) * (v0.y - v1.y) +
+				 (v0.z - v1.z) * (v0.z - v1.z));
 }
 
 mfloat_t svec3_distance_squared(struct vec3 v0, struct vec3 v1)
 {
-	return vec3_distance_squared((mfloat_t*)&v0, (mfloat_t*)&v1);
+	return (v0.x - v1.x) * (v0.x - v1.x) + (v0.y - v1.y) * (v0.y - v1.y) +
+		   (v0.z - v1.z) * (v0.z - v1.z);
 }
 
 bool svec4_is_zero(struct vec4 v0)
@@ -4582,15 +8869,16 @@ bool svec4_is_equal(struct vec4 v0, struct vec4 v1)
 struct vec4 svec4(mfloat_t x, mfloat_t y, mfloat_t z, mfloat_t w)
 {
 	struct vec4 result;
-	vec4((mfloat_t*)&result, x, y, z, w);
+	result.x = x;
+	result.y = y;
+	result.z = z;
+	result.w = w;
 	return result;
 }
 
 struct vec4 svec4_assign(struct vec4 v0)
 {
-	struct vec4 result;
-	vec4_assign((mfloat_t*)&result, (mfloat_t*)&v0);
-	return result;
+	return v0;
 }
 
 #if defined(MATHC_USE_INT)
@@ -4605,14 +8893,20 @@ struct vec4 svec4_assign_vec4i(struct vec4i v0)
 struct vec4 svec4_zero(void)
 {
 	struct vec4 result;
-	vec4_zero((mfloat_t*)&result);
+	result.x = MFLOAT_C(0.0);
+	result.y = MFLOAT_C(0.0);
+	result.z = MFLOAT_C(0.0);
+	result.w = MFLOAT_C(0.0);
 	return result;
 }
 
 struct vec4 svec4_one(void)
 {
 	struct vec4 result;
-	vec4_one((mfloat_t*)&result);
+	result.x = MFLOAT_C(1.0);
+	result.y = MFLOAT_C(1.0);
+	result.z = MFLOAT_C(1.0);
+	result.w = MFLOAT_C(1.0);
 	return result;
 }
 
@@ -4626,42 +8920,60 @@ struct vec4 svec4_sign(struct vec4 v0)
 struct vec4 svec4_add(struct vec4 v0, struct vec4 v1)
 {
 	struct vec4 result;
-	vec4_add((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = v0.x + v1.x;
+	result.y = v0.y + v1.y;
+	result.z = v0.z + v1.z;
+	result.w = v0.w + v1.w;
 	return result;
 }
 
 struct vec4 svec4_add_f(struct vec4 v0, mfloat_t f)
 {
 	struct vec4 result;
-	vec4_add_f((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	result.x = v0.x + f;
+	result.y = v0.y + f;
+	result.z = v0.z + f;
+	result.w = v0.w + f;
 	return result;
 }
 
 struct vec4 svec4_subtract(struct vec4 v0, struct vec4 v1)
 {
 	struct vec4 result;
-	vec4_subtract((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = v0.x - v1.x;
+	result.y = v0.y - v1.y;
+	result.z = v0.z - v1.z;
+	result.w = v0.w - v1.w;
 	return result;
 }
 
 struct vec4 svec4_subtract_f(struct vec4 v0, mfloat_t f)
 {
 	struct vec4 result;
-	vec4_subtract_f((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	result.x = v0.x - f;
+	result.y = v0.y - f;
+	result.z = v0.z - f;
+	result.w = v0.w - f;
 	return result;
 }
 
 struct vec4 svec4_multiply(struct vec4 v0, struct vec4 v1)
 {
 	struct vec4 result;
-	vec4_multiply((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = v0.x * v1.x;
+	result.y = v0.y * v1.y;
+	result.z = v0.z * v1.z;
+	result.w = v0.w * v1.w;
 	return result;
 }
 
 struct vec4 svec4_multiply_f(struct vec4 v0, mfloat_t f)
 {
 	struct vec4 result;
-	vec4_multiply_f((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	result.x = v0.x * f;
+	result.y = v0.y * f;
+	result.z = v0.z * f;
+	result.w = v0.w * f;
 	return result;
 }
 
@@ -4675,14 +8987,20 @@ struct vec4 svec4_multiply_mat4(struct vec4 v0, struct mat4 m0)
 struct vec4 svec4_divide(struct vec4 v0, struct vec4 v1)
 {
 	struct vec4 result;
-	vec4_divide((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = v0.x / v1.x;
+	result.y = v0.y / v1.y;
+	result.z = v0.z / v1.z;
+	result.w = v0.w / v1.w;
 	return result;
 }
 
 struct vec4 svec4_divide_f(struct vec4 v0, mfloat_t f)
 {
 	struct vec4 result;
-	vec4_divide_f((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	result.x = v0.x / f;
+	result.y = v0.y / f;
+	result.z = v0.z / f;
+	result.w = v0.w / f;
 	return result;
 }
 
@@ -4703,70 +9021,116 @@ struct vec4 svec4_snap_f(struct vec4 v0, mfloat_t f)
 struct vec4 svec4_negative(struct vec4 v0)
 {
 	struct vec4 result;
-	vec4_negative((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = -v0.x;
+	result.y = -v0.y;
+	result.z = -v0.z;
+	result.w = -v0.w;
 	return result;
 }
 
 struct vec4 svec4_abs(struct vec4 v0)
 {
 	struct vec4 result;
-	vec4_abs((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = MFABS(v0.x);
+	result.y = MFABS(v0.y);
+	result.z = MFABS(v0.z);
+	result.w = MFABS(v0.w);
 	return result;
 }
 
 struct vec4 svec4_floor(struct vec4 v0)
 {
 	struct vec4 result;
-	vec4_floor((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = MFLOOR(v0.x);
+	result.y = MFLOOR(v0.y);
+	result.z = MFLOOR(v0.z);
+	result.w = MFLOOR(v0.w);
 	return result;
 }
 
 struct vec4 svec4_ceil(struct vec4 v0)
 {
 	struct vec4 result;
-	vec4_ceil((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = MCEIL(v0.x);
+	result.y = MCEIL(v0.y);
+	result.z = MCEIL(v0.z);
+	result.w = MCEIL(v0.w);
 	return result;
 }
 
 struct vec4 svec4_round(struct vec4 v0)
 {
 	struct vec4 result;
-	vec4_round((mfloat_t*)&result, (mfloat_t*)&v0);
+	result.x = MROUND(v0.x);
+	result.y = MROUND(v0.y);
+	result.z = MROUND(v0.z);
+	result.w = MROUND(v0.w);
 	return result;
 }
 
 struct vec4 svec4_max(struct vec4 v0, struct vec4 v1)
 {
 	struct vec4 result;
-	vec4_max((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = MFMAX(v0.x, v1.x);
+	result.y = MFMAX(v0.y, v1.y);
+	result.z = MFMAX(v0.z, v1.z);
+	result.w = MFMAX(v0.w, v1.w);
 	return result;
 }
 
 struct vec4 svec4_min(struct vec4 v0, struct vec4 v1)
 {
 	struct vec4 result;
-	vec4_min((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1);
+	result.x = MFMIN(v0.x, v1.x);
+	result.y = MFMIN(v0.y, v1.y);
+	result.z = MFMIN(v0.z, v1.z);
+	result.w = MFMIN(v0.w, v1.w);
 	return result;
 }
 
 struct vec4 svec4_clamp(struct vec4 v0, struct vec4 v1, struct vec4 v2)
 {
 	struct vec4 result;
-	vec4_clamp((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1, (mfloat_t*)&v2);
+	result.x = MFMIN(MFMAX(v0.x, v1.x), v2.x);
+	result.y = MFMIN(MFMAX(v0.y, v1.y), v2.y);
+	result.z = MFMIN(MFMAX(v0.z, v1.z), v2.z);
+	result.w = MFMIN(MFMAX(v0.w, v1.w), v2.w);
 	return result;
 }
 
 struct vec4 svec4_normalize(struct vec4 v0)
+{
+#if defined(MATHC_USE_FAST_NORMALIZE)
+	return svec4_normalize_fast(v0);
+#else
+	struct vec4 result;
+	mfloat_t l = MSQRT(v0.x * v0.x + v0.y * v0.y + v0.z * v0.z + v0.w * v0.w);
+	result.x = v0.x / l;
+	result.y = v0.y / l;
+	result.z = v0.z / l;
+	result.w = v0.w / l;
+	return result;
+#endif
+}
+
+struct vec4 svec4_normalize_fast(struct vec4 v0)
 {
 	struct vec4 result;
-	vec4_normalize((mfloat_t*)&result, (mfloat_t*)&v0);
+	mfloat_t l = mathc_rsqrt(v0.x * v0.x + v0.y * v0.y + v0.z * v0.z + v0.w * v0.w);
+	result.x = v0.x * l;
+	result.y = v0.y * l;
+	result.z = v0.z * l;
+	result.w = v0.w * l;
 	return result;
 }
 
 struct vec4 svec4_lerp(struct vec4 v0, struct vec4 v1, mfloat_t f)
 {
 	struct vec4 result;
-	vec4_lerp((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&v1, f);
+	result.x = v0.x + (v1.x - v0.x) * f;
+	result.y = v0.y + (v1.y - v0.y) * f;
+	result.z = v0.z + (v1.z - v0.z) * f;
+	result.w = v0.w + (v1.w - v0.w) * f;
 	return result;
 }
 
@@ -4783,42 +9147,55 @@ bool squat_is_equal(struct quat q0, struct quat q1)
 struct quat squat(mfloat_t x, mfloat_t y, mfloat_t z, mfloat_t w)
 {
 	struct quat result;
-	quat((mfloat_t*)&result, x, y, z, w);
+	result.x = x;
+	result.y = y;
+	result.z = z;
+	result.w = w;
 	return result;
 }
 
 struct quat squat_assign(struct quat q0)
 {
-	struct quat result;
-	quat_assign((mfloat_t*)&result, (mfloat_t*)&q0);
-	return result;
+	return q0;
 }
 
 struct quat squat_zero(void)
 {
 	struct quat result;
-	quat_zero((mfloat_t*)&result);
+	result.x = MFLOAT_C(0.0);
+	result.y = MFLOAT_C(0.0);
+	result.z = MFLOAT_C(0.0);
+	result.w = MFLOAT_C(0.0);
 	return result;
 }
 
 struct quat squat_null(void)
 {
 	struct quat result;
-	quat_null((mfloat_t*)&result);
+	result.x = MFLOAT_C(0.0);
+	result.y = MFLOAT_C(0.0);
+	result.z = MFLOAT_C(0.0);
+	result.w = MFLOAT_C(1.0);
 	return result;
 }
 
 struct quat squat_multiply(struct quat q0, struct quat q1)
 {
 	struct quat result;
-	quat_multiply((mfloat_t*)&result, (mfloat_t*)&q0, (mfloat_t*)&q1);
+	result.x = q0.w * q1.x + q0.x * q1.w + q0.y * q1.z - q0.z * q1.y;
+	result.y = q0.w * q1.y + q0.y * q1.w + q0.z * q1.x - q0.x * q1.z;
+	result.z = q0.w * q1.z + q0.z * q1.w + q0.x * q1.y - q0.y * q1.x;
+	result.w = q0.w * q1.w - q0.x * q1.x - q0.y * q1.y - q0.z * q1.z;
 	return result;
 }
 
 struct quat squat_multiply_f(struct quat q0, mfloat_t f)
 {
 	struct quat result;
-	quat_multiply_f((mfloat_t*)&result, (mfloat_t*)&q0, f);
+	result.x = q0.x * f;
+	result.y = q0.y * f;
+	result.z = q0.z * f;
+	result.w = q0.w * f;
 	return result;
 }
 
@@ -4832,41 +9209,73 @@ struct quat squat_divide(struct quat q0, struct quat q1)
 struct quat squat_divide_f(struct quat q0, mfloat_t f)
 {
 	struct quat result;
-	quat_divide_f((mfloat_t*)&result, (mfloat_t*)&q0, f);
+	result.x = q0.x / f;
+	result.y = q0.y / f;
+	result.z = q0.z / f;
+	result.w = q0.w / f;
 	return result;
 }
 
 struct quat squat_negative(struct quat q0)
 {
 	struct quat result;
-	quat_negative((mfloat_t*)&result, (mfloat_t*)&q0);
+	result.x = -q0.x;
+	result.y = -q0.y;
+	result.z = -q0.z;
+	result.w = -q0.w;
 	return result;
 }
 
 struct quat squat_conjugate(struct quat q0)
 {
 	struct quat result;
-	quat_conjugate((mfloat_t*)&result, (mfloat_t*)&q0);
+	result.x = -q0.x;
+	result.y = -q0.y;
+	result.z = -q0.z;
+	result.w = q0.w;
 	return result;
 }
 
 struct quat squat_inverse(struct quat q0)
 {
 	struct quat result;
-	quat_inverse((mfloat_t*)&result, (mfloat_t*)&q0);
+	mfloat_t l = MFLOAT_C(1.0) / (q0.x * q0.x + q0.y * q0.y + q0.z * q0.z + q0.w * q0.w);
+	result.x = -q0.x * l;
+	result.y = -q0.y * l;
+	result.z = -q0.z * l;
+	result.w = q0.w * l;
 	return result;
 }
 
 struct quat squat_normalize(struct quat q0)
+{
+#if defined(MATHC_USE_FAST_NORMALIZE)
+	return squat_normalize_fast(q0);
+#else
+	struct quat result;
+	mfloat_t l = MFLOAT_C(1.0) / MSQRT(q0.x * q0.x + q0.y * q0.y + q0.z * q0.z + q0.w * q0.w);
+	result.x = q0.x * l;
+	result.y = q0.y * l;
+	result.z = q0.z * l;
+	result.w = q0.w * l;
+	return result;
+#endif
+}
+
+struct quat squat_normalize_fast(struct quat q0)
 {
 	struct quat result;
-	quat_normalize((mfloat_t*)&result, (mfloat_t*)&q0);
+	mfloat_t l = mathc_rsqrt(q0.x * q0.x + q0.y * q0.y + q0.z * q0.z + q0.w * q0.w);
+	result.x = q0.x * l;
+	result.y = q0.y * l;
+	result.z = q0.z * l;
+	result.w = q0.w * l;
 	return result;
 }
 
 mfloat_t squat_dot(struct quat q0, struct quat q1)
 {
-	return quat_dot((mfloat_t*)&q0, (mfloat_t*)&q1);
+	return q0.x * q1.x + q0.y * q1.y + q0.z * q1.z + q0.w * q1.w;
 }
 
 struct quat squat_power(struct quat q0, mfloat_t exponent)
@@ -4900,7 +9309,10 @@ struct quat squat_from_mat4(struct mat4 m0)
 struct quat squat_lerp(struct quat q0, struct quat q1, mfloat_t f)
 {
 	struct quat result;
-	quat_lerp((mfloat_t*)&result, (mfloat_t*)&q0, (mfloat_t*)&q1, f);
+	result.x = q0.x + (q1.x - q0.x) * f;
+	result.y = q0.y + (q1.y - q0.y) * f;
+	result.z = q0.z + (q1.z - q0.z) * f;
+	result.w = q0.w + (q1.w - q0.w) * f;
 	return result;
 }
 
@@ -4913,12 +9325,12 @@ struct quat squat_slerp(struct quat q0, struct quat q1, mfloat_t f)
 
 mfloat_t squat_length(struct quat q0)
 {
-	return quat_length((mfloat_t*)&q0);
+	return MSQRT(q0.x * q0.x + q0.y * q0.y + q0.z * q0.z + q0.w * q0.w);
 }
 
 mfloat_t squat_length_squared(struct quat q0)
 {
-	return quat_length_squared((mfloat_t*)&q0);
+	return q0.x * q0.x + q0.y * q0.y + q0.z * q0.z + q0.w * q0.w;
 }
 
 mfloat_t squat_angle(struct quat q0, struct quat q1)
@@ -4926,6 +9338,19 @@ mfloat_t squat_angle(struct quat q0, struct quat q1)
 	return quat_angle((mfloat_t*)&q0, (mfloat_t*)&q1);
 }
 
+struct vec3 squat_rotate_vec3(struct quat q0, struct vec3 v0)
+{
+	/* v + w * t + cross(q, t), with t = 2 * cross(q, v) */
+	struct vec3 result;
+	mfloat_t tx = MFLOAT_C(2.0) * (q0.y * v0.z - q0.z * v0.y);
+	mfloat_t ty = MFLOAT_C(2.0) * (q0.z * v0.x - q0.x * v0.z);
+	mfloat_t tz = MFLOAT_C(2.0) * (q0.x * v0.y - q0.y * v0.x);
+	result.x = v0.x + q0.w * tx + q0.y * tz - q0.z * ty;
+	result.y = v0.y + q0.w * ty + q0.z * tx - q0.x * tz;
+	result.z = v0.z + q0.w * tz + q0.x * ty - q0.y * tx;
+	return result;
+}
+
 struct mat2 smat2(mfloat_t m11, mfloat_t m12, mfloat_t m21, mfloat_t m22)
 {
 	struct mat2 result;
@@ -5147,208 +9572,390 @@ struct mat3 smat3_rotation_z(mfloat_t f)
 	return result;
 }
 
-struct mat3 smat3_rotation_axis(struct vec3 v0, mfloat_t f)
+struct mat3 smat3_rotation_axis(struct vec3 v0, mfloat_t f)
+{
+	struct mat3 result;
+	mat3_rotation_axis((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	return result;
+}
+
+struct mat3 smat3_rotation_quat(struct quat q0)
+{
+	struct mat3 result;
+	mat3_rotation_quat((mfloat_t*)&result, (mfloat_t*)&q0);
+	return result;
+}
+
+struct mat3 smat3_lerp(struct mat3 m0, struct mat3 m1, mfloat_t f)
+{
+	struct mat3 result;
+	mat3_lerp((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&m1, f);
+	return result;
+}
+
+struct mat4 smat4(mfloat_t m11, mfloat_t m12, mfloat_t m13, mfloat_t m14, mfloat_t m21,
+				  mfloat_t m22, mfloat_t m23, mfloat_t m24, mfloat_t m31, mfloat_t m32,
+				  mfloat_t m33, mfloat_t m34, mfloat_t m41, mfloat_t m42, mfloat_t m43,
+				  mfloat_t m44)
+{
+	struct mat4 result;
+	mat4((mfloat_t*)&result, m11, m12, m13, m14, m21, m22, m23, m24, m31, m32, m33, m34, m41, m42,
+		 m43, m44);
+	return result;
+}
+
+struct mat4 smat4_zero(void)
+{
+	struct mat4 result;
+	mat4_zero((mfloat_t*)&result);
+	return result;
+}
+
+struct mat4 smat4_identity(void)
+{
+	struct mat4 result;
+	mat4_identity((mfloat_t*)&result);
+	return result;
+}
+
+mfloat_t smat4_determinant(struct mat4 m0)
+{
+	return mat4_determinant((mfloat_t*)&m0);
+}
+
+struct mat4 smat4_assign(struct mat4 m0)
+{
+	struct mat4 result;
+	mat4_assign((mfloat_t*)&result, (mfloat_t*)&m0);
+	return result;
+}
+
+struct mat4 smat4_negative(struct mat4 m0)
+{
+	struct mat4 result;
+	mat4_negative((mfloat_t*)&result, (mfloat_t*)&m0);
+	return result;
+}
+
+struct mat4 smat4_transpose(struct mat4 m0)
+{
+	struct mat4 result;
+	mat4_transpose((mfloat_t*)&result, (mfloat_t*)&m0);
+	return result;
+}
+
+struct mat4 smat4_cofactor(struct mat4 m0)
+{
+	struct mat4 result;
+	mat4_cofactor((mfloat_t*)&result, (mfloat_t*)&m0);
+	return result;
+}
+
+struct mat4 smat4_rotation_x(mfloat_t f)
+{
+	struct mat4 result;
+	mat4_rotation_x((mfloat_t*)&result, f);
+	return result;
+}
+
+struct mat4 smat4_rotation_y(mfloat_t f)
+{
+	struct mat4 result;
+	mat4_rotation_y((mfloat_t*)&result, f);
+	return result;
+}
+
+struct mat4 smat4_rotation_z(mfloat_t f)
+{
+	struct mat4 result;
+	mat4_rotation_z((mfloat_t*)&result, f);
+	return result;
+}
+
+struct mat4 smat4_rotation_axis(struct vec3 v0, mfloat_t f)
+{
+	struct mat4 result;
+	mat4_rotation_axis((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	return result;
+}
+
+struct mat4 smat4_rotation_quat(struct quat q0)
+{
+	struct mat4 result;
+	mat4_rotation_quat((mfloat_t*)&result, (mfloat_t*)&q0);
+	return result;
+}
+
+struct mat4 smat4_translation(struct mat4 m0, struct vec3 v0)
+{
+	struct mat4 result;
+	mat4_translation((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&v0);
+	return result;
+}
+
+struct mat4 smat4_translate(struct mat4 m0, struct vec3 v0)
+{
+	struct mat4 result;
+	mat4_translate((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&v0);
+	return result;
+}
+
+struct mat4 smat4_scaling(struct mat4 m0, struct vec3 v0)
+{
+	struct mat4 result;
+	mat4_scaling((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&v0);
+	return result;
+}
+
+struct mat4 smat4_scale(struct mat4 m0, struct vec3 v0)
+{
+	struct mat4 result;
+	mat4_scale((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&v0);
+	return result;
+}
+
+struct mat4 smat4_multiply(struct mat4 m0, struct mat4 m1)
+{
+	struct mat4 result;
+	mat4_multiply((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&m1);
+	return result;
+}
+
+struct mat4 smat4_multiply_f(struct mat4 m0, mfloat_t f)
+{
+	struct mat4 result;
+	mat4_multiply_f((mfloat_t*)&result, (mfloat_t*)&m0, f);
+	return result;
+}
+
+struct mat4 smat4_inverse(struct mat4 m0)
+{
+	struct mat4 result;
+	mat4_inverse((mfloat_t*)&result, (mfloat_t*)&m0);
+	return result;
+}
+
+struct mat4 smat4_inverse_rigid(struct mat4 m0)
+{
+	struct mat4 result;
+	mat4_inverse_rigid((mfloat_t*)&result, (mfloat_t*)&m0);
+	return result;
+}
+
+struct mat4 smat4_inverse_affine(struct mat4 m0)
+{
+	struct mat4 result;
+	mat4_inverse_affine((mfloat_t*)&result, (mfloat_t*)&m0);
+	return result;
+}
+
+struct mat4 smat4_lerp(struct mat4 m0, struct mat4 m1, mfloat_t f)
+{
+	struct mat4 result;
+	mat4_lerp((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&m1, f);
+	return result;
+}
+
+struct mat4 smat4_look_at(struct vec3 position, struct vec3 target, struct vec3 up)
 {
-	struct mat3 result;
-	mat3_rotation_axis((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	struct mat4 result;
+	mat4_look_at((mfloat_t*)&result, (mfloat_t*)&position, (mfloat_t*)&target, (mfloat_t*)&up);
 	return result;
 }
 
-struct mat3 smat3_rotation_quat(struct quat q0)
+struct mat4 smat4_ortho(mfloat_t l, mfloat_t r, mfloat_t b, mfloat_t t, mfloat_t n, mfloat_t f)
 {
-	struct mat3 result;
-	mat3_rotation_quat((mfloat_t*)&result, (mfloat_t*)&q0);
+	struct mat4 result;
+	mat4_ortho((mfloat_t*)&result, l, r, b, t, n, f);
 	return result;
 }
 
-struct mat3 smat3_lerp(struct mat3 m0, struct mat3 m1, mfloat_t f)
+struct mat4 smat4_perspective(mfloat_t fov_y, mfloat_t aspect, mfloat_t n, mfloat_t f)
 {
-	struct mat3 result;
-	mat3_lerp((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&m1, f);
+	struct mat4 result;
+	mat4_perspective((mfloat_t*)&result, fov_y, aspect, n, f);
 	return result;
 }
 
-struct mat4 smat4(mfloat_t m11, mfloat_t m12, mfloat_t m13, mfloat_t m14, mfloat_t m21,
-				  mfloat_t m22, mfloat_t m23, mfloat_t m24, mfloat_t m31, mfloat_t m32,
-				  mfloat_t m33, mfloat_t m34, mfloat_t m41, mfloat_t m42, mfloat_t m43,
-				  mfloat_t m44)
+struct mat4 smat4_perspective_fov(mfloat_t fov, mfloat_t w, mfloat_t h, mfloat_t n, mfloat_t f)
 {
 	struct mat4 result;
-	mat4((mfloat_t*)&result, m11, m12, m13, m14, m21, m22, m23, m24, m31, m32, m33, m34, m41, m42,
-		 m43, m44);
+	mat4_perspective_fov((mfloat_t*)&result, fov, w, h, n, f);
 	return result;
 }
 
-struct mat4 smat4_zero(void)
+struct mat4 smat4_perspective_infinite(mfloat_t fov_y, mfloat_t aspect, mfloat_t n)
 {
 	struct mat4 result;
-	mat4_zero((mfloat_t*)&result);
+	mat4_perspective_infinite((mfloat_t*)&result, fov_y, aspect, n);
 	return result;
 }
 
-struct mat4 smat4_identity(void)
+struct affine saffine_identity(void)
 {
-	struct mat4 result;
-	mat4_identity((mfloat_t*)&result);
+	struct affine result;
+	affine_identity((mfloat_t*)&result);
 	return result;
 }
 
-mfloat_t smat4_determinant(struct mat4 m0)
+struct affine saffine_from_mat4(struct mat4 m0)
 {
-	return mat4_determinant((mfloat_t*)&m0);
+	struct affine result;
+	affine_from_mat4((mfloat_t*)&result, (mfloat_t*)&m0);
+	return result;
 }
 
-struct mat4 smat4_assign(struct mat4 m0)
+struct mat4 smat4_from_affine(struct affine a0)
 {
 	struct mat4 result;
-	mat4_assign((mfloat_t*)&result, (mfloat_t*)&m0);
+	mat4_from_affine((mfloat_t*)&result, (mfloat_t*)&a0);
 	return result;
 }
 
-struct mat4 smat4_negative(struct mat4 m0)
+struct affine saffine_multiply(struct affine a0, struct affine a1)
 {
-	struct mat4 result;
-	mat4_negative((mfloat_t*)&result, (mfloat_t*)&m0);
+	struct affine result;
+	affine_multiply((mfloat_t*)&result, (mfloat_t*)&a0, (mfloat_t*)&a1);
 	return result;
 }
 
-struct mat4 smat4_transpose(struct mat4 m0)
+struct affine saffine_inverse(struct affine a0)
 {
-	struct mat4 result;
-	mat4_transpose((mfloat_t*)&result, (mfloat_t*)&m0);
+	struct affine result;
+	affine_inverse((mfloat_t*)&result, (mfloat_t*)&a0);
 	return result;
 }
 
-struct mat4 smat4_cofactor(struct mat4 m0)
+struct affine saffine_inverse_rigid(struct affine a0)
 {
-	struct mat4 result;
-	mat4_cofactor((mfloat_t*)&result, (mfloat_t*)&m0);
+	struct affine result;
+	affine_inverse_rigid((mfloat_t*)&result, (mfloat_t*)&a0);
 	return result;
 }
 
-struct mat4 smat4_rotation_x(mfloat_t f)
+struct vec3 saffine_transform_point(struct affine a0, struct vec3 v0)
 {
-	struct mat4 result;
-	mat4_rotation_x((mfloat_t*)&result, f);
+	struct vec3 result;
+	affine_transform_point((mfloat_t*)&result, (mfloat_t*)&a0, (mfloat_t*)&v0);
 	return result;
 }
 
-struct mat4 smat4_rotation_y(mfloat_t f)
+struct vec3 saffine_transform_direction(struct affine a0, struct vec3 v0)
 {
-	struct mat4 result;
-	mat4_rotation_y((mfloat_t*)&result, f);
+	struct vec3 result;
+	affine_transform_direction((mfloat_t*)&result, (mfloat_t*)&a0, (mfloat_t*)&v0);
 	return result;
 }
 
-struct mat4 smat4_rotation_z(mfloat_t f)
+struct dualquat sdualquat_identity(void)
 {
-	struct mat4 result;
-	mat4_rotation_z((mfloat_t*)&result, f);
+	struct dualquat result;
+	dualquat_identity((mfloat_t*)&result);
 	return result;
 }
 
-struct mat4 smat4_rotation_axis(struct vec3 v0, mfloat_t f)
+struct dualquat sdualquat_from_quat_vec3(struct quat q0, struct vec3 v0)
 {
-	struct mat4 result;
-	mat4_rotation_axis((mfloat_t*)&result, (mfloat_t*)&v0, f);
+	struct dualquat result;
+	dualquat_from_quat_vec3((mfloat_t*)&result, (mfloat_t*)&q0, (mfloat_t*)&v0);
 	return result;
 }
 
-struct mat4 smat4_rotation_quat(struct quat q0)
+struct quat squat_from_dualquat(struct dualquat dq0)
 {
-	struct mat4 result;
-	mat4_rotation_quat((mfloat_t*)&result, (mfloat_t*)&q0);
+	struct quat result;
+	quat_from_dualquat((mfloat_t*)&result, (mfloat_t*)&dq0);
 	return result;
 }
 
-struct mat4 smat4_translation(struct mat4 m0, struct vec3 v0)
+struct vec3 svec3_from_dualquat(struct dualquat dq0)
 {
-	struct mat4 result;
-	mat4_translation((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&v0);
+	struct vec3 result;
+	vec3_from_dualquat((mfloat_t*)&result, (mfloat_t*)&dq0);
 	return result;
 }
 
-struct mat4 smat4_translate(struct mat4 m0, struct vec3 v0)
+struct dualquat sdualquat_from_mat4(struct mat4 m0)
 {
-	struct mat4 result;
-	mat4_translate((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&v0);
+	struct dualquat result;
+	dualquat_from_mat4((mfloat_t*)&result, (mfloat_t*)&m0);
 	return result;
 }
 
-struct mat4 smat4_scaling(struct mat4 m0, struct vec3 v0)
+struct mat4 smat4_from_dualquat(struct dualquat dq0)
 {
 	struct mat4 result;
-	mat4_scaling((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&v0);
+	mat4_from_dualquat((mfloat_t*)&result, (mfloat_t*)&dq0);
 	return result;
 }
 
-struct mat4 smat4_scale(struct mat4 m0, struct vec3 v0)
+struct dualquat sdualquat_multiply(struct dualquat dq0, struct dualquat dq1)
 {
-	struct mat4 result;
-	mat4_scale((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&v0);
+	struct dualquat result;
+	dualquat_multiply((mfloat_t*)&result, (mfloat_t*)&dq0, (mfloat_t*)&dq1);
 	return result;
 }
 
-struct mat4 smat4_multiply(struct mat4 m0, struct mat4 m1)
+struct dualquat sdualquat_normalize(struct dualquat dq0)
 {
-	struct mat4 result;
-	mat4_multiply((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&m1);
+	struct dualquat result;
+	dualquat_normalize((mfloat_t*)&result, (mfloat_t*)&dq0);
 	return result;
 }
 
-struct mat4 smat4_multiply_f(struct mat4 m0, mfloat_t f)
+struct vec3 sdualquat_transform_point(struct dualquat dq0, struct vec3 v0)
 {
-	struct mat4 result;
-	mat4_multiply_f((mfloat_t*)&result, (mfloat_t*)&m0, f);
+	struct vec3 result;
+	dualquat_transform_point((mfloat_t*)&result, (mfloat_t*)&dq0, (mfloat_t*)&v0);
 	return result;
 }
 
-struct mat4 smat4_inverse(struct mat4 m0)
+struct transform stransform_identity(void)
 {
-	struct mat4 result;
-	mat4_inverse((mfloat_t*)&result, (mfloat_t*)&m0);
+	struct transform result;
+	transform_identity((mfloat_t*)&result);
 	return result;
 }
 
-struct mat4 smat4_lerp(struct mat4 m0, struct mat4 m1, mfloat_t f)
+struct transform stransform_from_trs(struct vec3 v0, struct quat q0, struct vec3 v1)
 {
-	struct mat4 result;
-	mat4_lerp((mfloat_t*)&result, (mfloat_t*)&m0, (mfloat_t*)&m1, f);
+	struct transform result;
+	transform_from_trs((mfloat_t*)&result, (mfloat_t*)&v0, (mfloat_t*)&q0, (mfloat_t*)&v1);
 	return result;
 }
 
-struct mat4 smat4_look_at(struct vec3 position, struct vec3 target, struct vec3 up)
+struct transform stransform_multiply(struct transform t0, struct transform t1)
 {
-	struct mat4 result;
-	mat4_look_at((mfloat_t*)&result, (mfloat_t*)&position, (mfloat_t*)&target, (mfloat_t*)&up);
+	struct transform result;
+	transform_multiply((mfloat_t*)&result, (mfloat_t*)&t0, (mfloat_t*)&t1);
 	return result;
 }
 
-struct mat4 smat4_ortho(mfloat_t l, mfloat_t r, mfloat_t b, mfloat_t t, mfloat_t n, mfloat_t f)
+struct transform stransform_inverse(struct transform t0)
 {
-	struct mat4 result;
-	mat4_ortho((mfloat_t*)&result, l, r, b, t, n, f);
+	struct transform result;
+	transform_inverse((mfloat_t*)&result, (mfloat_t*)&t0);
 	return result;
 }
 
-struct mat4 smat4_perspective(mfloat_t fov_y, mfloat_t aspect, mfloat_t n, mfloat_t f)
+struct vec3 stransform_transform_point(struct transform t0, struct vec3 v0)
 {
-	struct mat4 result;
-	mat4_perspective((mfloat_t*)&result, fov_y, aspect, n, f);
+	struct vec3 result;
+	transform_transform_point((mfloat_t*)&result, (mfloat_t*)&t0, (mfloat_t*)&v0);
 	return result;
 }
 
-struct mat4 smat4_perspective_fov(mfloat_t fov, mfloat_t w, mfloat_t h, mfloat_t n, mfloat_t f)
+struct mat4 smat4_from_transform(struct transform t0)
 {
 	struct mat4 result;
-	mat4_perspective_fov((mfloat_t*)&result, fov, w, h, n, f);
+	mat4_from_transform((mfloat_t*)&result, (mfloat_t*)&t0);
 	return result;
 }
 
-struct mat4 smat4_perspective_infinite(mfloat_t fov_y, mfloat_t aspect, mfloat_t n)
+struct affine saffine_from_transform(struct transform t0)
 {
-	struct mat4 result;
-	mat4_perspective_infinite((mfloat_t*)&result, fov_y, aspect, n);
+	struct affine result;
+	affine_from_transform((mfloat_t*)&result, (mfloat_t*)&t0);
 	return result;
 }
 #endif
@@ -5864,6 +10471,11 @@ struct vec2* psvec2_normalize(struct vec2* result, struct vec2* v0)
 	return (struct vec2*)vec2_normalize((mfloat_t*)result, (mfloat_t*)v0);
 }
 
+struct vec2* psvec2_normalize_fast(struct vec2* result, struct vec2* v0)
+{
+	return (struct vec2*)vec2_normalize_fast((mfloat_t*)result, (mfloat_t*)v0);
+}
+
 mfloat_t psvec2_dot(struct vec2* v0, struct vec2* v1)
 {
 	return vec2_dot((mfloat_t*)v0, (mfloat_t*)v1);
@@ -6085,6 +10697,11 @@ struct vec3* psvec3_normalize(struct vec3* result, struct vec3* v0)
 	return (struct vec3*)vec3_normalize((mfloat_t*)result, (mfloat_t*)v0);
 }
 
+struct vec3* psvec3_normalize_fast(struct vec3* result, struct vec3* v0)
+{
+	return (struct vec3*)vec3_normalize_fast((mfloat_t*)result, (mfloat_t*)v0);
+}
+
 mfloat_t psvec3_dot(struct vec3* v0, struct vec3* v1)
 {
 	return vec3_dot((mfloat_t*)v0, (mfloat_t*)v1);
@@ -6292,6 +10909,11 @@ struct vec4* psvec4_normalize(struct vec4* result, struct vec4* v0)
 	return (struct vec4*)vec4_normalize((mfloat_t*)result, (mfloat_t*)v0);
 }
 
+struct vec4* psvec4_normalize_fast(struct vec4* result, struct vec4* v0)
+{
+	return (struct vec4*)vec4_normalize_fast((mfloat_t*)result, (mfloat_t*)v0);
+}
+
 struct vec4* psvec4_lerp(struct vec4* result, struct vec4* v0, struct vec4* v1, mfloat_t f)
 {
 	return (struct vec4*)vec4_lerp((mfloat_t*)result, (mfloat_t*)v0, (mfloat_t*)v1, f);
@@ -6367,6 +10989,11 @@ struct quat* psquat_normalize(struct quat* result, struct quat* q0)
 	return (struct quat*)quat_normalize((mfloat_t*)result, (mfloat_t*)q0);
 }
 
+struct quat* psquat_normalize_fast(struct quat* result, struct quat* q0)
+{
+	return (struct quat*)quat_normalize_fast((mfloat_t*)result, (mfloat_t*)q0);
+}
+
 mfloat_t psquat_dot(struct quat* q0, struct quat* q1)
 {
 	return quat_dot((mfloat_t*)q0, (mfloat_t*)q1);
@@ -6417,6 +11044,20 @@ mfloat_t psquat_angle(struct quat* q0, struct quat* q1)
 	return quat_angle((mfloat_t*)q0, (mfloat_t*)q1);
 }
 
+struct vec3* psquat_rotate_vec3(struct vec3* result, struct quat* q0, struct vec3* v0)
+{
+	mfloat_t tx = MFLOAT_C(2.0) * (q0->y * v0->z - q0->z * v0->y);
+	mfloat_t ty = MFLOAT_C(2.0) * (q0->z * v0->x - q0->x * v0->z);
+	mfloat_t tz = MFLOAT_C(2.0) * (q0->x * v0->y - q0->y * v0->x);
+	mfloat_t x = v0->x + q0->w * tx + q0->y * tz - q0->z * ty;
+	mfloat_t y = v0->y + q0->w * ty + q0->z * tx - q0->x * tz;
+	mfloat_t z = v0->z + q0->w * tz + q0->x * ty - q0->y * tx;
+	result->x = x;
+	result->y = y;
+	result->z = z;
+	return result;
+}
+
 struct mat2* psmat2(struct mat2* result, mfloat_t m11, mfloat_t m12, mfloat_t m21, mfloat_t m22)
 {
 	return (struct mat2*)mat2((mfloat_t*)result, m11, m12, m21, m22);
@@ -6697,6 +11338,16 @@ struct mat4* psmat4_inverse(struct mat4* result, struct mat4* m0)
 	return (struct mat4*)mat4_inverse((mfloat_t*)result, (mfloat_t*)m0);
 }
 
+struct mat4* psmat4_inverse_rigid(struct mat4* result, struct mat4* m0)
+{
+	return (struct mat4*)mat4_inverse_rigid((mfloat_t*)result, (mfloat_t*)m0);
+}
+
+struct mat4* psmat4_inverse_affine(struct mat4* result, struct mat4* m0)
+{
+	return (struct mat4*)mat4_inverse_affine((mfloat_t*)result, (mfloat_t*)m0);
+}
+
 struct mat4* psmat4_lerp(struct mat4* result, struct mat4* m0, struct mat4* m1, mfloat_t f)
 {
 	return (struct mat4*)mat4_lerp((mfloat_t*)result, (mfloat_t*)m0, (mfloat_t*)m1, f);
@@ -6732,259 +11383,352 @@ struct mat4* psmat4_perspective_infinite(struct mat4* result, mfloat_t fov_y, mf
 {
 	return (struct mat4*)mat4_perspective_infinite((mfloat_t*)result, fov_y, aspect, n);
 }
+
+struct affine* psaffine_identity(struct affine* result)
+{
+	return (struct affine*)affine_identity((mfloat_t*)result);
+}
+
+struct affine* psaffine_from_mat4(struct affine* result, struct mat4* m0)
+{
+	return (struct affine*)affine_from_mat4((mfloat_t*)result, (mfloat_t*)m0);
+}
+
+struct mat4* psmat4_from_affine(struct mat4* result, struct affine* a0)
+{
+	return (struct mat4*)mat4_from_affine((mfloat_t*)result, (mfloat_t*)a0);
+}
+
+struct affine* psaffine_multiply(struct affine* result, struct affine* a0, struct affine* a1)
+{
+	return (struct affine*)affine_multiply((mfloat_t*)result, (mfloat_t*)a0, (mfloat_t*)a1);
+}
+
+struct affine* psaffine_inverse(struct affine* result, struct affine* a0)
+{
+	return (struct affine*)affine_inverse((mfloat_t*)result, (mfloat_t*)a0);
+}
+
+struct affine* psaffine_inverse_rigid(struct affine* result, struct affine* a0)
+{
+	return (struct affine*)affine_inverse_rigid((mfloat_t*)result, (mfloat_t*)a0);
+}
+
+struct vec3* psaffine_transform_point(struct vec3* result, struct affine* a0, struct vec3* v0)
+{
+	return (struct vec3*)affine_transform_point((mfloat_t*)result, (mfloat_t*)a0, (mfloat_t*)v0);
+}
+
+struct vec3* psaffine_transform_direction(struct vec3* result, struct affine* a0, struct vec3* v0)
+{
+	return (struct vec3*)affine_transform_direction((mfloat_t*)result, (mfloat_t*)a0,
+													(mfloat_t*)v0);
+}
+
+struct dualquat* psdualquat_identity(struct dualquat* result)
+{
+	return (struct dualquat*)dualquat_identity((mfloat_t*)result);
+}
+
+struct dualquat* psdualquat_from_quat_vec3(struct dualquat* result, struct quat* q0,
+										   struct vec3* v0)
+{
+	return (struct dualquat*)dualquat_from_quat_vec3((mfloat_t*)result, (mfloat_t*)q0,
+													 (mfloat_t*)v0);
+}
+
+struct quat* psquat_from_dualquat(struct quat* result, struct dualquat* dq0)
+{
+	return (struct quat*)quat_from_dualquat((mfloat_t*)result, (mfloat_t*)dq0);
+}
+
+struct vec3* psvec3_from_dualquat(struct vec3* result, struct dualquat* dq0)
+{
+	return (struct vec3*)vec3_from_dualquat((mfloat_t*)result, (mfloat_t*)dq0);
+}
+
+struct dualquat* psdualquat_from_mat4(struct dualquat* result, struct mat4* m0)
+{
+	return (struct dualquat*)dualquat_from_mat4((mfloat_t*)result, (mfloat_t*)m0);
+}
+
+struct mat4* psmat4_from_dualquat(struct mat4* result, struct dualquat* dq0)
+{
+	return (struct mat4*)mat4_from_dualquat((mfloat_t*)result, (mfloat_t*)dq0);
+}
+
+struct dualquat* psdualquat_multiply(struct dualquat* result, struct dualquat* dq0,
+									 struct dualquat* dq1)
+{
+	return (struct dualquat*)dualquat_multiply((mfloat_t*)result, (mfloat_t*)dq0,
+											   (mfloat_t*)dq1);
+}
+
+struct dualquat* psdualquat_normalize(struct dualquat* result, struct dualquat* dq0)
+{
+	return (struct dualquat*)dualquat_normalize((mfloat_t*)result, (mfloat_t*)dq0);
+}
+
+struct vec3* psdualquat_transform_point(struct vec3* result, struct dualquat* dq0,
+										struct vec3* v0)
+{
+	return (struct vec3*)dualquat_transform_point((mfloat_t*)result, (mfloat_t*)dq0,
+												  (mfloat_t*)v0);
+}
+
+struct transform* pstransform_identity(struct transform* result)
+{
+	return (struct transform*)transform_identity((mfloat_t*)result);
+}
+
+struct transform* pstransform_from_trs(struct transform* result, struct vec3* v0, struct quat* q0,
+									   struct vec3* v1)
+{
+	return (struct transform*)transform_from_trs((mfloat_t*)result, (mfloat_t*)v0, (mfloat_t*)q0,
+												 (mfloat_t*)v1);
+}
+
+struct transform* pstransform_multiply(struct transform* result, struct transform* t0,
+									   struct transform* t1)
+{
+	return (struct transform*)transform_multiply((mfloat_t*)result, (mfloat_t*)t0,
+												 (mfloat_t*)t1);
+}
+
+struct transform* pstransform_inverse(struct transform* result, struct transform* t0)
+{
+	return (struct transform*)transform_inverse((mfloat_t*)result, (mfloat_t*)t0);
+}
+
+struct vec3* pstransform_transform_point(struct vec3* result, struct transform* t0,
+										 struct vec3* v0)
+{
+	return (struct vec3*)transform_transform_point((mfloat_t*)result, (mfloat_t*)t0,
+												   (mfloat_t*)v0);
+}
+
+struct mat4* psmat4_from_transform(struct mat4* result, struct transform* t0)
+{
+	return (struct mat4*)mat4_from_transform((mfloat_t*)result, (mfloat_t*)t0);
+}
+
+struct affine* psaffine_from_transform(struct affine* result, struct transform* t0)
+{
+	return (struct affine*)affine_from_transform((mfloat_t*)result, (mfloat_t*)t0);
+}
 #endif
 #endif
 
 #if defined(MATHC_USE_FLOATING_POINT) && defined(MATHC_USE_EASING_FUNCTIONS)
 mfloat_t quadratic_ease_out(mfloat_t f)
 {
-	return -f * (f - MFLOAT_C(2.0));
+	return quadratic_ease_out_body(f);
 }
 
 mfloat_t quadratic_ease_in(mfloat_t f)
 {
-	return f * f;
+	return quadratic_ease_in_body(f);
 }
 
 mfloat_t quadratic_ease_in_out(mfloat_t f)
 {
-	mfloat_t a = MFLOAT_C(0.0);
-	if (f < MFLOAT_C(0.5)) {
-		a = MFLOAT_C(2.0) * f * f;
-	} else {
-		a = -MFLOAT_C(2.0) * f * f + MFLOAT_C(4.0) * f - MFLOAT_C(1.0);
-	}
-	return a;
+	return quadratic_ease_in_out_body(f);
 }
 
 mfloat_t cubic_ease_out(mfloat_t f)
 {
-	mfloat_t a = f - MFLOAT_C(1.0);
-	return a * a * a + MFLOAT_C(1.0);
+	return cubic_ease_out_body(f);
 }
 
 mfloat_t cubic_ease_in(mfloat_t f)
 {
-	return f * f * f;
+	return cubic_ease_in_body(f);
 }
 
 mfloat_t cubic_ease_in_out(mfloat_t f)
 {
-	mfloat_t a = MFLOAT_C(0.0);
-	if (f < MFLOAT_C(0.5)) {
-		a = MFLOAT_C(4.0) * f * f * f;
-	} else {
-		a = MFLOAT_C(2.0) * f - MFLOAT_C(2.0);
-		a = MFLOAT_C(0.5) * a * a * a + MFLOAT_C(1.0);
-	}
-	return a;
+	return cubic_ease_in_out_body(f);
 }
 
 mfloat_t quartic_ease_out(mfloat_t f)
 {
-	mfloat_t a = f - MFLOAT_C(1.0);
-	return a * a * a * (MFLOAT_C(1.0) - f) + MFLOAT_C(1.0);
+	return quartic_ease_out_body(f);
 }
 
 mfloat_t quartic_ease_in(mfloat_t f)
 {
-	return f * f * f * f;
+	return quartic_ease_in_body(f);
 }
 
 mfloat_t quartic_ease_in_out(mfloat_t f)
 {
-	mfloat_t a = MFLOAT_C(0.0);
-	if (f < MFLOAT_C(0.5)) {
-		a = MFLOAT_C(8.0) * f * f * f * f;
-	} else {
-		a = f - MFLOAT_C(1.0);
-		a = -MFLOAT_C(8.0) * a * a * a * a + MFLOAT_C(1.0);
-	}
-	return a;
+	return quartic_ease_in_out_body(f);
 }
 
 mfloat_t quintic_ease_out(mfloat_t f)
 {
-	mfloat_t a = f - MFLOAT_C(1.0);
-	return a * a * a * a * a + MFLOAT_C(1.0);
+	return quintic_ease_out_body(f);
 }
 
 mfloat_t quintic_ease_in(mfloat_t f)
 {
-	return f * f * f * f * f;
+	return quintic_ease_in_body(f);
 }
 
 mfloat_t quintic_ease_in_out(mfloat_t f)
 {
-	mfloat_t a = MFLOAT_C(0.0);
-	if (f < MFLOAT_C(0.5)) {
-		a = MFLOAT_C(16.0) * f * f * f * f * f;
-	} else {
-		a = MFLOAT_C(2.0) * f - MFLOAT_C(2.0);
-		a = MFLOAT_C(0.5) * a * a * a * a * a + MFLOAT_C(1.0);
-	}
-	return a;
+	return quintic_ease_in_out_body(f);
 }
 
 mfloat_t sine_ease_out(mfloat_t f)
 {
-	return MSIN(f * MPI_2);
+	return sine_ease_out_body(f);
 }
 
 mfloat_t sine_ease_in(mfloat_t f)
 {
-	return MSIN((f - MFLOAT_C(1.0)) * MPI_2) + MFLOAT_C(1.0);
+	return sine_ease_in_body(f);
 }
 
 mfloat_t sine_ease_in_out(mfloat_t f)
 {
-	return MFLOAT_C(0.5) * (MFLOAT_C(1.0) - MCOS(f * MPI));
+	return sine_ease_in_out_body(f);
 }
 
 mfloat_t circular_ease_out(mfloat_t f)
 {
-	return MSQRT((MFLOAT_C(2.0) - f) * f);
+	return circular_ease_out_body(f);
 }
 
 mfloat_t circular_ease_in(mfloat_t f)
 {
-	return MFLOAT_C(1.0) - MSQRT(MFLOAT_C(1.0) - (f * f));
+	return circular_ease_in_body(f);
 }
 
 mfloat_t circular_ease_in_out(mfloat_t f)
 {
-	mfloat_t a = MFLOAT_C(0.0);
-	if (f < MFLOAT_C(0.5)) {
-		a = MFLOAT_C(0.5) * (MFLOAT_C(1.0) - MSQRT(MFLOAT_C(1.0) - MFLOAT_C(4.0) * f * f));
-	} else {
-		a = MFLOAT_C(0.5) *
-			(MSQRT(-(MFLOAT_C(2.0) * f - MFLOAT_C(3.0)) * (MFLOAT_C(2.0) * f - MFLOAT_C(1.0))) +
-			 MFLOAT_C(1.0));
-	}
-	return a;
+	return circular_ease_in_out_body(f);
 }
 
 mfloat_t exponential_ease_out(mfloat_t f)
 {
-	mfloat_t a;
-	if (MFABS(f) < MFLT_EPSILON) {
-		a = MFLOAT_C(0.0);
-	} else if (MFABS(f - MFLOAT_C(1.0)) < MFLT_EPSILON) {
-		a = MFLOAT_C(1.0);
-	} else {
-		a = MFLOAT_C(1.0) - MPOW(MFLOAT_C(2.0), -MFLOAT_C(10.0) * f);
-	}
-	return a;
+	return exponential_ease_out_body(f);
 }
 
 mfloat_t exponential_ease_in(mfloat_t f)
 {
-	mfloat_t a = f;
-	if (MFABS(a) > MFLT_EPSILON) {
-		a = MPOW(MFLOAT_C(2.0), MFLOAT_C(10.0) * (f - MFLOAT_C(1.0)));
-	}
-	return a;
+	return exponential_ease_in_body(f);
 }
 
 mfloat_t exponential_ease_in_out(mfloat_t f)
 {
-	mfloat_t a;
-	if (MFABS(f) < MFLT_EPSILON) {
-		a = MFLOAT_C(0.0);
-	} else if (MFABS(f - MFLOAT_C(1.0)) < MFLT_EPSILON) {
-		a = MFLOAT_C(1.0);
-	} else if (f < MFLOAT_C(0.5)) {
-		a = MFLOAT_C(0.5) * MPOW(MFLOAT_C(2.0), (MFLOAT_C(20.0) * f) - MFLOAT_C(10.0));
-	} else {
-		a = -MFLOAT_C(0.5) * MPOW(MFLOAT_C(2.0), -MFLOAT_C(20.0) * f + MFLOAT_C(10.0)) +
-			MFLOAT_C(1.0);
-	}
-	return a;
+	return exponential_ease_in_out_body(f);
 }
 
 mfloat_t elastic_ease_out(mfloat_t f)
 {
-	return MSIN(-MFLOAT_C(13.0) * MPI_2 * (f + MFLOAT_C(1.0))) *
-			   MPOW(MFLOAT_C(2.0), -MFLOAT_C(10.0) * f) +
-		   MFLOAT_C(1.0);
+	return elastic_ease_out_body(f);
 }
 
 mfloat_t elastic_ease_in(mfloat_t f)
 {
-	return MSIN(MFLOAT_C(13.0) * MPI_2 * f) *
-		   MPOW(MFLOAT_C(2.0), MFLOAT_C(10.0) * (f - MFLOAT_C(1.0)));
+	return elastic_ease_in_body(f);
 }
 
 mfloat_t elastic_ease_in_out(mfloat_t f)
 {
-	mfloat_t a = MFLOAT_C(0.0);
-	if (f < MFLOAT_C(0.5)) {
-		a = MFLOAT_C(0.5) * MSIN(MFLOAT_C(13.0) * MPI_2 * (MFLOAT_C(2.0) * f)) *
-			MPOW(MFLOAT_C(2.0), MFLOAT_C(10.0) * ((MFLOAT_C(2.0) * f) - MFLOAT_C(1.0)));
-	} else {
-		a = MFLOAT_C(0.5) *
-			(MSIN(-MFLOAT_C(13.0) * MPI_2 * ((MFLOAT_C(2.0) * f - MFLOAT_C(1.0)) + MFLOAT_C(1.0))) *
-				 MPOW(MFLOAT_C(2.0), -MFLOAT_C(10.0) * (MFLOAT_C(2.0) * f - MFLOAT_C(1.0))) +
-			 MFLOAT_C(2.0));
-	}
-	return a;
+	return elastic_ease_in_out_body(f);
 }
 
 mfloat_t back_ease_out(mfloat_t f)
 {
-	mfloat_t a = MFLOAT_C(1.0) - f;
-	return MFLOAT_C(1.0) - (a * a * a - a * MSIN(a * MPI));
+	return back_ease_out_body(f);
 }
 
 mfloat_t back_ease_in(mfloat_t f)
 {
-	return f * f * f - f * MSIN(f * MPI);
+	return back_ease_in_body(f);
 }
 
 mfloat_t back_ease_in_out(mfloat_t f)
 {
-	mfloat_t a = MFLOAT_C(0.0);
-	if (f < MFLOAT_C(0.5)) {
-		a = MFLOAT_C(2.0) * f;
-		a = MFLOAT_C(0.5) * (a * a * a - a * MSIN(a * MPI));
-	} else {
-		a = (MFLOAT_C(1.0) - (MFLOAT_C(2.0) * f - MFLOAT_C(1.0)));
-		a = MFLOAT_C(0.5) * (MFLOAT_C(1.0) - (a * a * a - a * MSIN(f * MPI))) + MFLOAT_C(0.5);
-	}
-	return a;
+	return back_ease_in_out_body(f);
 }
 
 mfloat_t bounce_ease_out(mfloat_t f)
 {
-	mfloat_t a = MFLOAT_C(0.0);
-	if (f < MFLOAT_C(4.0) / MFLOAT_C(11.0)) {
-		a = (MFLOAT_C(121.0) * f * f) / MFLOAT_C(16.0);
-	} else if (f < MFLOAT_C(8.0) / MFLOAT_C(11.0)) {
-		a = (MFLOAT_C(363.0) / MFLOAT_C(40.0) * f * f) - (MFLOAT_C(99.0) / MFLOAT_C(10.0) * f) +
-			MFLOAT_C(17.0) / MFLOAT_C(5.0);
-	} else if (f < MFLOAT_C(9.0) / MFLOAT_C(10.0)) {
-		a = (MFLOAT_C(4356.0) / MFLOAT_C(361.0) * f * f) -
-			(MFLOAT_C(35442.0) / MFLOAT_C(1805.0) * f) + MFLOAT_C(16061.0) / MFLOAT_C(1805.0);
-	} else {
-		a = (MFLOAT_C(54.0) / MFLOAT_C(5.0) * f * f) - (MFLOAT_C(513.0) / MFLOAT_C(25.0) * f) +
-			MFLOAT_C(268.0) / MFLOAT_C(25.0);
-	}
-	return a;
+	return bounce_ease_out_body(f);
 }
 
 mfloat_t bounce_ease_in(mfloat_t f)
 {
-	return MFLOAT_C(1.0) - bounce_ease_out(MFLOAT_C(1.0) - f);
+	return bounce_ease_in_body(f);
 }
 
 mfloat_t bounce_ease_in_out(mfloat_t f)
 {
-	mfloat_t a = MFLOAT_C(0.0);
-	if (f < MFLOAT_C(0.5)) {
-		a = MFLOAT_C(0.5) * bounce_ease_in(f * MFLOAT_C(2.0));
-	} else {
-		a = MFLOAT_C(0.5) * bounce_ease_out(f * MFLOAT_C(2.0) - MFLOAT_C(1.0)) + MFLOAT_C(0.5);
+	return bounce_ease_in_out_body(f);
+}
+
+void mathc_easing_table(mfloat_t* table, size_t size, mfloat_t (*easing)(mfloat_t f))
+{
+	size_t i;
+	for (i = 0; i < size; ++i) {
+		table[i] = easing((mfloat_t)i / (mfloat_t)(size - 1));
+	}
+}
+
+mfloat_t mathc_easing_table_linear(mfloat_t* table, size_t size, mfloat_t f)
+{
+	return mathc_easing_table_linear_body(table, (int)size - 2, f);
+}
+
+mfloat_t mathc_easing_table_cubic(mfloat_t* table, size_t size, mfloat_t f)
+{
+	return mathc_easing_table_cubic_body(table, (int)size - 2, f);
+}
+
+struct mathc_cubic_bezier* mathc_cubic_bezier(struct mathc_cubic_bezier* result, mfloat_t x1,
+											  mfloat_t y1, mfloat_t x2, mfloat_t y2)
+{
+	mfloat_t p0[VEC2_SIZE] = {MFLOAT_C(0.0), MFLOAT_C(0.0)};
+	mfloat_t p1[VEC2_SIZE];
+	mfloat_t p2[VEC2_SIZE];
+	mfloat_t p3[VEC2_SIZE] = {MFLOAT_C(1.0), MFLOAT_C(1.0)};
+	mfloat_t point[VEC2_SIZE];
+	int i;
+	p1[0] = MFMIN(MFMAX(x1, MFLOAT_C(0.0)), MFLOAT_C(1.0));
+	p1[1] = y1;
+	p2[0] = MFMIN(MFMAX(x2, MFLOAT_C(0.0)), MFLOAT_C(1.0));
+	p2[1] = y2;
+	result->cx = MFLOAT_C(3.0) * p1[0];
+	result->bx = MFLOAT_C(3.0) * (p2[0] - p1[0]) - result->cx;
+	result->ax = MFLOAT_C(1.0) - result->cx - result->bx;
+	result->cy = MFLOAT_C(3.0) * p1[1];
+	result->by = MFLOAT_C(3.0) * (p2[1] - p1[1]) - result->cy;
+	result->ay = MFLOAT_C(1.0) - result->cy - result->by;
+	for (i = 0; i < MATHC_CUBIC_BEZIER_SAMPLES; ++i) {
+		vec2_bezier4(point, p0, p1, p2, p3,
+					 (mfloat_t)i / (mfloat_t)(MATHC_CUBIC_BEZIER_SAMPLES - 1));
+		result->samples[i] = point[0];
+	}
+	result->linear = p1[0] == p1[1] && p2[0] == p2[1];
+	return result;
+}
+
+mfloat_t mathc_cubic_bezier_ease(struct mathc_cubic_bezier* bezier, mfloat_t f)
+{
+	mfloat_t t;
+	if (!(f > MFLOAT_C(0.0))) {
+		return MFLOAT_C(0.0);
+	}
+	if (f >= MFLOAT_C(1.0)) {
+		return MFLOAT_C(1.0);
+	}
+	if (bezier->linear) {
+		return f;
 	}
-	return a;
+	t = mathc_cubic_bezier_solve(bezier, f);
+	return ((bezier->ay * t + bezier->by) * t + bezier->cy) * t;
 }
 #endif
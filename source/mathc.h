@@ -25,8 +25,13 @@ the following restrictions:
 extern "C" {
 #endif
 
-/* Symbol visibility for shared library builds */
-#if defined(_WIN32) || defined(__CYGWIN__)
+/*
+Symbol visibility for shared library builds. With MATHC_INLINE every function
+is defined `static inline` in each translation unit that includes this header.
+*/
+#if defined(MATHC_INLINE)
+#define MATHC_API static inline
+#elif defined(_WIN32) || defined(__CYGWIN__)
 #if defined(MATHC_BUILDING_SHARED)
 #define MATHC_API __declspec(dllexport)
 #elif defined(MATHC_SHARED)
@@ -44,6 +49,8 @@ extern "C" {
 
 #include <math.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #define MATHC_VERSION_YYYY 2019
 #define MATHC_VERSION_MM 02
@@ -65,10 +72,40 @@ extern "C" {
 #if !defined(MATHC_NO_EASING_FUNCTIONS)
 #define MATHC_USE_EASING_FUNCTIONS
 #endif
+#if !defined(MATHC_NO_STREAM_FUNCTIONS)
+#define MATHC_USE_STREAM_FUNCTIONS
+#endif
+#if defined(MATHC_USE_AVX2) && !defined(MATHC_USE_SSE)
+#define MATHC_USE_SSE
+#endif
+#if defined(MATHC_INLINE) && defined(MATHC_USE_DISPATCH)
+#error "MATHC_INLINE can't be combined with MATHC_USE_DISPATCH"
+#endif
 
-#if defined(MATHC_USE_INT)
-#include <stdint.h>
+/*
+With MATHC_ALIGNED, `struct vec4`, `struct quat`, `struct affine` and
+`struct dualquat` are aligned to 16 bytes and `struct mat4` to 64 bytes, so
+each mat4 of an array fills one cache line in single precision and two in
+double precision.
+*/
+#define MATHC_VEC4_ALIGNMENT 16
+#define MATHC_QUAT_ALIGNMENT 16
+#define MATHC_MAT4_ALIGNMENT 64
+#define MATHC_AFFINE_ALIGNMENT 16
+#define MATHC_DUALQUAT_ALIGNMENT 16
+#if defined(MATHC_ALIGNED)
+#if defined(_MSC_VER)
+#define MATHC_ALIGN(n) __declspec(align(n))
+#else
+#define MATHC_ALIGN(n) __attribute__((aligned(n)))
+#endif
+#if defined(_MSC_VER) && defined(_M_IX86) && !defined(MATHC_NO_STRUCT_FUNCTIONS)
+#error "MATHC_ALIGNED on 32-bit MSVC requires MATHC_NO_STRUCT_FUNCTIONS"
 #endif
+#else
+#define MATHC_ALIGN(n)
+#endif
+
 #if defined(MATHC_USE_FLOATING_POINT)
 #include <float.h>
 #endif
@@ -80,6 +117,11 @@ extern "C" {
 #define MAT2_SIZE 4
 #define MAT3_SIZE 9
 #define MAT4_SIZE 16
+#define AFFINE_SIZE 12
+#define DUALQUAT_SIZE 8
+#define TRANSFORM_SIZE 10
+#define FRUSTUM_SIZE 24
+#define SKIN_BONES 4
 
 #if defined(MATHC_USE_INT)
 #if defined(MATHC_INT_TYPE)
@@ -145,6 +187,7 @@ typedef float mfloat_t;
 #define MTAN tanf
 #define MATAN2 atan2f
 #define MPOW powf
+#define MLOG2 log2f
 #define MFLOOR floorf
 #define MCEIL ceilf
 #define MROUND roundf
@@ -169,11 +212,25 @@ typedef double mfloat_t;
 #define MTAN tan
 #define MATAN2 atan2
 #define MPOW pow
+#define MLOG2 log2
 #define MFLOOR floor
 #define MCEIL ceil
 #define MROUND round
 #define MFLOAT_C(c) c
 #endif
+/*
+MSINCOS(x, s, c) stores the sine of `x` in `*s` and its cosine in `*c`. GCC
+turns the builtin into one sincos call where the C library has it; Clang
+already merges separate calls of sin and cos on the same value. The arguments
+may be evaluated more than once.
+*/
+#if defined(__GNUC__) && !defined(__clang__) && defined(MATHC_USE_SINGLE_FLOATING_POINT)
+#define MSINCOS(x, s, c) __builtin_sincosf((x), (s), (c))
+#elif defined(__GNUC__) && !defined(__clang__) && defined(MATHC_USE_DOUBLE_FLOATING_POINT)
+#define MSINCOS(x, s, c) __builtin_sincos((x), (s), (c))
+#else
+#define MSINCOS(x, s, c) (*(s) = MSIN(x), *(c) = MCOS(x))
+#endif
 #endif
 
 #if defined(MATHC_USE_STRUCT_FUNCTIONS) || defined(MATHC_USE_POINTER_STRUCT_FUNCTIONS)
@@ -268,7 +325,7 @@ struct vec3 {
 #endif
 };
 
-struct vec4 {
+struct MATHC_ALIGN(MATHC_VEC4_ALIGNMENT) vec4 {
 #if defined(MATHC_USE_UNIONS)
 	union {
 		struct {
@@ -288,7 +345,7 @@ struct vec4 {
 #endif
 };
 
-struct quat {
+struct MATHC_ALIGN(MATHC_QUAT_ALIGNMENT) quat {
 #if defined(MATHC_USE_UNIONS)
 	union {
 		struct {
@@ -376,7 +433,7 @@ Matrix 4×4 representation:
 2/m31 6/m32 10/m33 14/m34
 3/m41 7/m42 11/m43 15/m44
 */
-struct mat4 {
+struct MATHC_ALIGN(MATHC_MAT4_ALIGNMENT) mat4 {
 #if defined(MATHC_USE_UNIONS)
 	union {
 		struct {
@@ -419,9 +476,103 @@ struct mat4 {
 	mfloat_t m44;
 #endif
 };
+
+/*
+Affine 3×4 representation, a mat4 without its last row (0, 0, 0, 1):
+0/m11 3/m12 6/m13  9/m14
+1/m21 4/m22 7/m23 10/m24
+2/m31 5/m32 8/m33 11/m34
+*/
+struct MATHC_ALIGN(MATHC_AFFINE_ALIGNMENT) affine {
+#if defined(MATHC_USE_UNIONS)
+	union {
+		struct {
+			mfloat_t m11;
+			mfloat_t m21;
+			mfloat_t m31;
+			mfloat_t m12;
+			mfloat_t m22;
+			mfloat_t m32;
+			mfloat_t m13;
+			mfloat_t m23;
+			mfloat_t m33;
+			mfloat_t m14;
+			mfloat_t m24;
+			mfloat_t m34;
+		};
+
+		mfloat_t v[AFFINE_SIZE];
+	};
+#else
+	mfloat_t m11;
+	mfloat_t m21;
+	mfloat_t m31;
+	mfloat_t m12;
+	mfloat_t m22;
+	mfloat_t m32;
+	mfloat_t m13;
+	mfloat_t m23;
+	mfloat_t m33;
+	mfloat_t m14;
+	mfloat_t m24;
+	mfloat_t m34;
+#endif
+};
+
+/*
+Dual quaternion representation, a rotation quaternion followed by its dual part:
+0/real.x 1/real.y 2/real.z 3/real.w 4/dual.x 5/dual.y 6/dual.z 7/dual.w
+*/
+struct MATHC_ALIGN(MATHC_DUALQUAT_ALIGNMENT) dualquat {
+#if defined(MATHC_USE_UNIONS)
+	union {
+		struct {
+			struct quat real;
+			struct quat dual;
+		};
+
+		mfloat_t v[DUALQUAT_SIZE];
+	};
+#else
+	struct quat real;
+	struct quat dual;
+#endif
+};
+
+/*
+Transform representation, a position, a rotation quaternion and a scale:
+0/position[0] 1/position[1] 2/position[2]
+3/rotation[0] 4/rotation[1] 5/rotation[2] 6/rotation[3]
+7/scale[0] 8/scale[1] 9/scale[2]
+The members are arrays so they can be passed to the vec3 and quat functions.
+*/
+struct transform {
+#if defined(MATHC_USE_UNIONS)
+	union {
+		struct {
+			mfloat_t position[VEC3_SIZE];
+			mfloat_t rotation[QUAT_SIZE];
+			mfloat_t scale[VEC3_SIZE];
+		};
+
+		mfloat_t v[TRANSFORM_SIZE];
+	};
+#else
+	mfloat_t position[VEC3_SIZE];
+	mfloat_t rotation[QUAT_SIZE];
+	mfloat_t scale[VEC3_SIZE];
+#endif
+};
 #endif
 #endif
 
+/*
+Allocates `size` bytes aligned to `alignment` bytes, a power of two, for arrays
+of aligned structures. Returns NULL on failure. Free with mathc_aligned_free().
+*/
+MATHC_API void* mathc_aligned_alloc(size_t size, size_t alignment);
+MATHC_API void mathc_aligned_free(void* pointer);
+
 #if defined(MATHC_USE_INT)
 MATHC_API mint_t clampi(mint_t value, mint_t min, mint_t max);
 #endif
@@ -438,6 +589,59 @@ MATHC_API mfloat_t lerp(mfloat_t a, mfloat_t b, mfloat_t t);
 MATHC_API mfloat_t inverse_lerp(mfloat_t a, mfloat_t b, mfloat_t value);
 MATHC_API mfloat_t remap(mfloat_t value, mfloat_t in_min, mfloat_t in_max, mfloat_t out_min,
 						 mfloat_t out_max);
+
+/*
+Branch-free polynomial approximations of the C library functions, which
+vectorize when called in loops. In double precision they call the C library.
+The largest errors in single precision, measured against the double precision
+C library:
+
+- mathc_sin_fast(), mathc_cos_fast(): 1.6 ulp in [-pi, pi], and 1e-7 absolute
+  error in [-10000, 10000]. NAN for infinities, NAN and beyond 6.5e6.
+- mathc_acos_fast(): 3 ulp in [-1, 1]. Inputs outside it are clamped.
+- mathc_atan2_fast(): 3.1 ulp. The sign of a zero `y` is ignored.
+- mathc_exp2_fast(): 1.2 ulp in [-126, 128), with denormal results below it,
+  0 below -150, INFINITY from 128 and NAN for NAN.
+- mathc_log2_fast(): 1.9 ulp for positive normal `x`, -INFINITY for 0,
+  INFINITY for INFINITY and NAN for negative `x` and NAN.
+- mathc_pow_fast(): exp2(y * log2(x)) for positive `x`, within
+  2 + |y * log2(x)| ulp, and 1 when `y` is 0 or `x` is 1, like pow().
+
+With MATHC_FAST_TRANSCENDENTALS, the easing functions, mathc_ease_n(),
+quat_slerp(), quat_slerp_n(), quat_angle(), vec2_angle() and vec2_angle_n() use
+them instead of the C library.
+*/
+MATHC_API mfloat_t mathc_sin_fast(mfloat_t x);
+MATHC_API mfloat_t mathc_cos_fast(mfloat_t x);
+MATHC_API mfloat_t mathc_acos_fast(mfloat_t x);
+MATHC_API mfloat_t mathc_atan2_fast(mfloat_t y, mfloat_t x);
+MATHC_API mfloat_t mathc_exp2_fast(mfloat_t x);
+MATHC_API mfloat_t mathc_log2_fast(mfloat_t x);
+MATHC_API mfloat_t mathc_pow_fast(mfloat_t x, mfloat_t y);
+
+/*
+Instruction set tiers. Without MATHC_USE_DISPATCH the tier is fixed at compile
+time by MATHC_USE_SSE and MATHC_USE_AVX2. With it, the best tier supported by
+the CPU is selected once, on the first call from any thread, and can be changed
+with mathc_simd_set() at any time. Calls that run meanwhile on other threads use
+either the old or the new tier.
+*/
+enum mathc_simd {
+	MATHC_SIMD_SCALAR,
+	MATHC_SIMD_SSE,
+	MATHC_SIMD_AVX2,
+	MATHC_SIMD_AVX512
+};
+
+#define MATHC_CPU_SSE41 0x1
+#define MATHC_CPU_AVX2 0x2
+#define MATHC_CPU_FMA 0x4
+#define MATHC_CPU_AVX512F 0x8
+
+MATHC_API unsigned int mathc_cpu_features(void);
+MATHC_API enum mathc_simd mathc_simd_detect(void);
+MATHC_API enum mathc_simd mathc_simd_get(void);
+MATHC_API bool mathc_simd_set(enum mathc_simd simd);
 #endif
 
 #if defined(MATHC_USE_INT)
@@ -550,6 +754,12 @@ MATHC_API mfloat_t* vec2_max(mfloat_t* result, mfloat_t* v0, mfloat_t* v1);
 MATHC_API mfloat_t* vec2_min(mfloat_t* result, mfloat_t* v0, mfloat_t* v1);
 MATHC_API mfloat_t* vec2_clamp(mfloat_t* result, mfloat_t* v0, mfloat_t* v1, mfloat_t* v2);
 MATHC_API mfloat_t* vec2_normalize(mfloat_t* result, mfloat_t* v0);
+/*
+The fast normalize functions multiply by a reciprocal square root estimate
+refined by one Newton-Raphson step, with a relative error below 2^-21. With
+MATHC_USE_FAST_NORMALIZE, the normalize functions use them too.
+*/
+MATHC_API mfloat_t* vec2_normalize_fast(mfloat_t* result, mfloat_t* v0);
 MATHC_API mfloat_t vec2_dot(mfloat_t* v0, mfloat_t* v1);
 MATHC_API mfloat_t* vec2_project(mfloat_t* result, mfloat_t* v0, mfloat_t* v1);
 MATHC_API mfloat_t* vec2_slide(mfloat_t* result, mfloat_t* v0, mfloat_t* normal);
@@ -599,6 +809,7 @@ MATHC_API mfloat_t* vec3_min(mfloat_t* result, mfloat_t* v0, mfloat_t* v1);
 MATHC_API mfloat_t* vec3_clamp(mfloat_t* result, mfloat_t* v0, mfloat_t* v1, mfloat_t* v2);
 MATHC_API mfloat_t* vec3_cross(mfloat_t* result, mfloat_t* v0, mfloat_t* v1);
 MATHC_API mfloat_t* vec3_normalize(mfloat_t* result, mfloat_t* v0);
+MATHC_API mfloat_t* vec3_normalize_fast(mfloat_t* result, mfloat_t* v0);
 MATHC_API mfloat_t vec3_dot(mfloat_t* v0, mfloat_t* v1);
 MATHC_API mfloat_t* vec3_project(mfloat_t* result, mfloat_t* v0, mfloat_t* v1);
 MATHC_API mfloat_t* vec3_slide(mfloat_t* result, mfloat_t* v0, mfloat_t* normal);
@@ -645,6 +856,7 @@ MATHC_API mfloat_t* vec4_max(mfloat_t* result, mfloat_t* v0, mfloat_t* v1);
 MATHC_API mfloat_t* vec4_min(mfloat_t* result, mfloat_t* v0, mfloat_t* v1);
 MATHC_API mfloat_t* vec4_clamp(mfloat_t* result, mfloat_t* v0, mfloat_t* v1, mfloat_t* v2);
 MATHC_API mfloat_t* vec4_normalize(mfloat_t* result, mfloat_t* v0);
+MATHC_API mfloat_t* vec4_normalize_fast(mfloat_t* result, mfloat_t* v0);
 MATHC_API mfloat_t* vec4_lerp(mfloat_t* result, mfloat_t* v0, mfloat_t* v1, mfloat_t f);
 MATHC_API bool quat_is_zero(mfloat_t* q0);
 MATHC_API bool quat_is_equal(mfloat_t* q0, mfloat_t* q1);
@@ -660,6 +872,7 @@ MATHC_API mfloat_t* quat_negative(mfloat_t* result, mfloat_t* q0);
 MATHC_API mfloat_t* quat_conjugate(mfloat_t* result, mfloat_t* q0);
 MATHC_API mfloat_t* quat_inverse(mfloat_t* result, mfloat_t* q0);
 MATHC_API mfloat_t* quat_normalize(mfloat_t* result, mfloat_t* q0);
+MATHC_API mfloat_t* quat_normalize_fast(mfloat_t* result, mfloat_t* q0);
 MATHC_API mfloat_t quat_dot(mfloat_t* q0, mfloat_t* q1);
 MATHC_API mfloat_t* quat_power(mfloat_t* result, mfloat_t* q0, mfloat_t exponent);
 MATHC_API mfloat_t* quat_from_axis_angle(mfloat_t* result, mfloat_t* v0, mfloat_t angle);
@@ -670,6 +883,11 @@ MATHC_API mfloat_t* quat_slerp(mfloat_t* result, mfloat_t* q0, mfloat_t* q1, mfl
 MATHC_API mfloat_t quat_length(mfloat_t* q0);
 MATHC_API mfloat_t quat_length_squared(mfloat_t* q0);
 MATHC_API mfloat_t quat_angle(mfloat_t* q0, mfloat_t* q1);
+/*
+Rotate the vec3 `v0` by the unit quaternion `q0` directly, without building a
+rotation matrix.
+*/
+MATHC_API mfloat_t* quat_rotate_vec3(mfloat_t* result, mfloat_t* q0, mfloat_t* v0);
 MATHC_API mfloat_t* mat2(mfloat_t* result, mfloat_t m11, mfloat_t m12, mfloat_t m21, mfloat_t m22);
 MATHC_API mfloat_t* mat2_zero(mfloat_t* result);
 MATHC_API mfloat_t* mat2_identity(mfloat_t* result);
@@ -729,6 +947,15 @@ MATHC_API mfloat_t* mat4_scale(mfloat_t* result, mfloat_t* m0, mfloat_t* v0);
 MATHC_API mfloat_t* mat4_multiply(mfloat_t* result, mfloat_t* m0, mfloat_t* m1);
 MATHC_API mfloat_t* mat4_multiply_f(mfloat_t* result, mfloat_t* m0, mfloat_t f);
 MATHC_API mfloat_t* mat4_inverse(mfloat_t* result, mfloat_t* m0);
+/*
+Cheaper inverses for matrices whose last row is (0, 0, 0, 1).
+mat4_inverse_affine() inverts the 3×3 part and moves the translation, and
+mat4_inverse_rigid() only accepts rotations and translations, such as view
+matrices, and transposes the rotation. Unless NDEBUG is defined, they assert
+that the matrix has that form.
+*/
+MATHC_API mfloat_t* mat4_inverse_rigid(mfloat_t* result, mfloat_t* m0);
+MATHC_API mfloat_t* mat4_inverse_affine(mfloat_t* result, mfloat_t* m0);
 MATHC_API mfloat_t* mat4_lerp(mfloat_t* result, mfloat_t* m0, mfloat_t* m1, mfloat_t f);
 MATHC_API mfloat_t* mat4_look_at(mfloat_t* result, mfloat_t* position, mfloat_t* target,
 								 mfloat_t* up);
@@ -740,6 +967,244 @@ MATHC_API mfloat_t* mat4_perspective_fov(mfloat_t* result, mfloat_t fov, mfloat_
 										 mfloat_t n, mfloat_t f);
 MATHC_API mfloat_t* mat4_perspective_infinite(mfloat_t* result, mfloat_t fov_y, mfloat_t aspect,
 											  mfloat_t n);
+/*
+Affine transforms store the first three rows of a mat4 whose last row is
+(0, 0, 0, 1), which saves a quarter of the memory and of the arithmetic.
+affine_from_mat4() drops the last row and mat4_from_affine() restores it.
+affine_inverse_rigid() only accepts rotations and translations, and transposes
+the rotation instead of inverting it.
+*/
+MATHC_API mfloat_t* affine_identity(mfloat_t* result);
+MATHC_API mfloat_t* affine_from_mat4(mfloat_t* result, mfloat_t* m0);
+MATHC_API mfloat_t* mat4_from_affine(mfloat_t* result, mfloat_t* a0);
+MATHC_API mfloat_t* affine_multiply(mfloat_t* result, mfloat_t* a0, mfloat_t* a1);
+MATHC_API mfloat_t* affine_inverse(mfloat_t* result, mfloat_t* a0);
+MATHC_API mfloat_t* affine_inverse_rigid(mfloat_t* result, mfloat_t* a0);
+MATHC_API mfloat_t* affine_transform_point(mfloat_t* result, mfloat_t* a0, mfloat_t* v0);
+MATHC_API mfloat_t* affine_transform_direction(mfloat_t* result, mfloat_t* a0, mfloat_t* v0);
+/*
+Unit dual quaternions hold a rotation and a translation in DUALQUAT_SIZE values,
+the rotation quaternion r and the dual part 0.5 * t * r, where t is the
+translation as a quaternion with w = 0. dualquat_multiply() composes them like
+quat_multiply(), with dq1 applied first. dualquat_normalize() scales both parts
+by the length of the rotation and removes the component of the dual part along
+it, so a blend of dual quaternions becomes a rigid transform again. Conversions
+from a mat4 only accept rotations and translations.
+*/
+MATHC_API mfloat_t* dualquat_identity(mfloat_t* result);
+MATHC_API mfloat_t* dualquat_from_quat_vec3(mfloat_t* result, mfloat_t* q0, mfloat_t* v0);
+MATHC_API mfloat_t* quat_from_dualquat(mfloat_t* result, mfloat_t* dq0);
+MATHC_API mfloat_t* vec3_from_dualquat(mfloat_t* result, mfloat_t* dq0);
+MATHC_API mfloat_t* dualquat_from_mat4(mfloat_t* result, mfloat_t* m0);
+MATHC_API mfloat_t* mat4_from_dualquat(mfloat_t* result, mfloat_t* dq0);
+MATHC_API mfloat_t* dualquat_multiply(mfloat_t* result, mfloat_t* dq0, mfloat_t* dq1);
+MATHC_API mfloat_t* dualquat_normalize(mfloat_t* result, mfloat_t* dq0);
+MATHC_API mfloat_t* dualquat_transform_point(mfloat_t* result, mfloat_t* dq0, mfloat_t* v0);
+/*
+Transforms hold a position, a unit rotation and a scale in TRANSFORM_SIZE values
+and apply the scale first, then the rotation and then the position, like the
+product of mat4_translation(), mat4_rotation_quat() and mat4_scaling().
+transform_multiply() composes them with t1 applied first, scaling the position
+of t1 by the scale of t0 and multiplying the scales. This is exact when the
+scale of t0 is uniform, otherwise the shear of a rotated scale that isn't
+uniform is dropped, and transform_inverse() has the same limit.
+mat4_from_transform() and affine_from_transform() write the matrix directly
+from the rotation, without building and multiplying three matrices.
+*/
+MATHC_API mfloat_t* transform_identity(mfloat_t* result);
+MATHC_API mfloat_t* transform_from_trs(mfloat_t* result, mfloat_t* v0, mfloat_t* q0,
+									   mfloat_t* v1);
+MATHC_API mfloat_t* transform_multiply(mfloat_t* result, mfloat_t* t0, mfloat_t* t1);
+MATHC_API mfloat_t* transform_inverse(mfloat_t* result, mfloat_t* t0);
+MATHC_API mfloat_t* transform_transform_point(mfloat_t* result, mfloat_t* t0, mfloat_t* v0);
+MATHC_API mfloat_t* mat4_from_transform(mfloat_t* result, mfloat_t* t0);
+MATHC_API mfloat_t* affine_from_transform(mfloat_t* result, mfloat_t* t0);
+/*
+A frustum is six planes (a, b, c, d), left, right, bottom, top, near and far,
+whose normals (a, b, c) have unit length and point inside: a point is inside a
+plane when a * x + b * y + c * z + d >= 0. frustum_from_mat4() extracts them
+from a projection or view-projection matrix, in the space of the vectors the
+matrix is applied to, for a depth from -1 to 1 after the projection, like
+mat4_ortho() and mat4_perspective_infinite(). frustum_from_mat4_zo() does the
+same for a depth from 0 to 1, like mat4_perspective() and mat4_perspective_fov().
+*/
+MATHC_API mfloat_t* frustum_from_mat4(mfloat_t* result, mfloat_t* m0);
+MATHC_API mfloat_t* frustum_from_mat4_zo(mfloat_t* result, mfloat_t* m0);
+#endif
+
+#if defined(MATHC_USE_FLOATING_POINT) && defined(MATHC_USE_STREAM_FUNCTIONS)
+/*
+Stream functions process `n` vectors stored as separate component arrays
+(x[0..n-1], y[0..n-1], z[0..n-1]). The result arrays may be the same arrays as
+the inputs, but must not partially overlap them.
+*/
+MATHC_API void vec3_add_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0,
+						  mfloat_t* z0, mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, size_t n);
+MATHC_API void vec3_subtract_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+							   mfloat_t* y0, mfloat_t* z0, mfloat_t* x1, mfloat_t* y1,
+							   mfloat_t* z1, size_t n);
+MATHC_API void vec3_multiply_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+							   mfloat_t* y0, mfloat_t* z0, mfloat_t* x1, mfloat_t* y1,
+							   mfloat_t* z1, size_t n);
+MATHC_API void vec3_multiply_f_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+								 mfloat_t* y0, mfloat_t* z0, mfloat_t f, size_t n);
+MATHC_API void vec3_multiply_mat3_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+									mfloat_t* y0, mfloat_t* z0, mfloat_t* m0, size_t n);
+MATHC_API void vec3_negative_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+							   mfloat_t* y0, mfloat_t* z0, size_t n);
+MATHC_API void vec3_cross_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0,
+							mfloat_t* z0, mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, size_t n);
+MATHC_API void vec3_normalize_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+								mfloat_t* y0, mfloat_t* z0, size_t n);
+MATHC_API void vec3_lerp_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0, mfloat_t* y0,
+						   mfloat_t* z0, mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, mfloat_t f,
+						   size_t n);
+MATHC_API void vec3_dot_n(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+						  mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, size_t n);
+MATHC_API void vec3_length_n(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+							 size_t n);
+MATHC_API void vec3_length_squared_n(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+									 size_t n);
+MATHC_API void vec3_distance_n(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+							   mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, size_t n);
+/*
+Transform `n` vec3 stored every `stride` values of mfloat_t, so positions and
+normals can be read from and written to interleaved vertex buffers. A stride
+of 0 means packed vectors. Points are transformed with w = 1, and are divided by
+the resulting w unless the last row of the matrix is (0, 0, 0, 1). Directions
+are transformed with w = 0, by the upper 3×3 matrix. The result may be the same
+buffer as the input with the same stride, but must not partially overlap it.
+*/
+MATHC_API void mat4_transform_points_n(mfloat_t* result, size_t result_stride, mfloat_t* v0,
+									   size_t v0_stride, mfloat_t* m0, size_t n);
+MATHC_API void mat4_transform_directions_n(mfloat_t* result, size_t result_stride, mfloat_t* v0,
+										   size_t v0_stride, mfloat_t* m0, size_t n);
+/*
+Multiply `n` pairs of mat4 stored every `stride` values of mfloat_t, so the
+matrices can live inside arrays of larger structures. A stride of 0 means
+packed matrices. mat4_multiply_broadcast_left_n() computes m0 × m1[i], such as
+a view-projection matrix applied to every model matrix, and
+mat4_multiply_broadcast_right_n() computes m0[i] × m1. The result may be the
+same buffer as an array input with the same stride, but must not partially
+overlap it or contain the broadcast matrix.
+*/
+MATHC_API void mat4_multiply_n(mfloat_t* result, size_t result_stride, mfloat_t* m0,
+							   size_t m0_stride, mfloat_t* m1, size_t m1_stride, size_t n);
+MATHC_API void mat4_multiply_broadcast_left_n(mfloat_t* result, size_t result_stride,
+											  mfloat_t* m0, mfloat_t* m1, size_t m1_stride,
+											  size_t n);
+MATHC_API void mat4_multiply_broadcast_right_n(mfloat_t* result, size_t result_stride,
+											   mfloat_t* m0, size_t m0_stride, mfloat_t* m1,
+											   size_t n);
+/*
+Test `n` spheres or axis-aligned boxes, stored as separate arrays of center
+components and of radii or half extents, against a frustum from
+frustum_from_mat4() or frustum_from_mat4_zo(). Bit i % 32 of result[i / 32] is set when object i
+intersects the frustum or may intersect it, since an object outside the
+frustum but not entirely outside one of its planes is kept. The unused bits of
+the last word are cleared. The result must hold (n + 31) / 32 words.
+*/
+MATHC_API void frustum_cull_spheres_n(uint32_t* result, mfloat_t* frustum, mfloat_t* x0,
+									  mfloat_t* y0, mfloat_t* z0, mfloat_t* radius, size_t n);
+MATHC_API void frustum_cull_aabbs_n(uint32_t* result, mfloat_t* frustum, mfloat_t* x0,
+									mfloat_t* y0, mfloat_t* z0, mfloat_t* ex, mfloat_t* ey,
+									mfloat_t* ez, size_t n);
+/*
+Intersect a ray with `n` axis-aligned boxes, stored like the boxes of
+frustum_cull_aabbs_n(), or with `n` triangles, stored as separate arrays of the
+components of their three vertices. Return true and write the index of the
+nearest object hit and its distance, in units of the length of `direction`,
+when it is nearer than `max_distance`, which can be INFINITY. A ray starting
+inside a box hits it at distance 0, and triangles are hit from both sides.
+*/
+MATHC_API bool ray_intersect_aabbs_n(mfloat_t* distance, size_t* index, mfloat_t* origin,
+									 mfloat_t* direction, mfloat_t max_distance, mfloat_t* x0,
+									 mfloat_t* y0, mfloat_t* z0, mfloat_t* ex, mfloat_t* ey,
+									 mfloat_t* ez, size_t n);
+MATHC_API bool ray_intersect_triangles_n(mfloat_t* distance, size_t* index, mfloat_t* origin,
+										 mfloat_t* direction, mfloat_t max_distance,
+										 mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* x1,
+										 mfloat_t* y1, mfloat_t* z1, mfloat_t* x2, mfloat_t* y2,
+										 mfloat_t* z2, size_t n);
+/*
+Skin `n` vertices with up to SKIN_BONES bones each, with the bones and their
+weights packed in groups of SKIN_BONES for each vertex. The weights of a
+vertex should add up to 1, and its unused bones have a weight of 0 and any
+index within the palette. The palette holds the skinning matrix of each bone,
+its world matrix times its inverse bind matrix, as affine matrices or as mat4
+whose last row is ignored. The normals are transformed without the translation
+and aren't normalized, which vec3_normalize_n() can do. Pass NULL for the
+normals to skin only the positions. The results may be the inputs.
+*/
+MATHC_API void skin_affine_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx,
+							 mfloat_t* rny, mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0,
+							 mfloat_t* z0, mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+							 uint16_t* bones, mfloat_t* weights, mfloat_t* palette, size_t n);
+MATHC_API void skin_mat4_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx,
+						   mfloat_t* rny, mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+						   mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0, uint16_t* bones,
+						   mfloat_t* weights, mfloat_t* palette, size_t n);
+/*
+Dual quaternion skinning of `n` vertices, stored like those of skin_affine_n(),
+with a palette of unit dual quaternions. The bones of a vertex are blended
+linearly, each flipped to the hemisphere of the first one, and the blend is
+normalized, which keeps the volume of twisted joints that a blend of matrices
+collapses. The normals keep their length.
+*/
+MATHC_API void skin_dualquat_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx,
+							   mfloat_t* rny, mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0,
+							   mfloat_t* z0, mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+							   uint16_t* bones, mfloat_t* weights, mfloat_t* palette, size_t n);
+/*
+Propagate `n` packed local transforms through a hierarchy in one pass. The
+nodes are sorted so that each parent comes before its children: parents[i] is
+the index of the parent of node i, lower than i, or negative for a root.
+transform_hierarchy_n() writes the world transforms, composed with
+transform_multiply(), and may write over the local transforms.
+mat4_from_transform_hierarchy_n() writes the world matrices, `n` packed mat4,
+as the product of the world matrix of the parent and the local matrix, which is
+exact for any scale.
+*/
+MATHC_API void transform_hierarchy_n(mfloat_t* result, mfloat_t* local, int32_t* parents,
+									 size_t n);
+MATHC_API void mat4_from_transform_hierarchy_n(mfloat_t* result, mfloat_t* local,
+											   int32_t* parents, size_t n);
+/*
+Build `n` rotations from packed axes (`n` vec3) and angles (`n` values) into
+packed results. The sine and cosine of the angles are computed together for a
+block of rotations, with a vectorized polynomial in single precision.
+*/
+MATHC_API void mat4_rotation_axis_n(mfloat_t* result, mfloat_t* axes, mfloat_t* angles, size_t n);
+MATHC_API void quat_from_axis_angle_n(mfloat_t* result, mfloat_t* axes, mfloat_t* angles,
+									  size_t n);
+/*
+Blend `n` pairs of quaternions stored as separate component arrays by `f`. q1
+is moved into the hemisphere of q0 without a branch. quat_slerp_n() matches
+quat_slerp(), and vectorizes with MATHC_FAST_TRANSCENDENTALS. quat_nlerp_n()
+normalizes the linear blend, which doesn't rotate at a constant rate: its angle
+is up to 0.14 radians away from the slerp. quat_slerp_fast_n() corrects the
+factor of the nlerp with a polynomial, which brings that error under 1e-3
+radians at about the cost of the nlerp.
+*/
+MATHC_API void quat_nlerp_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw, mfloat_t* x0,
+							mfloat_t* y0, mfloat_t* z0, mfloat_t* w0, mfloat_t* x1, mfloat_t* y1,
+							mfloat_t* z1, mfloat_t* w1, mfloat_t f, size_t n);
+MATHC_API void quat_slerp_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw, mfloat_t* x0,
+							mfloat_t* y0, mfloat_t* z0, mfloat_t* w0, mfloat_t* x1, mfloat_t* y1,
+							mfloat_t* z1, mfloat_t* w1, mfloat_t f, size_t n);
+MATHC_API void quat_slerp_fast_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rw,
+								 mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, mfloat_t* w0,
+								 mfloat_t* x1, mfloat_t* y1, mfloat_t* z1, mfloat_t* w1, mfloat_t f,
+								 size_t n);
+/*
+Rotate `n` vec3 stored as separate component arrays by the unit quaternion
+`q0`. The quaternion is converted to a mat3 once, which is cheaper for each
+vector than quat_rotate_vec3().
+*/
+MATHC_API void quat_rotate_vec3_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* q0,
+								  mfloat_t* x0, mfloat_t* y0, mfloat_t* z0, size_t n);
+/* Angle of each vec2 like vec2_angle(), vectorized with MATHC_FAST_TRANSCENDENTALS */
+MATHC_API void vec2_angle_n(mfloat_t* result, mfloat_t* x0, mfloat_t* y0, size_t n);
 #endif
 
 #if defined(MATHC_USE_STRUCT_FUNCTIONS)
@@ -853,6 +1318,7 @@ MATHC_API struct vec2 svec2_max(struct vec2 v0, struct vec2 v1);
 MATHC_API struct vec2 svec2_min(struct vec2 v0, struct vec2 v1);
 MATHC_API struct vec2 svec2_clamp(struct vec2 v0, struct vec2 v1, struct vec2 v2);
 MATHC_API struct vec2 svec2_normalize(struct vec2 v0);
+MATHC_API struct vec2 svec2_normalize_fast(struct vec2 v0);
 MATHC_API mfloat_t svec2_dot(struct vec2 v0, struct vec2 v1);
 MATHC_API struct vec2 svec2_project(struct vec2 v0, struct vec2 v1);
 MATHC_API struct vec2 svec2_slide(struct vec2 v0, struct vec2 normal);
@@ -899,6 +1365,7 @@ MATHC_API struct vec3 svec3_min(struct vec3 v0, struct vec3 v1);
 MATHC_API struct vec3 svec3_clamp(struct vec3 v0, struct vec3 v1, struct vec3 v2);
 MATHC_API struct vec3 svec3_cross(struct vec3 v0, struct vec3 v1);
 MATHC_API struct vec3 svec3_normalize(struct vec3 v0);
+MATHC_API struct vec3 svec3_normalize_fast(struct vec3 v0);
 MATHC_API mfloat_t svec3_dot(struct vec3 v0, struct vec3 v1);
 MATHC_API struct vec3 svec3_project(struct vec3 v0, struct vec3 v1);
 MATHC_API struct vec3 svec3_slide(struct vec3 v0, struct vec3 normal);
@@ -942,6 +1409,7 @@ MATHC_API struct vec4 svec4_max(struct vec4 v0, struct vec4 v1);
 MATHC_API struct vec4 svec4_min(struct vec4 v0, struct vec4 v1);
 MATHC_API struct vec4 svec4_clamp(struct vec4 v0, struct vec4 v1, struct vec4 v2);
 MATHC_API struct vec4 svec4_normalize(struct vec4 v0);
+MATHC_API struct vec4 svec4_normalize_fast(struct vec4 v0);
 MATHC_API struct vec4 svec4_lerp(struct vec4 v0, struct vec4 v1, mfloat_t f);
 MATHC_API bool squat_is_zero(struct quat q0);
 MATHC_API bool squat_is_equal(struct quat q0, struct quat q1);
@@ -957,6 +1425,7 @@ MATHC_API struct quat squat_negative(struct quat q0);
 MATHC_API struct quat squat_conjugate(struct quat q0);
 MATHC_API struct quat squat_inverse(struct quat q0);
 MATHC_API struct quat squat_normalize(struct quat q0);
+MATHC_API struct quat squat_normalize_fast(struct quat q0);
 MATHC_API mfloat_t squat_dot(struct quat q0, struct quat q1);
 MATHC_API struct quat squat_power(struct quat q0, mfloat_t exponent);
 MATHC_API struct quat squat_from_axis_angle(struct vec3 v0, mfloat_t angle);
@@ -967,6 +1436,7 @@ MATHC_API struct quat squat_slerp(struct quat q0, struct quat q1, mfloat_t f);
 MATHC_API mfloat_t squat_length(struct quat q0);
 MATHC_API mfloat_t squat_length_squared(struct quat q0);
 MATHC_API mfloat_t squat_angle(struct quat q0, struct quat q1);
+MATHC_API struct vec3 squat_rotate_vec3(struct quat q0, struct vec3 v0);
 MATHC_API struct mat2 smat2(mfloat_t m11, mfloat_t m12, mfloat_t m21, mfloat_t m22);
 MATHC_API struct mat2 smat2_zero(void);
 MATHC_API struct mat2 smat2_identity(void);
@@ -1026,6 +1496,8 @@ MATHC_API struct mat4 smat4_scale(struct mat4 m0, struct vec3 v0);
 MATHC_API struct mat4 smat4_multiply(struct mat4 m0, struct mat4 m1);
 MATHC_API struct mat4 smat4_multiply_f(struct mat4 m0, mfloat_t f);
 MATHC_API struct mat4 smat4_inverse(struct mat4 m0);
+MATHC_API struct mat4 smat4_inverse_rigid(struct mat4 m0);
+MATHC_API struct mat4 smat4_inverse_affine(struct mat4 m0);
 MATHC_API struct mat4 smat4_lerp(struct mat4 m0, struct mat4 m1, mfloat_t f);
 MATHC_API struct mat4 smat4_look_at(struct vec3 position, struct vec3 target, struct vec3 up);
 MATHC_API struct mat4 smat4_ortho(mfloat_t l, mfloat_t r, mfloat_t b, mfloat_t t, mfloat_t n,
@@ -1034,6 +1506,30 @@ MATHC_API struct mat4 smat4_perspective(mfloat_t fov_y, mfloat_t aspect, mfloat_
 MATHC_API struct mat4 smat4_perspective_fov(mfloat_t fov, mfloat_t w, mfloat_t h, mfloat_t n,
 											mfloat_t f);
 MATHC_API struct mat4 smat4_perspective_infinite(mfloat_t fov_y, mfloat_t aspect, mfloat_t n);
+MATHC_API struct affine saffine_identity(void);
+MATHC_API struct affine saffine_from_mat4(struct mat4 m0);
+MATHC_API struct mat4 smat4_from_affine(struct affine a0);
+MATHC_API struct affine saffine_multiply(struct affine a0, struct affine a1);
+MATHC_API struct affine saffine_inverse(struct affine a0);
+MATHC_API struct affine saffine_inverse_rigid(struct affine a0);
+MATHC_API struct vec3 saffine_transform_point(struct affine a0, struct vec3 v0);
+MATHC_API struct vec3 saffine_transform_direction(struct affine a0, struct vec3 v0);
+MATHC_API struct dualquat sdualquat_identity(void);
+MATHC_API struct dualquat sdualquat_from_quat_vec3(struct quat q0, struct vec3 v0);
+MATHC_API struct quat squat_from_dualquat(struct dualquat dq0);
+MATHC_API struct vec3 svec3_from_dualquat(struct dualquat dq0);
+MATHC_API struct dualquat sdualquat_from_mat4(struct mat4 m0);
+MATHC_API struct mat4 smat4_from_dualquat(struct dualquat dq0);
+MATHC_API struct dualquat sdualquat_multiply(struct dualquat dq0, struct dualquat dq1);
+MATHC_API struct dualquat sdualquat_normalize(struct dualquat dq0);
+MATHC_API struct vec3 sdualquat_transform_point(struct dualquat dq0, struct vec3 v0);
+MATHC_API struct transform stransform_identity(void);
+MATHC_API struct transform stransform_from_trs(struct vec3 v0, struct quat q0, struct vec3 v1);
+MATHC_API struct transform stransform_multiply(struct transform t0, struct transform t1);
+MATHC_API struct transform stransform_inverse(struct transform t0);
+MATHC_API struct vec3 stransform_transform_point(struct transform t0, struct vec3 v0);
+MATHC_API struct mat4 smat4_from_transform(struct transform t0);
+MATHC_API struct affine saffine_from_transform(struct transform t0);
 #endif
 #endif
 
@@ -1152,6 +1648,7 @@ MATHC_API struct vec2* psvec2_min(struct vec2* result, struct vec2* v0, struct v
 MATHC_API struct vec2* psvec2_clamp(struct vec2* result, struct vec2* v0, struct vec2* v1,
 									struct vec2* v2);
 MATHC_API struct vec2* psvec2_normalize(struct vec2* result, struct vec2* v0);
+MATHC_API struct vec2* psvec2_normalize_fast(struct vec2* result, struct vec2* v0);
 MATHC_API mfloat_t psvec2_dot(struct vec2* v0, struct vec2* v1);
 MATHC_API struct vec2* psvec2_project(struct vec2* result, struct vec2* v0, struct vec2* v1);
 MATHC_API struct vec2* psvec2_slide(struct vec2* result, struct vec2* v0, struct vec2* normal);
@@ -1201,6 +1698,7 @@ MATHC_API struct vec3* psvec3_clamp(struct vec3* result, struct vec3* v0, struct
 									struct vec3* v2);
 MATHC_API struct vec3* psvec3_cross(struct vec3* result, struct vec3* v0, struct vec3* v1);
 MATHC_API struct vec3* psvec3_normalize(struct vec3* result, struct vec3* v0);
+MATHC_API struct vec3* psvec3_normalize_fast(struct vec3* result, struct vec3* v0);
 MATHC_API mfloat_t psvec3_dot(struct vec3* v0, struct vec3* v1);
 MATHC_API struct vec3* psvec3_project(struct vec3* result, struct vec3* v0, struct vec3* v1);
 MATHC_API struct vec3* psvec3_slide(struct vec3* result, struct vec3* v0, struct vec3* normal);
@@ -1248,6 +1746,7 @@ MATHC_API struct vec4* psvec4_min(struct vec4* result, struct vec4* v0, struct v
 MATHC_API struct vec4* psvec4_clamp(struct vec4* result, struct vec4* v0, struct vec4* v1,
 									struct vec4* v2);
 MATHC_API struct vec4* psvec4_normalize(struct vec4* result, struct vec4* v0);
+MATHC_API struct vec4* psvec4_normalize_fast(struct vec4* result, struct vec4* v0);
 MATHC_API struct vec4* psvec4_lerp(struct vec4* result, struct vec4* v0, struct vec4* v1,
 								   mfloat_t f);
 MATHC_API bool psquat_is_zero(struct quat* q0);
@@ -1264,6 +1763,7 @@ MATHC_API struct quat* psquat_negative(struct quat* result, struct quat* q0);
 MATHC_API struct quat* psquat_conjugate(struct quat* result, struct quat* q0);
 MATHC_API struct quat* psquat_inverse(struct quat* result, struct quat* q0);
 MATHC_API struct quat* psquat_normalize(struct quat* result, struct quat* q0);
+MATHC_API struct quat* psquat_normalize_fast(struct quat* result, struct quat* q0);
 MATHC_API mfloat_t psquat_dot(struct quat* q0, struct quat* q1);
 MATHC_API struct quat* psquat_power(struct quat* result, struct quat* q0, mfloat_t exponent);
 MATHC_API struct quat* psquat_from_axis_angle(struct quat* result, struct vec3* v0, mfloat_t angle);
@@ -1276,6 +1776,7 @@ MATHC_API struct quat* psquat_slerp(struct quat* result, struct quat* q0, struct
 MATHC_API mfloat_t psquat_length(struct quat* q0);
 MATHC_API mfloat_t psquat_length_squared(struct quat* q0);
 MATHC_API mfloat_t psquat_angle(struct quat* q0, struct quat* q1);
+MATHC_API struct vec3* psquat_rotate_vec3(struct vec3* result, struct quat* q0, struct vec3* v0);
 MATHC_API struct mat2* psmat2(struct mat2* result, mfloat_t m11, mfloat_t m12, mfloat_t m21,
 							  mfloat_t m22);
 MATHC_API struct mat2* psmat2_zero(struct mat2* result);
@@ -1339,6 +1840,8 @@ MATHC_API struct mat4* psmat4_scale(struct mat4* result, struct mat4* m0, struct
 MATHC_API struct mat4* psmat4_multiply(struct mat4* result, struct mat4* m0, struct mat4* m1);
 MATHC_API struct mat4* psmat4_multiply_f(struct mat4* result, struct mat4* m0, mfloat_t f);
 MATHC_API struct mat4* psmat4_inverse(struct mat4* result, struct mat4* m0);
+MATHC_API struct mat4* psmat4_inverse_rigid(struct mat4* result, struct mat4* m0);
+MATHC_API struct mat4* psmat4_inverse_affine(struct mat4* result, struct mat4* m0);
 MATHC_API struct mat4* psmat4_lerp(struct mat4* result, struct mat4* m0, struct mat4* m1,
 								   mfloat_t f);
 MATHC_API struct mat4* psmat4_look_at(struct mat4* result, struct vec3* position,
@@ -1351,6 +1854,39 @@ MATHC_API struct mat4* psmat4_perspective_fov(struct mat4* result, mfloat_t fov,
 											  mfloat_t h, mfloat_t n, mfloat_t f);
 MATHC_API struct mat4* psmat4_perspective_infinite(struct mat4* result, mfloat_t fov_y,
 												   mfloat_t aspect, mfloat_t n);
+MATHC_API struct affine* psaffine_identity(struct affine* result);
+MATHC_API struct affine* psaffine_from_mat4(struct affine* result, struct mat4* m0);
+MATHC_API struct mat4* psmat4_from_affine(struct mat4* result, struct affine* a0);
+MATHC_API struct affine* psaffine_multiply(struct affine* result, struct affine* a0,
+										   struct affine* a1);
+MATHC_API struct affine* psaffine_inverse(struct affine* result, struct affine* a0);
+MATHC_API struct affine* psaffine_inverse_rigid(struct affine* result, struct affine* a0);
+MATHC_API struct vec3* psaffine_transform_point(struct vec3* result, struct affine* a0,
+												struct vec3* v0);
+MATHC_API struct vec3* psaffine_transform_direction(struct vec3* result, struct affine* a0,
+													struct vec3* v0);
+MATHC_API struct dualquat* psdualquat_identity(struct dualquat* result);
+MATHC_API struct dualquat* psdualquat_from_quat_vec3(struct dualquat* result, struct quat* q0,
+													 struct vec3* v0);
+MATHC_API struct quat* psquat_from_dualquat(struct quat* result, struct dualquat* dq0);
+MATHC_API struct vec3* psvec3_from_dualquat(struct vec3* result, struct dualquat* dq0);
+MATHC_API struct dualquat* psdualquat_from_mat4(struct dualquat* result, struct mat4* m0);
+MATHC_API struct mat4* psmat4_from_dualquat(struct mat4* result, struct dualquat* dq0);
+MATHC_API struct dualquat* psdualquat_multiply(struct dualquat* result, struct dualquat* dq0,
+											   struct dualquat* dq1);
+MATHC_API struct dualquat* psdualquat_normalize(struct dualquat* result, struct dualquat* dq0);
+MATHC_API struct vec3* psdualquat_transform_point(struct vec3* result, struct dualquat* dq0,
+												  struct vec3* v0);
+MATHC_API struct transform* pstransform_identity(struct transform* result);
+MATHC_API struct transform* pstransform_from_trs(struct transform* result, struct vec3* v0,
+												 struct quat* q0, struct vec3* v1);
+MATHC_API struct transform* pstransform_multiply(struct transform* result, struct transform* t0,
+												 struct transform* t1);
+MATHC_API struct transform* pstransform_inverse(struct transform* result, struct transform* t0);
+MATHC_API struct vec3* pstransform_transform_point(struct vec3* result, struct transform* t0,
+												   struct vec3* v0);
+MATHC_API struct mat4* psmat4_from_transform(struct mat4* result, struct transform* t0);
+MATHC_API struct affine* psaffine_from_transform(struct affine* result, struct transform* t0);
 #endif
 #endif
 
@@ -1385,11 +1921,117 @@ MATHC_API mfloat_t back_ease_in_out(mfloat_t f);
 MATHC_API mfloat_t bounce_ease_out(mfloat_t f);
 MATHC_API mfloat_t bounce_ease_in(mfloat_t f);
 MATHC_API mfloat_t bounce_ease_in_out(mfloat_t f);
+
+/*
+Easing tables trade memory for speed: mathc_easing_table() samples `easing` at
+the `size` factors i / (size - 1), and the lookups interpolate the samples for a
+factor `f`, clamped to [0, 1]. `size` must be at least 3. The cubic lookup is a
+Catmull-Rom spline through the samples.
+
+Both are accurate where the curve is smooth. With 256 entries, the largest error
+is 1.2e-3 for the linear lookup and 1.9e-4 for the cubic lookup over the sine,
+polynomial, elastic and back curves, and it shrinks with the square and the
+fourth power of the entry spacing. Near a kink or a jump of the curve the error
+is about the size of the jump within one entry: 7e-3 for the bounce curves,
+2e-2 for the circular curves at their vertical ends and 1e-3 for the exponential
+curves at 0. back_ease_in_out jumps at 0.5, so it can't be tabulated.
+*/
+MATHC_API void mathc_easing_table(mfloat_t* table, size_t size, mfloat_t (*easing)(mfloat_t f));
+MATHC_API mfloat_t mathc_easing_table_linear(mfloat_t* table, size_t size, mfloat_t f);
+MATHC_API mfloat_t mathc_easing_table_cubic(mfloat_t* table, size_t size, mfloat_t f);
+
+/* Samples of x(t) kept by a cubic bezier easing to start the solver */
+#define MATHC_CUBIC_BEZIER_SAMPLES 11
+
+/*
+An easing curve like the CSS cubic-bezier(x1, y1, x2, y2): a cubic bezier from
+(0, 0) to (1, 1) with the control points (x1, y1) and (x2, y2), evaluated as y
+for the x given by the factor.
+*/
+struct mathc_cubic_bezier {
+	/* x(t) = ((ax * t + bx) * t + cx) * t, and y(t) in the same way */
+	mfloat_t ax;
+	mfloat_t bx;
+	mfloat_t cx;
+	mfloat_t ay;
+	mfloat_t by;
+	mfloat_t cy;
+	mfloat_t samples[MATHC_CUBIC_BEZIER_SAMPLES];
+	bool linear;
+};
+
+/*
+Precomputes the curve. `x1` and `x2` are clamped to [0, 1], so that x(t) is
+monotonic. mathc_cubic_bezier_ease() clamps `f` to [0, 1], and finds the
+parameter t of `f` from the samples with Newton-Raphson steps, falling back to
+bisection where the curve is too flat for them. The result is within 1e-5 of
+the exact curve in single precision.
+*/
+MATHC_API struct mathc_cubic_bezier* mathc_cubic_bezier(struct mathc_cubic_bezier* result,
+														mfloat_t x1, mfloat_t y1, mfloat_t x2,
+														mfloat_t y2);
+MATHC_API mfloat_t mathc_cubic_bezier_ease(struct mathc_cubic_bezier* bezier, mfloat_t f);
+
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+/* The easing functions, in the order they are declared */
+enum mathc_easing {
+	MATHC_EASING_QUADRATIC_OUT,
+	MATHC_EASING_QUADRATIC_IN,
+	MATHC_EASING_QUADRATIC_IN_OUT,
+	MATHC_EASING_CUBIC_OUT,
+	MATHC_EASING_CUBIC_IN,
+	MATHC_EASING_CUBIC_IN_OUT,
+	MATHC_EASING_QUARTIC_OUT,
+	MATHC_EASING_QUARTIC_IN,
+	MATHC_EASING_QUARTIC_IN_OUT,
+	MATHC_EASING_QUINTIC_OUT,
+	MATHC_EASING_QUINTIC_IN,
+	MATHC_EASING_QUINTIC_IN_OUT,
+	MATHC_EASING_SINE_OUT,
+	MATHC_EASING_SINE_IN,
+	MATHC_EASING_SINE_IN_OUT,
+	MATHC_EASING_CIRCULAR_OUT,
+	MATHC_EASING_CIRCULAR_IN,
+	MATHC_EASING_CIRCULAR_IN_OUT,
+	MATHC_EASING_EXPONENTIAL_OUT,
+	MATHC_EASING_EXPONENTIAL_IN,
+	MATHC_EASING_EXPONENTIAL_IN_OUT,
+	MATHC_EASING_ELASTIC_OUT,
+	MATHC_EASING_ELASTIC_IN,
+	MATHC_EASING_ELASTIC_IN_OUT,
+	MATHC_EASING_BACK_OUT,
+	MATHC_EASING_BACK_IN,
+	MATHC_EASING_BACK_IN_OUT,
+	MATHC_EASING_BOUNCE_OUT,
+	MATHC_EASING_BOUNCE_IN,
+	MATHC_EASING_BOUNCE_IN_OUT
+};
+
+/*
+Evaluates the easing function `easing` for the `n` values of `f` into `result`,
+which may be the same array as `f`. The curves are computed without branches so
+the loop vectorizes; with MATHC_FAST_TRANSCENDENTALS that includes the curves
+that use sine, square root or powers of two. The results match the easing
+functions within their rounding.
+*/
+MATHC_API void mathc_ease_n(mfloat_t* result, mfloat_t* f, enum mathc_easing easing, size_t n);
+/* The easing table lookups for the `n` values of `f`, which may be the same array as `result` */
+MATHC_API void mathc_easing_table_linear_n(mfloat_t* result, mfloat_t* f, mfloat_t* table,
+										   size_t size, size_t n);
+MATHC_API void mathc_easing_table_cubic_n(mfloat_t* result, mfloat_t* f, mfloat_t* table,
+										  size_t size, size_t n);
+/* mathc_cubic_bezier_ease() for the `n` values of `f`, which may be the same array as `result` */
+MATHC_API void mathc_cubic_bezier_ease_n(mfloat_t* result, mfloat_t* f,
+										 struct mathc_cubic_bezier* bezier, size_t n);
+#endif
 #endif
 
 #ifdef __cplusplus
 }
 #endif
 
+#if defined(MATHC_INLINE) || defined(MATHC_IMPLEMENTATION)
+#include "mathc.c"
+#endif
 
 #endif
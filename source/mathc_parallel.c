@@ -0,0 +1,645 @@
+/*
+Copyright © 2018 Felipe Ferreira da Silva
+
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not claim
+	 that you wrote the original software. If you use this software in a
+	 product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "mathc_parallel.h"
+
+#include <stdlib.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+typedef HANDLE mathc_thread;
+typedef CRITICAL_SECTION mathc_mutex;
+typedef CONDITION_VARIABLE mathc_cond;
+#else
+#include <pthread.h>
+#include <unistd.h>
+typedef pthread_t mathc_thread;
+typedef pthread_mutex_t mathc_mutex;
+typedef pthread_cond_t mathc_cond;
+#endif
+
+#if defined(_WIN32)
+static void mathc_mutex_init(mathc_mutex* mutex)
+{
+	InitializeCriticalSection(mutex);
+}
+
+static void mathc_mutex_destroy(mathc_mutex* mutex)
+{
+	DeleteCriticalSection(mutex);
+}
+
+static void mathc_mutex_lock(mathc_mutex* mutex)
+{
+	EnterCriticalSection(mutex);
+}
+
+static void mathc_mutex_unlock(mathc_mutex* mutex)
+{
+	LeaveCriticalSection(mutex);
+}
+
+static void mathc_cond_init(mathc_cond* cond)
+{
+	InitializeConditionVariable(cond);
+}
+
+static void mathc_cond_destroy(mathc_cond* cond)
+{
+	(void)cond;
+}
+
+static void mathc_cond_wait(mathc_cond* cond, mathc_mutex* mutex)
+{
+	SleepConditionVariableCS(cond, mutex, INFINITE);
+}
+
+static void mathc_cond_broadcast(mathc_cond* cond)
+{
+	WakeAllConditionVariable(cond);
+}
+
+static size_t mathc_processor_count(void)
+{
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (size_t)info.dwNumberOfProcessors;
+}
+#else
+static void mathc_mutex_init(mathc_mutex* mutex)
+{
+	pthread_mutex_init(mutex, NULL);
+}
+
+static void mathc_mutex_destroy(mathc_mutex* mutex)
+{
+	pthread_mutex_destroy(mutex);
+}
+
+static void mathc_mutex_lock(mathc_mutex* mutex)
+{
+	pthread_mutex_lock(mutex);
+}
+
+static void mathc_mutex_unlock(mathc_mutex* mutex)
+{
+	pthread_mutex_unlock(mutex);
+}
+
+static void mathc_cond_init(mathc_cond* cond)
+{
+	pthread_cond_init(cond, NULL);
+}
+
+static void mathc_cond_destroy(mathc_cond* cond)
+{
+	pthread_cond_destroy(cond);
+}
+
+static void mathc_cond_wait(mathc_cond* cond, mathc_mutex* mutex)
+{
+	pthread_cond_wait(cond, mutex);
+}
+
+static void mathc_cond_broadcast(mathc_cond* cond)
+{
+	pthread_cond_broadcast(cond);
+}
+
+static size_t mathc_processor_count(void)
+{
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return count > 0 ? (size_t)count : 1;
+}
+#endif
+
+/*
+The built-in thread pool runs one job at a time. The calling thread and the
+workers claim its chunks in order from a shared counter, so a thread that
+finishes early takes the next chunk instead of idling.
+*/
+struct mathc_parallel_pool {
+	mathc_thread* threads;
+	size_t worker_count;
+	/* Serializes the callers of mathc_parallel_for() */
+	mathc_mutex run;
+	/* Guards the fields below */
+	mathc_mutex mutex;
+	/* Signaled when a job starts or the pool stops */
+	mathc_cond work;
+	/* Signaled when the last chunk of a job finishes */
+	mathc_cond done;
+	mathc_parallel_job job;
+	void* job_context;
+	size_t chunk_count;
+	size_t next_chunk;
+	size_t finished_chunks;
+	bool stop;
+};
+
+static struct mathc_parallel_pool mathc_pool;
+static bool mathc_pool_running;
+static mathc_parallel_scheduler mathc_scheduler;
+static void* mathc_scheduler_context;
+
+/* Runs the remaining chunks of the current job, with the mutex locked */
+static void mathc_pool_work(struct mathc_parallel_pool* pool)
+{
+	while (pool->next_chunk < pool->chunk_count) {
+		mathc_parallel_job job = pool->job;
+		void* job_context = pool->job_context;
+		size_t chunk = pool->next_chunk++;
+		mathc_mutex_unlock(&pool->mutex);
+		job(job_context, chunk);
+		mathc_mutex_lock(&pool->mutex);
+		pool->finished_chunks++;
+		if (pool->finished_chunks == pool->chunk_count) {
+			mathc_cond_broadcast(&pool->done);
+		}
+	}
+}
+
+static void mathc_pool_worker(struct mathc_parallel_pool* pool)
+{
+	mathc_mutex_lock(&pool->mutex);
+	while (!pool->stop) {
+		if (pool->next_chunk < pool->chunk_count) {
+			mathc_pool_work(pool);
+		} else {
+			mathc_cond_wait(&pool->work, &pool->mutex);
+		}
+	}
+	mathc_mutex_unlock(&pool->mutex);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI mathc_pool_thread(LPVOID pool)
+{
+	mathc_pool_worker(pool);
+	return 0;
+}
+
+static bool mathc_thread_create(mathc_thread* thread, struct mathc_parallel_pool* pool)
+{
+	*thread = CreateThread(NULL, 0, mathc_pool_thread, pool, 0, NULL);
+	return *thread != NULL;
+}
+
+static void mathc_thread_join(mathc_thread thread)
+{
+	WaitForSingleObject(thread, INFINITE);
+	CloseHandle(thread);
+}
+#else
+static void* mathc_pool_thread(void* pool)
+{
+	mathc_pool_worker(pool);
+	return NULL;
+}
+
+static bool mathc_thread_create(mathc_thread* thread, struct mathc_parallel_pool* pool)
+{
+	return pthread_create(thread, NULL, mathc_pool_thread, pool) == 0;
+}
+
+static void mathc_thread_join(mathc_thread thread)
+{
+	pthread_join(thread, NULL);
+}
+#endif
+
+static void mathc_pool_schedule(void* scheduler_context, mathc_parallel_job job, void* job_context,
+								size_t chunk_count)
+{
+	struct mathc_parallel_pool* pool = scheduler_context;
+	mathc_mutex_lock(&pool->run);
+	mathc_mutex_lock(&pool->mutex);
+	pool->job = job;
+	pool->job_context = job_context;
+	pool->chunk_count = chunk_count;
+	pool->next_chunk = 0;
+	pool->finished_chunks = 0;
+	mathc_cond_broadcast(&pool->work);
+	mathc_pool_work(pool);
+	while (pool->finished_chunks < pool->chunk_count) {
+		mathc_cond_wait(&pool->done, &pool->mutex);
+	}
+	pool->job = NULL;
+	pool->job_context = NULL;
+	pool->chunk_count = 0;
+	pool->next_chunk = 0;
+	mathc_mutex_unlock(&pool->mutex);
+	mathc_mutex_unlock(&pool->run);
+}
+
+static void mathc_pool_stop(struct mathc_parallel_pool* pool, size_t started)
+{
+	size_t i;
+	mathc_mutex_lock(&pool->mutex);
+	pool->stop = true;
+	mathc_cond_broadcast(&pool->work);
+	mathc_mutex_unlock(&pool->mutex);
+	for (i = 0; i < started; ++i) {
+		mathc_thread_join(pool->threads[i]);
+	}
+	free(pool->threads);
+	mathc_cond_destroy(&pool->done);
+	mathc_cond_destroy(&pool->work);
+	mathc_mutex_destroy(&pool->mutex);
+	mathc_mutex_destroy(&pool->run);
+}
+
+bool mathc_parallel_init(size_t thread_count)
+{
+	struct mathc_parallel_pool* pool = &mathc_pool;
+	size_t i;
+	mathc_parallel_shutdown();
+	if (thread_count == 0) {
+		thread_count = mathc_processor_count();
+	}
+	if (thread_count <= 1) {
+		return true;
+	}
+#if defined(MATHC_USE_FLOATING_POINT)
+	/* Selects the SIMD functions now, so the workers never race to do it */
+	mathc_simd_get();
+#endif
+	pool->worker_count = thread_count - 1;
+	pool->threads = malloc(pool->worker_count * sizeof(mathc_thread));
+	if (pool->threads == NULL) {
+		return false;
+	}
+	pool->job = NULL;
+	pool->job_context = NULL;
+	pool->chunk_count = 0;
+	pool->next_chunk = 0;
+	pool->finished_chunks = 0;
+	pool->stop = false;
+	mathc_mutex_init(&pool->run);
+	mathc_mutex_init(&pool->mutex);
+	mathc_cond_init(&pool->work);
+	mathc_cond_init(&pool->done);
+	for (i = 0; i < pool->worker_count; ++i) {
+		if (!mathc_thread_create(&pool->threads[i], pool)) {
+			mathc_pool_stop(pool, i);
+			return false;
+		}
+	}
+	mathc_pool_running = true;
+	return true;
+}
+
+void mathc_parallel_shutdown(void)
+{
+	if (mathc_pool_running) {
+		mathc_pool_stop(&mathc_pool, mathc_pool.worker_count);
+		mathc_pool_running = false;
+	}
+}
+
+size_t mathc_parallel_thread_count(void)
+{
+	return mathc_pool_running ? mathc_pool.worker_count + 1 : 1;
+}
+
+void mathc_parallel_set_scheduler(mathc_parallel_scheduler scheduler, void* scheduler_context)
+{
+	mathc_scheduler = scheduler;
+	mathc_scheduler_context = scheduler_context;
+}
+
+struct mathc_parallel_range {
+	mathc_parallel_task task;
+	void* context;
+	size_t n;
+	size_t grain;
+};
+
+static void mathc_parallel_range_job(void* job_context, size_t chunk)
+{
+	struct mathc_parallel_range* range = job_context;
+	size_t begin = chunk * range->grain;
+	size_t end = range->n - begin < range->grain ? range->n : begin + range->grain;
+	range->task(range->context, begin, end);
+}
+
+void mathc_parallel_for(size_t n, size_t grain, mathc_parallel_task task, void* context)
+{
+	struct mathc_parallel_range range;
+	size_t chunk_count;
+	size_t i;
+	if (n == 0) {
+		return;
+	}
+	if (grain == 0) {
+		grain = MATHC_PARALLEL_GRAIN;
+	}
+	chunk_count = (n - 1) / grain + 1;
+	range.task = task;
+	range.context = context;
+	range.n = n;
+	range.grain = grain;
+	if (chunk_count == 1) {
+		task(context, 0, n);
+	} else if (mathc_scheduler != NULL) {
+		mathc_scheduler(mathc_scheduler_context, mathc_parallel_range_job, &range, chunk_count);
+	} else if (mathc_pool_running) {
+		mathc_pool_schedule(&mathc_pool, mathc_parallel_range_job, &range, chunk_count);
+	} else {
+		for (i = 0; i < chunk_count; ++i) {
+			mathc_parallel_range_job(&range, i);
+		}
+	}
+}
+
+#if defined(MATHC_USE_FLOATING_POINT) && defined(MATHC_USE_STREAM_FUNCTIONS)
+struct mathc_parallel_stream {
+	mfloat_t* rx;
+	mfloat_t* ry;
+	mfloat_t* rz;
+	mfloat_t* x0;
+	mfloat_t* y0;
+	mfloat_t* z0;
+	mfloat_t* m0;
+};
+
+static void mathc_parallel_vec3_multiply_mat3_task(void* context, size_t begin, size_t end)
+{
+	struct mathc_parallel_stream* s = context;
+	vec3_multiply_mat3_n(s->rx + begin, s->ry + begin, s->rz + begin, s->x0 + begin,
+						 s->y0 + begin, s->z0 + begin, s->m0, end - begin);
+}
+
+void mathc_parallel_vec3_multiply_mat3_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+										 mfloat_t* y0, mfloat_t* z0, mfloat_t* m0, size_t n)
+{
+	struct mathc_parallel_stream s = {rx, ry, rz, x0, y0, z0, m0};
+	mathc_parallel_for(n, 0, mathc_parallel_vec3_multiply_mat3_task, &s);
+}
+
+static void mathc_parallel_vec3_normalize_task(void* context, size_t begin, size_t end)
+{
+	struct mathc_parallel_stream* s = context;
+	vec3_normalize_n(s->rx + begin, s->ry + begin, s->rz + begin, s->x0 + begin, s->y0 + begin,
+					 s->z0 + begin, end - begin);
+}
+
+void mathc_parallel_vec3_normalize_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* x0,
+									 mfloat_t* y0, mfloat_t* z0, size_t n)
+{
+	struct mathc_parallel_stream s = {rx, ry, rz, x0, y0, z0, NULL};
+	mathc_parallel_for(n, 0, mathc_parallel_vec3_normalize_task, &s);
+}
+
+struct mathc_parallel_transform {
+	mfloat_t* result;
+	size_t result_stride;
+	mfloat_t* v0;
+	size_t v0_stride;
+	mfloat_t* m0;
+};
+
+static void mathc_parallel_transform_points_task(void* context, size_t begin, size_t end)
+{
+	struct mathc_parallel_transform* t = context;
+	mat4_transform_points_n(t->result + begin * t->result_stride, t->result_stride,
+							t->v0 + begin * t->v0_stride, t->v0_stride, t->m0, end - begin);
+}
+
+static void mathc_parallel_transform_directions_task(void* context, size_t begin, size_t end)
+{
+	struct mathc_parallel_transform* t = context;
+	mat4_transform_directions_n(t->result + begin * t->result_stride, t->result_stride,
+								t->v0 + begin * t->v0_stride, t->v0_stride, t->m0, end - begin);
+}
+
+void mathc_parallel_mat4_transform_points_n(mfloat_t* result, size_t result_stride, mfloat_t* v0,
+											size_t v0_stride, mfloat_t* m0, size_t n)
+{
+	struct mathc_parallel_transform t = {result, result_stride ? result_stride : VEC3_SIZE, v0,
+										 v0_stride ? v0_stride : VEC3_SIZE, m0};
+	mathc_parallel_for(n, 0, mathc_parallel_transform_points_task, &t);
+}
+
+void mathc_parallel_mat4_transform_directions_n(mfloat_t* result, size_t result_stride,
+												mfloat_t* v0, size_t v0_stride, mfloat_t* m0,
+												size_t n)
+{
+	struct mathc_parallel_transform t = {result, result_stride ? result_stride : VEC3_SIZE, v0,
+										 v0_stride ? v0_stride : VEC3_SIZE, m0};
+	mathc_parallel_for(n, 0, mathc_parallel_transform_directions_task, &t);
+}
+
+/* A stride of 0 marks the broadcast matrix */
+struct mathc_parallel_multiply {
+	mfloat_t* result;
+	size_t result_stride;
+	mfloat_t* m0;
+	size_t m0_stride;
+	mfloat_t* m1;
+	size_t m1_stride;
+};
+
+static void mathc_parallel_multiply_task(void* context, size_t begin, size_t end)
+{
+	struct mathc_parallel_multiply* t = context;
+	mfloat_t* result = t->result + begin * t->result_stride;
+	mfloat_t* m0 = t->m0 + begin * t->m0_stride;
+	mfloat_t* m1 = t->m1 + begin * t->m1_stride;
+	if (t->m0_stride == 0) {
+		mat4_multiply_broadcast_left_n(result, t->result_stride, m0, m1, t->m1_stride,
+									   end - begin);
+	} else if (t->m1_stride == 0) {
+		mat4_multiply_broadcast_right_n(result, t->result_stride, m0, t->m0_stride, m1,
+										end - begin);
+	} else {
+		mat4_multiply_n(result, t->result_stride, m0, t->m0_stride, m1, t->m1_stride,
+						end - begin);
+	}
+}
+
+void mathc_parallel_mat4_multiply_n(mfloat_t* result, size_t result_stride, mfloat_t* m0,
+									size_t m0_stride, mfloat_t* m1, size_t m1_stride, size_t n)
+{
+	struct mathc_parallel_multiply t = {result, result_stride ? result_stride : MAT4_SIZE, m0,
+										m0_stride ? m0_stride : MAT4_SIZE, m1,
+										m1_stride ? m1_stride : MAT4_SIZE};
+	mathc_parallel_for(n, 0, mathc_parallel_multiply_task, &t);
+}
+
+void mathc_parallel_mat4_multiply_broadcast_left_n(mfloat_t* result, size_t result_stride,
+												   mfloat_t* m0, mfloat_t* m1, size_t m1_stride,
+												   size_t n)
+{
+	struct mathc_parallel_multiply t = {result, result_stride ? result_stride : MAT4_SIZE, m0, 0,
+										m1, m1_stride ? m1_stride : MAT4_SIZE};
+	mathc_parallel_for(n, 0, mathc_parallel_multiply_task, &t);
+}
+
+void mathc_parallel_mat4_multiply_broadcast_right_n(mfloat_t* result, size_t result_stride,
+													mfloat_t* m0, size_t m0_stride, mfloat_t* m1,
+													size_t n)
+{
+	struct mathc_parallel_multiply t = {result, result_stride ? result_stride : MAT4_SIZE, m0,
+										m0_stride ? m0_stride : MAT4_SIZE, m1, 0};
+	mathc_parallel_for(n, 0, mathc_parallel_multiply_task, &t);
+}
+
+/* The chunks must cover whole words of the visibility mask */
+#if MATHC_PARALLEL_GRAIN % 32 != 0
+#error "MATHC_PARALLEL_GRAIN must be a multiple of 32"
+#endif
+
+/* ex holds the radii of the spheres */
+struct mathc_parallel_cull {
+	uint32_t* result;
+	mfloat_t* frustum;
+	mfloat_t* x0;
+	mfloat_t* y0;
+	mfloat_t* z0;
+	mfloat_t* ex;
+	mfloat_t* ey;
+	mfloat_t* ez;
+};
+
+static void mathc_parallel_cull_spheres_task(void* context, size_t begin, size_t end)
+{
+	struct mathc_parallel_cull* t = context;
+	frustum_cull_spheres_n(t->result + begin / 32, t->frustum, t->x0 + begin, t->y0 + begin,
+						   t->z0 + begin, t->ex + begin, end - begin);
+}
+
+static void mathc_parallel_cull_aabbs_task(void* context, size_t begin, size_t end)
+{
+	struct mathc_parallel_cull* t = context;
+	frustum_cull_aabbs_n(t->result + begin / 32, t->frustum, t->x0 + begin, t->y0 + begin,
+						 t->z0 + begin, t->ex + begin, t->ey + begin, t->ez + begin,
+						 end - begin);
+}
+
+void mathc_parallel_frustum_cull_spheres_n(uint32_t* result, mfloat_t* frustum, mfloat_t* x0,
+										   mfloat_t* y0, mfloat_t* z0, mfloat_t* radius, size_t n)
+{
+	struct mathc_parallel_cull t = {result, frustum, x0, y0, z0, radius, NULL, NULL};
+	mathc_parallel_for(n, 0, mathc_parallel_cull_spheres_task, &t);
+}
+
+void mathc_parallel_frustum_cull_aabbs_n(uint32_t* result, mfloat_t* frustum, mfloat_t* x0,
+										 mfloat_t* y0, mfloat_t* z0, mfloat_t* ex, mfloat_t* ey,
+										 mfloat_t* ez, size_t n)
+{
+	struct mathc_parallel_cull t = {result, frustum, x0, y0, z0, ex, ey, ez};
+	mathc_parallel_for(n, 0, mathc_parallel_cull_aabbs_task, &t);
+}
+
+/* Normals may be NULL, palette holds affine, mat4 or dual quaternion bones */
+struct mathc_parallel_skin {
+	mfloat_t* rx;
+	mfloat_t* ry;
+	mfloat_t* rz;
+	mfloat_t* rnx;
+	mfloat_t* rny;
+	mfloat_t* rnz;
+	mfloat_t* x0;
+	mfloat_t* y0;
+	mfloat_t* z0;
+	mfloat_t* nx0;
+	mfloat_t* ny0;
+	mfloat_t* nz0;
+	uint16_t* bones;
+	mfloat_t* weights;
+	mfloat_t* palette;
+};
+
+static mfloat_t* mathc_parallel_offset(mfloat_t* stream, size_t begin)
+{
+	return stream != NULL ? stream + begin : NULL;
+}
+
+static void mathc_parallel_skin_affine_task(void* context, size_t begin, size_t end)
+{
+	struct mathc_parallel_skin* t = context;
+	skin_affine_n(t->rx + begin, t->ry + begin, t->rz + begin,
+				  mathc_parallel_offset(t->rnx, begin), mathc_parallel_offset(t->rny, begin),
+				  mathc_parallel_offset(t->rnz, begin), t->x0 + begin, t->y0 + begin,
+				  t->z0 + begin, mathc_parallel_offset(t->nx0, begin),
+				  mathc_parallel_offset(t->ny0, begin), mathc_parallel_offset(t->nz0, begin),
+				  t->bones + begin * SKIN_BONES, t->weights + begin * SKIN_BONES, t->palette,
+				  end - begin);
+}
+
+static void mathc_parallel_skin_mat4_task(void* context, size_t begin, size_t end)
+{
+	struct mathc_parallel_skin* t = context;
+	skin_mat4_n(t->rx + begin, t->ry + begin, t->rz + begin, mathc_parallel_offset(t->rnx, begin),
+				mathc_parallel_offset(t->rny, begin), mathc_parallel_offset(t->rnz, begin),
+				t->x0 + begin, t->y0 + begin, t->z0 + begin, mathc_parallel_offset(t->nx0, begin),
+				mathc_parallel_offset(t->ny0, begin), mathc_parallel_offset(t->nz0, begin),
+				t->bones + begin * SKIN_BONES, t->weights + begin * SKIN_BONES, t->palette,
+				end - begin);
+}
+
+static void mathc_parallel_skin_dualquat_task(void* context, size_t begin, size_t end)
+{
+	struct mathc_parallel_skin* t = context;
+	skin_dualquat_n(t->rx + begin, t->ry + begin, t->rz + begin,
+					mathc_parallel_offset(t->rnx, begin), mathc_parallel_offset(t->rny, begin),
+					mathc_parallel_offset(t->rnz, begin), t->x0 + begin, t->y0 + begin,
+					t->z0 + begin, mathc_parallel_offset(t->nx0, begin),
+					mathc_parallel_offset(t->ny0, begin), mathc_parallel_offset(t->nz0, begin),
+					t->bones + begin * SKIN_BONES, t->weights + begin * SKIN_BONES, t->palette,
+					end - begin);
+}
+
+void mathc_parallel_skin_affine_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx,
+								  mfloat_t* rny, mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0,
+								  mfloat_t* z0, mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+								  uint16_t* bones, mfloat_t* weights, mfloat_t* palette, size_t n)
+{
+	struct mathc_parallel_skin t = {rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0,
+									bones, weights, palette};
+	mathc_parallel_for(n, 0, mathc_parallel_skin_affine_task, &t);
+}
+
+void mathc_parallel_skin_mat4_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx,
+								mfloat_t* rny, mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0,
+								mfloat_t* z0, mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+								uint16_t* bones, mfloat_t* weights, mfloat_t* palette, size_t n)
+{
+	struct mathc_parallel_skin t = {rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0,
+									bones, weights, palette};
+	mathc_parallel_for(n, 0, mathc_parallel_skin_mat4_task, &t);
+}
+
+void mathc_parallel_skin_dualquat_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, mfloat_t* rnx,
+									mfloat_t* rny, mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0,
+									mfloat_t* z0, mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+									uint16_t* bones, mfloat_t* weights, mfloat_t* palette,
+									size_t n)
+{
+	struct mathc_parallel_skin t = {rx, ry, rz, rnx, rny, rnz, x0, y0, z0, nx0, ny0, nz0,
+									bones, weights, palette};
+	mathc_parallel_for(n, 0, mathc_parallel_skin_dualquat_task, &t);
+}
+#endif
@@ -0,0 +1,150 @@
+/*
+Copyright © 2018 Felipe Ferreira da Silva
+
+This software is provided 'as-is', without any express or implied warranty. In
+no event will the authors be held liable for any damages arising from the use of
+this software.
+
+Permission is granted to anyone to use this software for any purpose, including
+commercial applications, and to alter it and redistribute it freely, subject to
+the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not claim
+	 that you wrote the original software. If you use this software in a
+	 product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef MATHC_PARALLEL_H
+#define MATHC_PARALLEL_H
+
+#include "mathc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_WIN32) || defined(__CYGWIN__)
+#if defined(MATHC_BUILDING_SHARED)
+#define MATHC_PARALLEL_API __declspec(dllexport)
+#elif defined(MATHC_SHARED)
+#define MATHC_PARALLEL_API __declspec(dllimport)
+#else
+#define MATHC_PARALLEL_API
+#endif
+#else
+#if defined(MATHC_BUILDING_SHARED) || defined(MATHC_SHARED)
+#define MATHC_PARALLEL_API __attribute__((visibility("default")))
+#else
+#define MATHC_PARALLEL_API
+#endif
+#endif
+
+/* Items in each chunk when the grain given to mathc_parallel_for() is 0 */
+#define MATHC_PARALLEL_GRAIN 4096
+
+/*
+A range of items [begin, end) processed by one call of the task.
+*/
+typedef void (*mathc_parallel_task)(void* context, size_t begin, size_t end);
+
+/*
+A scheduler runs `job(job_context, chunk)` once for each chunk in
+[0, chunk_count), in any order and on any threads, and returns once every call
+has returned. Set one with mathc_parallel_set_scheduler() to run the work on
+an existing job system instead of the built-in thread pool.
+*/
+typedef void (*mathc_parallel_job)(void* job_context, size_t chunk);
+typedef void (*mathc_parallel_scheduler)(void* scheduler_context, mathc_parallel_job job,
+										 void* job_context, size_t chunk_count);
+
+/*
+Starts the built-in thread pool with `thread_count` threads, counting the
+calling thread, or one thread per processor if `thread_count` is 0. Returns
+false if the threads can't be created. Until it is called, the work runs on the
+calling thread. Don't call it while another thread is inside mathc_parallel_for().
+*/
+MATHC_PARALLEL_API bool mathc_parallel_init(size_t thread_count);
+MATHC_PARALLEL_API void mathc_parallel_shutdown(void);
+/* Threads used by the built-in thread pool, 1 if it isn't running */
+MATHC_PARALLEL_API size_t mathc_parallel_thread_count(void);
+/* A NULL scheduler restores the built-in thread pool */
+MATHC_PARALLEL_API void mathc_parallel_set_scheduler(mathc_parallel_scheduler scheduler,
+													 void* scheduler_context);
+
+/*
+Splits [0, n) into chunks of `grain` items, or MATHC_PARALLEL_GRAIN if `grain`
+is 0, and calls `task` once for each chunk. The chunks only depend on `n` and
+`grain`, so the results are bit-identical for any number of threads or
+scheduler. Returns after every chunk is processed. Tasks must not call
+mathc_parallel_for() again.
+*/
+MATHC_PARALLEL_API void mathc_parallel_for(size_t n, size_t grain, mathc_parallel_task task,
+										   void* context);
+
+#if defined(MATHC_USE_FLOATING_POINT) && defined(MATHC_USE_STREAM_FUNCTIONS)
+/* Stream functions split over mathc_parallel_for() with the default grain */
+MATHC_PARALLEL_API void mathc_parallel_vec3_multiply_mat3_n(mfloat_t* rx, mfloat_t* ry,
+															mfloat_t* rz, mfloat_t* x0,
+															mfloat_t* y0, mfloat_t* z0,
+															mfloat_t* m0, size_t n);
+MATHC_PARALLEL_API void mathc_parallel_vec3_normalize_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz,
+														mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+														size_t n);
+MATHC_PARALLEL_API void mathc_parallel_mat4_transform_points_n(mfloat_t* result,
+															   size_t result_stride, mfloat_t* v0,
+															   size_t v0_stride, mfloat_t* m0,
+															   size_t n);
+MATHC_PARALLEL_API void mathc_parallel_mat4_transform_directions_n(mfloat_t* result,
+																   size_t result_stride,
+																   mfloat_t* v0, size_t v0_stride,
+																   mfloat_t* m0, size_t n);
+MATHC_PARALLEL_API void mathc_parallel_mat4_multiply_n(mfloat_t* result, size_t result_stride,
+													   mfloat_t* m0, size_t m0_stride,
+													   mfloat_t* m1, size_t m1_stride, size_t n);
+MATHC_PARALLEL_API void mathc_parallel_mat4_multiply_broadcast_left_n(mfloat_t* result,
+																	  size_t result_stride,
+																	  mfloat_t* m0, mfloat_t* m1,
+																	  size_t m1_stride, size_t n);
+MATHC_PARALLEL_API void mathc_parallel_mat4_multiply_broadcast_right_n(mfloat_t* result,
+																	   size_t result_stride,
+																	   mfloat_t* m0,
+																	   size_t m0_stride,
+																	   mfloat_t* m1, size_t n);
+MATHC_PARALLEL_API void mathc_parallel_frustum_cull_spheres_n(uint32_t* result, mfloat_t* frustum,
+															  mfloat_t* x0, mfloat_t* y0,
+															  mfloat_t* z0, mfloat_t* radius,
+															  size_t n);
+MATHC_PARALLEL_API void mathc_parallel_frustum_cull_aabbs_n(uint32_t* result, mfloat_t* frustum,
+															mfloat_t* x0, mfloat_t* y0,
+															mfloat_t* z0, mfloat_t* ex,
+															mfloat_t* ey, mfloat_t* ez, size_t n);
+MATHC_PARALLEL_API void mathc_parallel_skin_affine_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz,
+													 mfloat_t* rnx, mfloat_t* rny, mfloat_t* rnz,
+													 mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+													 mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+													 uint16_t* bones, mfloat_t* weights,
+													 mfloat_t* palette, size_t n);
+MATHC_PARALLEL_API void mathc_parallel_skin_mat4_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz,
+												   mfloat_t* rnx, mfloat_t* rny, mfloat_t* rnz,
+												   mfloat_t* x0, mfloat_t* y0, mfloat_t* z0,
+												   mfloat_t* nx0, mfloat_t* ny0, mfloat_t* nz0,
+												   uint16_t* bones, mfloat_t* weights,
+												   mfloat_t* palette, size_t n);
+MATHC_PARALLEL_API void mathc_parallel_skin_dualquat_n(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz,
+													   mfloat_t* rnx, mfloat_t* rny,
+													   mfloat_t* rnz, mfloat_t* x0, mfloat_t* y0,
+													   mfloat_t* z0, mfloat_t* nx0,
+													   mfloat_t* ny0, mfloat_t* nz0,
+													   uint16_t* bones, mfloat_t* weights,
+													   mfloat_t* palette, size_t n);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
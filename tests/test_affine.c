@@ -0,0 +1,219 @@
+#include <float.h>
+
+#include "mathc.h"
+#include "minunit.h"
+
+#define EPSILON 0.0001f
+
+static bool float_eq(mfloat_t a, mfloat_t b)
+{
+	return MFABS(a - b) < EPSILON;
+}
+
+/* A mat4 with a rotation, a scale that isn't uniform and a translation */
+static void affine_mat4(mfloat_t* result, mfloat_t angle, mfloat_t scale, bool rigid)
+{
+	mfloat_t axis[VEC3_SIZE] = {1.0f, -2.0f, 0.5f};
+	vec3_normalize(axis, axis);
+	mat4_rotation_axis(result, axis, angle);
+	if (!rigid) {
+		for (int i = 0; i < 3; i++) {
+			result[i] *= scale;
+			result[4 + i] *= 2.0f;
+			result[8 + i] *= 0.5f;
+		}
+	}
+	result[12] = 3.0f * angle;
+	result[13] = -1.0f;
+	result[14] = scale;
+}
+
+MU_TEST(test_affine_identity)
+{
+	mfloat_t a[AFFINE_SIZE];
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t identity[MAT4_SIZE];
+	affine_identity(a);
+	mat4_from_affine(m, a);
+	mat4_identity(identity);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(identity[i] == m[i], "identity");
+	}
+}
+
+MU_TEST(test_affine_mat4_round_trip)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t a[AFFINE_SIZE];
+	mfloat_t result[MAT4_SIZE];
+	affine_mat4(m, 0.7f, 3.0f, false);
+	affine_from_mat4(a, m);
+	mat4_from_affine(result, a);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(m[i] == result[i], "lossless");
+	}
+	mu_assert(a[9] == m[12] && a[10] == m[13] && a[11] == m[14], "translation in the last column");
+}
+
+MU_TEST(test_affine_multiply)
+{
+	mfloat_t m0[MAT4_SIZE];
+	mfloat_t m1[MAT4_SIZE];
+	mfloat_t expected[MAT4_SIZE];
+	mfloat_t a0[AFFINE_SIZE];
+	mfloat_t a1[AFFINE_SIZE];
+	mfloat_t result[MAT4_SIZE];
+	affine_mat4(m0, 0.7f, 3.0f, false);
+	affine_mat4(m1, -1.3f, 0.25f, false);
+	mat4_multiply(expected, m0, m1);
+	affine_from_mat4(a0, m0);
+	affine_from_mat4(a1, m1);
+	affine_multiply(a0, a0, a1);
+	mat4_from_affine(result, a0);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(float_eq(expected[i], result[i]), "matches mat4_multiply");
+	}
+}
+
+MU_TEST(test_affine_inverse)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t expected[MAT4_SIZE];
+	mfloat_t a[AFFINE_SIZE];
+	mfloat_t inverse[AFFINE_SIZE];
+	mfloat_t result[MAT4_SIZE];
+	affine_mat4(m, 2.1f, 3.0f, false);
+	mat4_inverse(expected, m);
+	affine_from_mat4(a, m);
+	affine_inverse(inverse, a);
+	mat4_from_affine(result, inverse);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(float_eq(expected[i], result[i]), "matches mat4_inverse");
+	}
+	affine_multiply(inverse, inverse, a);
+	affine_identity(a);
+	for (int i = 0; i < AFFINE_SIZE; i++) {
+		mu_assert(float_eq(a[i], inverse[i]), "inverse times matrix is identity");
+	}
+}
+
+MU_TEST(test_affine_inverse_rigid)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t a[AFFINE_SIZE];
+	mfloat_t expected[AFFINE_SIZE];
+	mfloat_t result[AFFINE_SIZE];
+	affine_mat4(m, -0.4f, 1.0f, true);
+	affine_from_mat4(a, m);
+	affine_inverse(expected, a);
+	affine_inverse_rigid(result, a);
+	for (int i = 0; i < AFFINE_SIZE; i++) {
+		mu_assert(float_eq(expected[i], result[i]), "matches affine_inverse");
+	}
+	affine_inverse_rigid(a, a);
+	for (int i = 0; i < AFFINE_SIZE; i++) {
+		mu_assert(float_eq(expected[i], a[i]), "in place");
+	}
+}
+
+MU_TEST(test_affine_transform)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t a[AFFINE_SIZE];
+	mfloat_t point[VEC4_SIZE] = {1.5f, -2.0f, 4.0f, 1.0f};
+	mfloat_t direction[VEC4_SIZE] = {1.5f, -2.0f, 4.0f, 0.0f};
+	mfloat_t result[VEC3_SIZE];
+	affine_mat4(m, 0.7f, 3.0f, false);
+	affine_from_mat4(a, m);
+	affine_transform_point(result, a, point);
+	vec4_multiply_mat4(point, point, m);
+	for (int i = 0; i < VEC3_SIZE; i++) {
+		mu_assert(float_eq(point[i], result[i]), "point");
+	}
+	affine_transform_direction(result, a, direction);
+	vec4_multiply_mat4(direction, direction, m);
+	for (int i = 0; i < VEC3_SIZE; i++) {
+		mu_assert(float_eq(direction[i], result[i]), "direction");
+	}
+}
+
+static struct affine saffine_from_array(mfloat_t* a0)
+{
+	struct affine result;
+	for (int i = 0; i < AFFINE_SIZE; i++) {
+		((mfloat_t*)&result)[i] = a0[i];
+	}
+	return result;
+}
+
+static bool saffine_eq(mfloat_t* a0, struct affine a1)
+{
+	for (int i = 0; i < AFFINE_SIZE; i++) {
+		if (!float_eq(a0[i], ((mfloat_t*)&a1)[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+MU_TEST(test_saffine_matches_array_api)
+{
+	mfloat_t m0[MAT4_SIZE];
+	mfloat_t m1[MAT4_SIZE];
+	mfloat_t a0[AFFINE_SIZE];
+	mfloat_t a1[AFFINE_SIZE];
+	mfloat_t e[AFFINE_SIZE];
+	mfloat_t v[VEC3_SIZE] = {1.0f, 2.0f, 3.0f};
+	affine_mat4(m0, 0.7f, 3.0f, false);
+	affine_mat4(m1, -1.3f, 1.0f, true);
+	affine_from_mat4(a0, m0);
+	affine_from_mat4(a1, m1);
+	struct affine s0 = saffine_from_array(a0);
+	struct affine s1 = saffine_from_array(a1);
+	struct affine result;
+	struct vec3 sv = svec3(v[0], v[1], v[2]);
+	affine_identity(e);
+	mu_assert(saffine_eq(e, saffine_identity()), "identity");
+	mu_assert(saffine_eq(e, saffine_from_mat4(smat4_identity())), "from_mat4");
+	affine_multiply(e, a0, a1);
+	mu_assert(saffine_eq(e, saffine_multiply(s0, s1)), "multiply");
+	mu_assert(saffine_eq(e, *psaffine_multiply(&result, &s0, &s1)), "psaffine_multiply");
+	affine_inverse(e, a0);
+	mu_assert(saffine_eq(e, saffine_inverse(s0)), "inverse");
+	affine_inverse_rigid(e, a1);
+	mu_assert(saffine_eq(e, saffine_inverse_rigid(s1)), "inverse_rigid");
+	affine_transform_point(e, a0, v);
+	struct vec3 point = saffine_transform_point(s0, sv);
+	mu_assert(float_eq(e[0], point.x) && float_eq(e[1], point.y) && float_eq(e[2], point.z),
+			  "transform_point");
+	affine_transform_direction(e, a0, v);
+	struct vec3 direction = saffine_transform_direction(s0, sv);
+	mu_assert(float_eq(e[0], direction.x) && float_eq(e[1], direction.y) &&
+				  float_eq(e[2], direction.z),
+			  "transform_direction");
+	struct mat4 m = smat4_from_affine(s0);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(m0[i] == ((mfloat_t*)&m)[i], "mat4_from_affine");
+	}
+}
+
+MU_TEST_SUITE(test_suite)
+{
+	MU_RUN_TEST(test_affine_identity);
+	MU_RUN_TEST(test_affine_mat4_round_trip);
+	MU_RUN_TEST(test_affine_multiply);
+	MU_RUN_TEST(test_affine_inverse);
+	MU_RUN_TEST(test_affine_inverse_rigid);
+	MU_RUN_TEST(test_affine_transform);
+	MU_RUN_TEST(test_saffine_matches_array_api);
+}
+
+int main(int argc, char** argv)
+{
+	(void)argc;
+	(void)argv;
+
+	MU_RUN_SUITE(test_suite);
+	MU_REPORT();
+	return MU_EXIT_CODE;
+}
@@ -0,0 +1,336 @@
+#include <float.h>
+
+#include "mathc.h"
+#include "minunit.h"
+
+#define EPSILON 0.0001f
+#define RING_COUNT 5
+#define RING_POINTS 7
+#define VERTEX_COUNT (RING_COUNT * RING_POINTS)
+#define TWIST (0.9f * MPI)
+
+static bool float_eq(mfloat_t a, mfloat_t b)
+{
+	return MFABS(a - b) < EPSILON;
+}
+
+static bool vec3_eq(mfloat_t* a, mfloat_t* b)
+{
+	return float_eq(a[0], b[0]) && float_eq(a[1], b[1]) && float_eq(a[2], b[2]);
+}
+
+static void mat4_transform_point(mfloat_t* result, mfloat_t* v0, mfloat_t* m0)
+{
+	mfloat_t v[VEC4_SIZE] = {v0[0], v0[1], v0[2], 1.0f};
+	vec4_multiply_mat4(v, v, m0);
+	vec3_assign(result, v);
+}
+
+/* A rotation about an axis and a translation, as a mat4 and as a dual quaternion */
+static void rigid(mfloat_t* m, mfloat_t* dq, mfloat_t angle, mfloat_t shift)
+{
+	mfloat_t axis[VEC3_SIZE] = {1.0f, -2.0f, 0.5f + shift};
+	mfloat_t position[VEC3_SIZE] = {3.0f * angle, -1.0f, shift};
+	mfloat_t q[QUAT_SIZE];
+	vec3_normalize(axis, axis);
+	quat_from_axis_angle(q, axis, angle);
+	mat4_rotation_quat(m, q);
+	m[12] = position[0];
+	m[13] = position[1];
+	m[14] = position[2];
+	dualquat_from_quat_vec3(dq, q, position);
+}
+
+MU_TEST(test_dualquat_identity)
+{
+	mfloat_t dq[DUALQUAT_SIZE];
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t identity[MAT4_SIZE];
+	dualquat_identity(dq);
+	mat4_from_dualquat(m, dq);
+	mat4_identity(identity);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(float_eq(identity[i], m[i]), "identity");
+	}
+}
+
+MU_TEST(test_dualquat_conversions)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t dq[DUALQUAT_SIZE];
+	mfloat_t from_mat4[DUALQUAT_SIZE];
+	mfloat_t result[MAT4_SIZE];
+	mfloat_t q[QUAT_SIZE];
+	mfloat_t v[VEC3_SIZE];
+	rigid(m, dq, 0.7f, 2.0f);
+	mat4_from_dualquat(result, dq);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(float_eq(m[i], result[i]), "mat4 from a dual quaternion");
+	}
+	/* Small and almost half turn rotations, with the trace of the mat4 on both sides of 0 */
+	for (int j = 0; j < 2; j++) {
+		mfloat_t turn[MAT4_SIZE];
+		rigid(turn, from_mat4, j == 0 ? 0.7f : 2.9f, 2.0f);
+		dualquat_from_mat4(from_mat4, turn);
+		mat4_from_dualquat(result, from_mat4);
+		for (int i = 0; i < MAT4_SIZE; i++) {
+			mu_assert(float_eq(turn[i], result[i]), "mat4 round trip");
+		}
+	}
+	quat_from_dualquat(q, dq);
+	vec3_from_dualquat(v, dq);
+	mu_assert(q[0] == dq[0] && q[1] == dq[1] && q[2] == dq[2] && q[3] == dq[3], "rotation");
+	mu_assert(vec3_eq(v, m + 12), "translation");
+}
+
+MU_TEST(test_dualquat_multiply)
+{
+	mfloat_t m0[MAT4_SIZE];
+	mfloat_t m1[MAT4_SIZE];
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t dq0[DUALQUAT_SIZE];
+	mfloat_t dq1[DUALQUAT_SIZE];
+	mfloat_t dq[DUALQUAT_SIZE];
+	mfloat_t result[MAT4_SIZE];
+	rigid(m0, dq0, 0.7f, 2.0f);
+	rigid(m1, dq1, -1.9f, -0.5f);
+	mat4_multiply(m, m0, m1);
+	dualquat_multiply(dq, dq0, dq1);
+	mat4_from_dualquat(result, dq);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(float_eq(m[i], result[i]), "same as mat4_multiply");
+	}
+	dualquat_multiply(dq0, dq0, dq1);
+	for (int i = 0; i < DUALQUAT_SIZE; i++) {
+		mu_assert(float_eq(dq0[i], dq[i]), "result aliases an operand");
+	}
+}
+
+MU_TEST(test_dualquat_normalize)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t dq[DUALQUAT_SIZE];
+	mfloat_t scaled[DUALQUAT_SIZE];
+	mfloat_t result[MAT4_SIZE];
+	rigid(m, dq, 1.3f, 1.0f);
+	for (int i = 0; i < DUALQUAT_SIZE; i++) {
+		scaled[i] = dq[i] * 3.0f;
+	}
+	/* A dual part that isn't orthogonal to the rotation */
+	for (int i = 0; i < QUAT_SIZE; i++) {
+		scaled[4 + i] += 0.25f * scaled[i];
+	}
+	dualquat_normalize(scaled, scaled);
+	mu_assert(float_eq(quat_length(scaled), 1.0f), "unit rotation");
+	mu_assert(float_eq(scaled[0] * scaled[4] + scaled[1] * scaled[5] + scaled[2] * scaled[6]
+						   + scaled[3] * scaled[7],
+					   0.0f),
+			  "dual part orthogonal to the rotation");
+	mat4_from_dualquat(result, scaled);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(float_eq(m[i], result[i]), "same transform");
+	}
+}
+
+MU_TEST(test_dualquat_transform_point)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t dq[DUALQUAT_SIZE];
+	mfloat_t v[VEC3_SIZE] = {1.5f, -4.0f, 2.25f};
+	mfloat_t expected[VEC3_SIZE];
+	rigid(m, dq, -2.4f, 0.5f);
+	mat4_transform_point(expected, v, m);
+	dualquat_transform_point(v, dq, v);
+	mu_assert(vec3_eq(v, expected), "same as the mat4");
+}
+
+static mfloat_t shift[VEC3_SIZE] = {0.5f, -1.0f, 2.0f};
+static mfloat_t palette[SKIN_BONES * DUALQUAT_SIZE];
+static mfloat_t matrices[SKIN_BONES * MAT4_SIZE];
+static uint16_t bones[VERTEX_COUNT * SKIN_BONES];
+static mfloat_t weights[VERTEX_COUNT * SKIN_BONES];
+static mfloat_t px[VERTEX_COUNT], py[VERTEX_COUNT], pz[VERTEX_COUNT];
+static mfloat_t nx[VERTEX_COUNT], ny[VERTEX_COUNT], nz[VERTEX_COUNT];
+static mfloat_t rx[VERTEX_COUNT], ry[VERTEX_COUNT], rz[VERTEX_COUNT];
+static mfloat_t rnx[VERTEX_COUNT], rny[VERTEX_COUNT], rnz[VERTEX_COUNT];
+
+/*
+Rings of a unit cylinder along x, twisted by its far end: bone 0 moves the
+cylinder by `shift`, bone 1 also turns it by TWIST about x, and bones 2 and 3
+are the same two with the opposite sign. The weight of the twisting bones grows
+from 0 to 1 along the cylinder, and the first bone of a vertex changes from one
+vertex to the next.
+*/
+static void fill_twist(void)
+{
+	mfloat_t x_axis[VEC3_SIZE] = {1.0f, 0.0f, 0.0f};
+	mfloat_t q[QUAT_SIZE] = {0.0f, 0.0f, 0.0f, 1.0f};
+	dualquat_from_quat_vec3(palette, q, shift);
+	quat_from_axis_angle(q, x_axis, TWIST);
+	dualquat_from_quat_vec3(palette + DUALQUAT_SIZE, q, shift);
+	for (int i = 0; i < 2 * DUALQUAT_SIZE; i++) {
+		palette[2 * DUALQUAT_SIZE + i] = -palette[i];
+	}
+	for (int b = 0; b < SKIN_BONES; b++) {
+		mat4_from_dualquat(matrices + b * MAT4_SIZE, palette + b * DUALQUAT_SIZE);
+	}
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		int ring = i / RING_POINTS;
+		mfloat_t w = (mfloat_t)ring / (mfloat_t)(RING_COUNT - 1);
+		mfloat_t a = 2.0f * MPI * (mfloat_t)(i % RING_POINTS) / (mfloat_t)RING_POINTS;
+		mfloat_t bone_weights[SKIN_BONES] = {0.5f * (1.0f - w), 0.5f * w, 0.5f * (1.0f - w),
+											 0.5f * w};
+		for (int k = 0; k < SKIN_BONES; k++) {
+			int b = (i + k) % SKIN_BONES;
+			bones[i * SKIN_BONES + k] = (uint16_t)b;
+			weights[i * SKIN_BONES + k] = bone_weights[b];
+		}
+		px[i] = (mfloat_t)ring;
+		py[i] = MCOS(a);
+		pz[i] = MSIN(a);
+		nx[i] = 0.0f;
+		ny[i] = MCOS(a);
+		nz[i] = MSIN(a);
+	}
+}
+
+/* Vertex i turned about x by the angle of the normalized blend of the rotations, then moved */
+static void expected_twist(mfloat_t* p, mfloat_t* n, int i)
+{
+	mfloat_t w = (mfloat_t)(i / RING_POINTS) / (mfloat_t)(RING_COUNT - 1);
+	mfloat_t angle = 2.0f * MATAN2(w * MSIN(TWIST * 0.5f), 1.0f - w + w * MCOS(TWIST * 0.5f));
+	mfloat_t c = MCOS(angle);
+	mfloat_t s = MSIN(angle);
+	p[0] = px[i] + shift[0];
+	p[1] = c * py[i] - s * pz[i] + shift[1];
+	p[2] = s * py[i] + c * pz[i] + shift[2];
+	n[0] = nx[i];
+	n[1] = c * ny[i] - s * nz[i];
+	n[2] = s * ny[i] + c * nz[i];
+}
+
+MU_TEST(test_skin_dualquat)
+{
+	fill_twist();
+	skin_dualquat_n(rx, ry, rz, rnx, rny, rnz, px, py, pz, nx, ny, nz, bones, weights, palette,
+					VERTEX_COUNT);
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		mfloat_t p[VEC3_SIZE];
+		mfloat_t n[VEC3_SIZE];
+		mfloat_t r[VEC3_SIZE] = {rx[i], ry[i], rz[i]};
+		mfloat_t rn[VEC3_SIZE] = {rnx[i], rny[i], rnz[i]};
+		expected_twist(p, n, i);
+		mu_assert(vec3_eq(r, p), "position");
+		mu_assert(vec3_eq(rn, n), "normal");
+	}
+}
+
+MU_TEST(test_skin_dualquat_keeps_volume)
+{
+	/* Halfway along the cylinder, where the blend of matrices is nearly singular */
+	int first = (RING_COUNT / 2) * RING_POINTS;
+	fill_twist();
+	skin_dualquat_n(rx, ry, rz, NULL, NULL, NULL, px, py, pz, NULL, NULL, NULL, bones, weights,
+					palette, VERTEX_COUNT);
+	skin_mat4_n(px, py, pz, NULL, NULL, NULL, px, py, pz, NULL, NULL, NULL, bones, weights,
+				matrices, VERTEX_COUNT);
+	for (int i = first; i < first + RING_POINTS; i++) {
+		mfloat_t dy = ry[i] - shift[1];
+		mfloat_t dz = rz[i] - shift[2];
+		mfloat_t ly = py[i] - shift[1];
+		mfloat_t lz = pz[i] - shift[2];
+		mu_assert(float_eq(dy * dy + dz * dz, 1.0f), "radius kept");
+		mu_assert(ly * ly + lz * lz < 0.05f, "radius collapsed by the blend of matrices");
+	}
+}
+
+MU_TEST(test_skin_dualquat_single_bone)
+{
+	fill_twist();
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		weights[i * SKIN_BONES] = 1.0f;
+		weights[i * SKIN_BONES + 1] = 0.0f;
+		weights[i * SKIN_BONES + 2] = 0.0f;
+		weights[i * SKIN_BONES + 3] = 0.0f;
+	}
+	skin_dualquat_n(rx, ry, rz, rnx, rny, rnz, px, py, pz, nx, ny, nz, bones, weights, palette,
+					VERTEX_COUNT);
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		mfloat_t m[MAT4_SIZE];
+		mfloat_t v[VEC3_SIZE] = {px[i], py[i], pz[i]};
+		mfloat_t r[VEC3_SIZE] = {rx[i], ry[i], rz[i]};
+		mat4_from_dualquat(m, palette + bones[i * SKIN_BONES] * DUALQUAT_SIZE);
+		mat4_transform_point(v, v, m);
+		mu_assert(vec3_eq(r, v), "position of one bone");
+	}
+}
+
+MU_TEST(test_skin_dualquat_opposite_bones)
+{
+	mfloat_t expected[VEC3_SIZE];
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t x = 1.0f;
+	mfloat_t y = 2.0f;
+	mfloat_t z = -3.0f;
+	uint16_t pair[SKIN_BONES] = {0, 1, 0, 0};
+	mfloat_t halves[SKIN_BONES] = {0.5f, 0.5f, 0.0f, 0.0f};
+	/* The same transform with both signs, which cancel out unless one is flipped */
+	rigid(m, palette, 0.9f, 1.0f);
+	for (int i = 0; i < DUALQUAT_SIZE; i++) {
+		palette[DUALQUAT_SIZE + i] = -palette[i];
+	}
+	expected[0] = x;
+	expected[1] = y;
+	expected[2] = z;
+	mat4_transform_point(expected, expected, m);
+	skin_dualquat_n(&x, &y, &z, NULL, NULL, NULL, &x, &y, &z, NULL, NULL, NULL, pair, halves,
+					palette, 1);
+	mu_assert(float_eq(x, expected[0]) && float_eq(y, expected[1]) && float_eq(z, expected[2]),
+			  "antipodal bones");
+}
+
+MU_TEST(test_skin_dualquat_in_place)
+{
+	mfloat_t expected[VERTEX_COUNT * VEC3_SIZE];
+	fill_twist();
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		mfloat_t n[VEC3_SIZE];
+		expected_twist(expected + i * VEC3_SIZE, n, i);
+		rnx[i] = -1.0f;
+	}
+	/* Positions only, written over the inputs */
+	skin_dualquat_n(px, py, pz, NULL, NULL, NULL, px, py, pz, NULL, NULL, NULL, bones, weights,
+					palette, VERTEX_COUNT);
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		mfloat_t r[VEC3_SIZE] = {px[i], py[i], pz[i]};
+		mu_assert(vec3_eq(r, expected + i * VEC3_SIZE), "position in place");
+		mu_assert(rnx[i] == -1.0f, "normals untouched");
+	}
+	skin_dualquat_n(rx, ry, rz, NULL, NULL, NULL, px, py, pz, NULL, NULL, NULL, bones, weights,
+					palette, 0);
+	mu_assert(rnx[0] == -1.0f, "no vertices");
+}
+
+MU_TEST_SUITE(test_suite)
+{
+	MU_RUN_TEST(test_dualquat_identity);
+	MU_RUN_TEST(test_dualquat_conversions);
+	MU_RUN_TEST(test_dualquat_multiply);
+	MU_RUN_TEST(test_dualquat_normalize);
+	MU_RUN_TEST(test_dualquat_transform_point);
+	MU_RUN_TEST(test_skin_dualquat);
+	MU_RUN_TEST(test_skin_dualquat_keeps_volume);
+	MU_RUN_TEST(test_skin_dualquat_single_bone);
+	MU_RUN_TEST(test_skin_dualquat_opposite_bones);
+	MU_RUN_TEST(test_skin_dualquat_in_place);
+}
+
+int main(int argc, char** argv)
+{
+	(void)argc;
+	(void)argv;
+
+	MU_RUN_SUITE(test_suite);
+	MU_REPORT();
+	return MU_EXIT_CODE;
+}
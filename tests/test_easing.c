@@ -271,6 +271,217 @@ MU_TEST(test_ease_out_faster_than_linear)
 	mu_assert(quartic_ease_out(t) > t, "quartic ease_out faster than linear");
 }
 
+// Easing table tests
+#define TABLE_SIZE 256
+#define TABLE_SAMPLES 10001
+
+static mfloat_t table[TABLE_SIZE];
+
+MU_TEST(test_easing_table_smooth_error)
+{
+	mfloat_t (*const smooth[])(mfloat_t) = {sine_ease_in_out, cubic_ease_in_out,
+											  quintic_ease_out, elastic_ease_in_out,
+											  back_ease_out};
+	for (size_t e = 0; e < sizeof(smooth) / sizeof(smooth[0]); e++) {
+		mfloat_t linear = 0.0f;
+		mfloat_t cubic = 0.0f;
+		mathc_easing_table(table, TABLE_SIZE, smooth[e]);
+		for (int i = 0; i < TABLE_SAMPLES; i++) {
+			mfloat_t f = (mfloat_t)i / (mfloat_t)(TABLE_SAMPLES - 1);
+			mfloat_t exact = smooth[e](f);
+			linear = MFMAX(linear, MFABS(mathc_easing_table_linear(table, TABLE_SIZE, f) - exact));
+			cubic = MFMAX(cubic, MFABS(mathc_easing_table_cubic(table, TABLE_SIZE, f) - exact));
+		}
+		mu_assert(linear < 1.2e-3f, "linear lookup error");
+		mu_assert(cubic < 1.9e-4f, "cubic lookup error");
+	}
+	mathc_easing_table(table, TABLE_SIZE, quadratic_ease_in);
+	mu_assert(float_eq(0.09f, mathc_easing_table_cubic(table, TABLE_SIZE, 0.3f)),
+			  "the cubic lookup is exact for parabolas");
+}
+
+MU_TEST(test_easing_table_samples)
+{
+	mathc_easing_table(table, TABLE_SIZE, bounce_ease_out);
+	mu_assert(table[0] == bounce_ease_out(0.0f) && table[TABLE_SIZE - 1] == bounce_ease_out(1.0f),
+			  "endpoints sampled");
+	mu_assert(float_eq(table[5], mathc_easing_table_linear(table, TABLE_SIZE, 5.0f / 255.0f)) &&
+				  float_eq(table[5], mathc_easing_table_cubic(table, TABLE_SIZE, 5.0f / 255.0f)),
+			  "lookups interpolate the samples");
+	mu_assert(mathc_easing_table_linear(table, TABLE_SIZE, -1.0f) == table[0] &&
+				  mathc_easing_table_cubic(table, TABLE_SIZE, NAN) == table[0],
+			  "clamped below");
+	mu_assert(float_eq(table[TABLE_SIZE - 1], mathc_easing_table_linear(table, TABLE_SIZE, 2.0f)) &&
+				  float_eq(table[TABLE_SIZE - 1],
+						   mathc_easing_table_cubic(table, TABLE_SIZE, INFINITY)),
+			  "clamped above");
+	mathc_easing_table(table, 3, quadratic_ease_out);
+	mu_assert(float_eq(quadratic_ease_out(0.2f), mathc_easing_table_cubic(table, 3, 0.2f)) &&
+				  float_eq(quadratic_ease_out(0.9f), mathc_easing_table_cubic(table, 3, 0.9f)),
+			  "smallest table");
+}
+
+// Cubic bezier easing tests
+#define BEZIER_SAMPLES 1001
+#define BEZIER_ERROR 1e-5
+
+// The CSS keywords, curves with vertical or horizontal ends and one that overshoots
+static const double bezier_curves[][4] = {
+	{0.25, 0.1, 0.25, 1.0}, {0.42, 0.0, 1.0, 1.0},  {0.0, 0.0, 0.58, 1.0},
+	{0.42, 0.0, 0.58, 1.0}, {1.0, 0.0, 0.0, 1.0},   {0.0, 1.0, 1.0, 0.0},
+	{0.0, 0.0, 1.0, 1.0},   {0.68, -0.55, 0.265, 1.55},
+};
+
+static double bezier_coordinate(double p1, double p2, double t)
+{
+	double s = 1.0 - t;
+	return 3.0 * s * s * t * p1 + 3.0 * s * t * t * p2 + t * t * t;
+}
+
+// y of the curve at `x`, with the parameter found by bisection in double precision
+static double bezier_reference(const double* curve, double x)
+{
+	double low = 0.0;
+	double high = 1.0;
+	for (int i = 0; i < 60; i++) {
+		double t = 0.5 * (low + high);
+		if (bezier_coordinate(curve[0], curve[2], t) < x) {
+			low = t;
+		} else {
+			high = t;
+		}
+	}
+	return bezier_coordinate(curve[1], curve[3], 0.5 * (low + high));
+}
+
+MU_TEST(test_cubic_bezier_error)
+{
+	struct mathc_cubic_bezier bezier;
+	for (size_t c = 0; c < sizeof(bezier_curves) / sizeof(bezier_curves[0]); c++) {
+		const double* curve = bezier_curves[c];
+		double error = 0.0;
+		mathc_cubic_bezier(&bezier, (mfloat_t)curve[0], (mfloat_t)curve[1], (mfloat_t)curve[2],
+						   (mfloat_t)curve[3]);
+		for (int i = 0; i < BEZIER_SAMPLES; i++) {
+			mfloat_t f = (mfloat_t)i / (mfloat_t)(BEZIER_SAMPLES - 1);
+			double e = fabs((double)mathc_cubic_bezier_ease(&bezier, f) -
+							bezier_reference(curve, (double)f));
+			error = e > error ? e : error;
+		}
+		mu_assert(error < BEZIER_ERROR, "cubic bezier error");
+	}
+}
+
+MU_TEST(test_cubic_bezier_endpoints)
+{
+	struct mathc_cubic_bezier bezier;
+	mathc_cubic_bezier(&bezier, 0.68f, -0.55f, 0.265f, 1.55f);
+	mu_assert(mathc_cubic_bezier_ease(&bezier, 0.0f) == 0.0f, "ease(0) = 0");
+	mu_assert(mathc_cubic_bezier_ease(&bezier, 1.0f) == 1.0f, "ease(1) = 1");
+	mu_assert(mathc_cubic_bezier_ease(&bezier, -0.5f) == 0.0f, "clamped below");
+	mu_assert(mathc_cubic_bezier_ease(&bezier, 1.5f) == 1.0f, "clamped above");
+	mu_assert(mathc_cubic_bezier_ease(&bezier, 0.1f) < 0.0f, "overshoots below");
+	mathc_cubic_bezier(&bezier, 0.3f, 0.3f, 0.7f, 0.7f);
+	mu_assert(mathc_cubic_bezier_ease(&bezier, 0.37f) == 0.37f, "linear");
+	mathc_cubic_bezier(&bezier, -1.0f, 0.0f, 2.0f, 1.0f);
+	mu_assert(float_eq(0.5f, mathc_cubic_bezier_ease(&bezier, 0.5f)), "control x clamped");
+}
+
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+// Batched easing tests
+#define EASE_SAMPLES 301
+
+// The scalar functions, in the order of enum mathc_easing
+static mfloat_t (*const ease_functions[])(mfloat_t) = {
+	quadratic_ease_out,   quadratic_ease_in,   quadratic_ease_in_out,
+	cubic_ease_out,       cubic_ease_in,       cubic_ease_in_out,
+	quartic_ease_out,     quartic_ease_in,     quartic_ease_in_out,
+	quintic_ease_out,     quintic_ease_in,     quintic_ease_in_out,
+	sine_ease_out,        sine_ease_in,        sine_ease_in_out,
+	circular_ease_out,    circular_ease_in,    circular_ease_in_out,
+	exponential_ease_out, exponential_ease_in, exponential_ease_in_out,
+	elastic_ease_out,     elastic_ease_in,     elastic_ease_in_out,
+	back_ease_out,        back_ease_in,        back_ease_in_out,
+	bounce_ease_out,      bounce_ease_in,      bounce_ease_in_out,
+};
+
+MU_TEST(test_ease_n_matches_scalar)
+{
+	mfloat_t f[EASE_SAMPLES];
+	mfloat_t result[EASE_SAMPLES];
+	for (int i = 0; i < EASE_SAMPLES; i++) {
+		f[i] = (mfloat_t)i / (mfloat_t)(EASE_SAMPLES - 1);
+	}
+	mu_assert(sizeof(ease_functions) / sizeof(ease_functions[0]) ==
+				  MATHC_EASING_BOUNCE_IN_OUT + 1,
+			  "one scalar function for each easing");
+	for (int e = MATHC_EASING_QUADRATIC_OUT; e <= MATHC_EASING_BOUNCE_IN_OUT; e++) {
+		mathc_ease_n(result, f, (enum mathc_easing)e, EASE_SAMPLES);
+		for (int i = 0; i < EASE_SAMPLES; i++) {
+			mu_assert(float_eq(ease_functions[e](f[i]), result[i]), "matches scalar easing");
+		}
+	}
+}
+
+MU_TEST(test_ease_n_in_place)
+{
+	mfloat_t f[5] = {0.0f, 0.2f, 0.5f, 0.7f, 1.0f};
+	mathc_ease_n(f, f, MATHC_EASING_BOUNCE_IN_OUT, 5);
+	mu_assert(float_eq(0.0f, f[0]) && float_eq(1.0f, f[4]), "endpoints");
+	mu_assert(float_eq(bounce_ease_in_out(0.2f), f[1]), "0.2");
+	mu_assert(float_eq(bounce_ease_in_out(0.5f), f[2]), "0.5");
+	mu_assert(float_eq(bounce_ease_in_out(0.7f), f[3]), "0.7");
+	mathc_ease_n(f, f, MATHC_EASING_CUBIC_IN, 0);
+	mu_assert(float_eq(1.0f, f[4]), "empty batch");
+}
+
+MU_TEST(test_easing_table_n_matches_scalar)
+{
+	mfloat_t f[EASE_SAMPLES];
+	mfloat_t linear[EASE_SAMPLES];
+	mfloat_t cubic[EASE_SAMPLES];
+	for (int i = 0; i < EASE_SAMPLES; i++) {
+		f[i] = (mfloat_t)i / (mfloat_t)(EASE_SAMPLES - 10) - 0.01f;
+	}
+	mathc_easing_table(table, TABLE_SIZE, elastic_ease_out);
+	mathc_easing_table_linear_n(linear, f, table, TABLE_SIZE, EASE_SAMPLES);
+	mathc_easing_table_cubic_n(cubic, f, table, TABLE_SIZE, EASE_SAMPLES);
+	for (int i = 0; i < EASE_SAMPLES; i++) {
+		mu_assert(float_eq(mathc_easing_table_linear(table, TABLE_SIZE, f[i]), linear[i]),
+				  "matches scalar linear lookup");
+		mu_assert(float_eq(mathc_easing_table_cubic(table, TABLE_SIZE, f[i]), cubic[i]),
+				  "matches scalar cubic lookup");
+	}
+	mathc_easing_table_cubic_n(f, f, table, TABLE_SIZE, EASE_SAMPLES);
+	mu_assert(float_eq(cubic[100], f[100]), "in place");
+}
+
+MU_TEST(test_cubic_bezier_ease_n_error)
+{
+	struct mathc_cubic_bezier bezier;
+	mfloat_t f[BEZIER_SAMPLES];
+	mfloat_t result[BEZIER_SAMPLES];
+	for (size_t c = 0; c < sizeof(bezier_curves) / sizeof(bezier_curves[0]); c++) {
+		const double* curve = bezier_curves[c];
+		mathc_cubic_bezier(&bezier, (mfloat_t)curve[0], (mfloat_t)curve[1], (mfloat_t)curve[2],
+						   (mfloat_t)curve[3]);
+		for (int i = 0; i < BEZIER_SAMPLES; i++) {
+			f[i] = (mfloat_t)i / (mfloat_t)(BEZIER_SAMPLES - 1);
+		}
+		mathc_cubic_bezier_ease_n(result, f, &bezier, BEZIER_SAMPLES);
+		for (int i = 0; i < BEZIER_SAMPLES; i++) {
+			double e = fabs((double)result[i] - bezier_reference(curve, (double)f[i]));
+			mu_assert(e < BEZIER_ERROR, "batched cubic bezier error");
+		}
+		f[0] = -1.0f;
+		f[1] = 2.0f;
+		mathc_cubic_bezier_ease_n(f, f, &bezier, 3);
+		mu_assert(f[0] == 0.0f && float_eq(1.0f, f[1]) && float_eq(result[2], f[2]),
+				  "clamped, in place");
+	}
+}
+#endif
+
 MU_TEST_SUITE(test_suite)
 {
 	// Quadratic
@@ -332,6 +543,22 @@ MU_TEST_SUITE(test_suite)
 	MU_RUN_TEST(test_ease_functions_monotonic_increasing);
 	MU_RUN_TEST(test_ease_in_slower_than_linear);
 	MU_RUN_TEST(test_ease_out_faster_than_linear);
+
+	// Easing tables
+	MU_RUN_TEST(test_easing_table_smooth_error);
+	MU_RUN_TEST(test_easing_table_samples);
+
+	// Cubic bezier easing
+	MU_RUN_TEST(test_cubic_bezier_error);
+	MU_RUN_TEST(test_cubic_bezier_endpoints);
+
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+	// Batched
+	MU_RUN_TEST(test_ease_n_matches_scalar);
+	MU_RUN_TEST(test_ease_n_in_place);
+	MU_RUN_TEST(test_easing_table_n_matches_scalar);
+	MU_RUN_TEST(test_cubic_bezier_ease_n_error);
+#endif
 }
 
 int main(int argc, char** argv)
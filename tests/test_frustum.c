@@ -0,0 +1,183 @@
+#include <float.h>
+
+#include "mathc.h"
+#include "minunit.h"
+
+#define EPSILON 0.0001f
+#define OBJECT_COUNT 70
+#define MASK_WORDS ((OBJECT_COUNT + 31) / 32)
+
+static bool float_eq(mfloat_t a, mfloat_t b)
+{
+	return MFABS(a - b) < EPSILON;
+}
+
+static bool mask_bit(uint32_t* mask, int i)
+{
+	return (mask[i / 32] >> (i % 32)) & 1u;
+}
+
+static mfloat_t plane_distance(mfloat_t* plane, mfloat_t x, mfloat_t y, mfloat_t z)
+{
+	return plane[0] * x + plane[1] * y + plane[2] * z + plane[3];
+}
+
+/* A camera at (1, 2, 3) looking at (1, 2, -7), with a 90 degree field of view */
+static void view_projection(mfloat_t* result)
+{
+	mfloat_t position[VEC3_SIZE] = {1.0f, 2.0f, 3.0f};
+	mfloat_t target[VEC3_SIZE] = {1.0f, 2.0f, -7.0f};
+	mfloat_t up[VEC3_SIZE] = {0.0f, 1.0f, 0.0f};
+	mfloat_t view[MAT4_SIZE];
+	mfloat_t projection[MAT4_SIZE];
+	mat4_look_at(view, position, target, up);
+	mat4_perspective(projection, to_radians(90.0f), 1.0f, 0.1f, 100.0f);
+	mat4_multiply(result, projection, view);
+}
+
+MU_TEST(test_frustum_from_ortho)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t frustum[FRUSTUM_SIZE];
+	mat4_ortho(m, -2.0f, 4.0f, -1.0f, 3.0f, 0.5f, 10.0f);
+	frustum_from_mat4(frustum, m);
+	for (int i = 0; i < FRUSTUM_SIZE; i += 4) {
+		mfloat_t* plane = frustum + i;
+		mu_assert(float_eq(vec3_length(plane), 1.0f), "unit normals");
+	}
+	/* Every plane passes through its side of the box */
+	mu_assert(float_eq(plane_distance(frustum, -2.0f, 0.0f, -1.0f), 0.0f), "left");
+	mu_assert(float_eq(plane_distance(frustum + 4, 4.0f, 0.0f, -1.0f), 0.0f), "right");
+	mu_assert(float_eq(plane_distance(frustum + 8, 0.0f, -1.0f, -1.0f), 0.0f), "bottom");
+	mu_assert(float_eq(plane_distance(frustum + 12, 0.0f, 3.0f, -1.0f), 0.0f), "top");
+	mu_assert(float_eq(plane_distance(frustum + 16, 0.0f, 0.0f, -0.5f), 0.0f), "near");
+	mu_assert(float_eq(plane_distance(frustum + 20, 0.0f, 0.0f, -10.0f), 0.0f), "far");
+	for (int i = 0; i < FRUSTUM_SIZE; i += 4) {
+		mu_assert(plane_distance(frustum + i, 1.0f, 1.0f, -5.0f) > 0.0f, "normals point inside");
+	}
+}
+
+MU_TEST(test_frustum_from_perspective_infinite)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t frustum[FRUSTUM_SIZE];
+	mfloat_t x[2] = {0.0f, 0.0f};
+	mfloat_t y[2] = {0.0f, 0.0f};
+	mfloat_t z[2] = {-1.0e6f, 1.0f};
+	mfloat_t radius[2] = {1.0f, 0.5f};
+	uint32_t mask = 0xffffffffu;
+	mat4_perspective_infinite(m, to_radians(60.0f), 1.5f, 0.1f);
+	frustum_from_mat4(frustum, m);
+	mu_assert(float_eq(plane_distance(frustum + 16, 0.0f, 0.0f, -0.1f), 0.0f), "near");
+	mu_assert(frustum[20] == 0.0f && frustum[21] == 0.0f && frustum[22] == 0.0f,
+			  "no far plane");
+	frustum_cull_spheres_n(&mask, frustum, x, y, z, radius, 2);
+	mu_assert(mask == 1u, "far objects are kept, objects behind are culled");
+}
+
+/* Spheres just in front of the near plane at z = -1 and just behind it */
+static bool near_plane_culls(mfloat_t* m)
+{
+	mfloat_t frustum[FRUSTUM_SIZE];
+	mfloat_t x[2] = {0.0f, 0.0f};
+	mfloat_t y[2] = {0.0f, 0.0f};
+	mfloat_t z[2] = {-1.06f, -0.94f};
+	mfloat_t radius[2] = {0.05f, 0.05f};
+	uint32_t mask = 0xffffffffu;
+	frustum_from_mat4_zo(frustum, m);
+	frustum_cull_spheres_n(&mask, frustum, x, y, z, radius, 2);
+	return float_eq(plane_distance(frustum + 16, 0.0f, 0.0f, -1.0f), 0.0f) && mask == 1u;
+}
+
+MU_TEST(test_frustum_from_perspective)
+{
+	mfloat_t m[MAT4_SIZE];
+	mat4_perspective(m, to_radians(60.0f), 1.5f, 1.0f, 100.0f);
+	mu_assert(near_plane_culls(m), "mat4_perspective");
+	mat4_perspective_fov(m, to_radians(60.0f), 800.0f, 600.0f, 1.0f, 100.0f);
+	mu_assert(near_plane_culls(m), "mat4_perspective_fov");
+}
+
+MU_TEST(test_frustum_cull_spheres)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t frustum[FRUSTUM_SIZE];
+	/* Inside, behind, beyond the far plane, straddling the right plane, right of it */
+	mfloat_t x[5] = {1.0f, 1.0f, 1.0f, 11.5f, 14.0f};
+	mfloat_t y[5] = {2.0f, 2.0f, 2.0f, 2.0f, 2.0f};
+	mfloat_t z[5] = {-7.0f, 6.0f, -200.0f, -7.0f, -7.0f};
+	mfloat_t radius[5] = {1.0f, 1.0f, 50.0f, 1.0f, 1.0f};
+	uint32_t mask = 0xffffffffu;
+	view_projection(m);
+	frustum_from_mat4_zo(frustum, m);
+	frustum_cull_spheres_n(&mask, frustum, x, y, z, radius, 5);
+	mu_assert(mask == 0x9u, "visible spheres");
+	frustum_cull_spheres_n(&mask, frustum, x, y, z, radius, 0);
+	mu_assert(mask == 0x9u, "no spheres");
+}
+
+MU_TEST(test_frustum_cull_aabbs)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t frustum[FRUSTUM_SIZE];
+	mfloat_t x[OBJECT_COUNT];
+	mfloat_t y[OBJECT_COUNT];
+	mfloat_t z[OBJECT_COUNT];
+	mfloat_t ex[OBJECT_COUNT];
+	mfloat_t ey[OBJECT_COUNT];
+	mfloat_t ez[OBJECT_COUNT];
+	uint32_t mask[MASK_WORDS];
+	int visible = 0;
+	for (int i = 0; i < OBJECT_COUNT; i++) {
+		x[i] = (mfloat_t)((i * 7) % 23) * 2.0f - 21.0f;
+		y[i] = (mfloat_t)((i * 5) % 17) * 1.5f - 10.0f;
+		z[i] = (mfloat_t)((i * 3) % 13) * -3.0f + 5.5f;
+		ex[i] = (mfloat_t)(i % 3) + 0.25f;
+		ey[i] = (mfloat_t)(i % 5) * 0.5f + 0.25f;
+		ez[i] = (mfloat_t)(i % 4) + 0.25f;
+	}
+	view_projection(m);
+	frustum_from_mat4_zo(frustum, m);
+	frustum_cull_aabbs_n(mask, frustum, x, y, z, ex, ey, ez, OBJECT_COUNT);
+	for (int i = 0; i < OBJECT_COUNT; i++) {
+		/* A box is kept unless all its corners are outside one of the planes */
+		bool expected = true;
+		for (int p = 0; p < FRUSTUM_SIZE; p += 4) {
+			bool outside = true;
+			for (int c = 0; c < 8; c++) {
+				mfloat_t cx = x[i] + ((c & 1) ? ex[i] : -ex[i]);
+				mfloat_t cy = y[i] + ((c & 2) ? ey[i] : -ey[i]);
+				mfloat_t cz = z[i] + ((c & 4) ? ez[i] : -ez[i]);
+				if (plane_distance(frustum + p, cx, cy, cz) >= 0.0f) {
+					outside = false;
+				}
+			}
+			if (outside) {
+				expected = false;
+			}
+		}
+		mu_assert(mask_bit(mask, i) == expected, "matches the corners");
+		visible += expected;
+	}
+	mu_assert(visible > 0 && visible < OBJECT_COUNT, "some boxes visible and some culled");
+	mu_assert((mask[MASK_WORDS - 1] >> (OBJECT_COUNT % 32)) == 0u, "unused bits cleared");
+}
+
+MU_TEST_SUITE(test_suite)
+{
+	MU_RUN_TEST(test_frustum_from_ortho);
+	MU_RUN_TEST(test_frustum_from_perspective_infinite);
+	MU_RUN_TEST(test_frustum_from_perspective);
+	MU_RUN_TEST(test_frustum_cull_spheres);
+	MU_RUN_TEST(test_frustum_cull_aabbs);
+}
+
+int main(int argc, char** argv)
+{
+	(void)argc;
+	(void)argv;
+
+	MU_RUN_SUITE(test_suite);
+	MU_REPORT();
+	return MU_EXIT_CODE;
+}
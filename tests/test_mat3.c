@@ -266,6 +266,20 @@ MU_TEST(test_mat3_multiply_inverse_is_identity)
 	mu_assert(float_eq(1.0f, result[8]), "M*M^-1 = I [2,2]");
 }
 
+MU_TEST(test_mat3_rotation_quat)
+{
+	mfloat_t axis[VEC3_SIZE] = {0.6f, 0.0f, 0.8f};
+	mfloat_t q[QUAT_SIZE];
+	mfloat_t expected[MAT3_SIZE];
+	mfloat_t result[MAT3_SIZE];
+	quat_from_axis_angle(q, axis, 1.2f);
+	mat3_rotation_axis(expected, axis, 1.2f);
+	mat3_rotation_quat(result, q);
+	for (int i = 0; i < MAT3_SIZE; i++) {
+		mu_assert(float_eq(expected[i], result[i]), "matches rotation_axis");
+	}
+}
+
 MU_TEST_SUITE(test_suite)
 {
 	// Pointer-based API tests
@@ -299,6 +313,7 @@ MU_TEST_SUITE(test_suite)
 
 	// Edge case / Negative tests
 	MU_RUN_TEST(test_mat3_multiply_inverse_is_identity);
+	MU_RUN_TEST(test_mat3_rotation_quat);
 }
 
 int main(int argc, char** argv)
@@ -84,6 +84,68 @@ MU_TEST(test_mat4_multiply_identity)
 	mu_assert(float_eq(15.0f, result[14]), "M * I preserves translation Z");
 }
 
+static void reference_multiply(mfloat_t* result, mfloat_t* m0, mfloat_t* m1)
+{
+	for (int column = 0; column < 4; column++) {
+		for (int row = 0; row < 4; row++) {
+			mfloat_t sum = 0.0f;
+			for (int k = 0; k < 4; k++) {
+				sum += m0[k * 4 + row] * m1[column * 4 + k];
+			}
+			result[column * 4 + row] = sum;
+		}
+	}
+}
+
+MU_TEST(test_mat4_multiply_general)
+{
+	mfloat_t m0[MAT4_SIZE];
+	mfloat_t m1[MAT4_SIZE];
+	mfloat_t expected[MAT4_SIZE];
+	mfloat_t result[MAT4_SIZE];
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		m0[i] = (mfloat_t)(i % 5) - 1.5f;
+		m1[i] = (mfloat_t)(i % 3) * 0.5f + (mfloat_t)i;
+	}
+	reference_multiply(expected, m0, m1);
+	mat4_multiply(result, m0, m1);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(float_eq(expected[i], result[i]), "matches reference");
+	}
+}
+
+MU_TEST(test_mat4_multiply_aliasing)
+{
+	mfloat_t m0[MAT4_SIZE];
+	mfloat_t m1[MAT4_SIZE];
+	mfloat_t a[MAT4_SIZE];
+	mfloat_t expected[MAT4_SIZE];
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		m0[i] = (mfloat_t)(i % 7) - 2.0f;
+		m1[i] = 1.0f - (mfloat_t)(i % 4) * 0.25f;
+	}
+
+	reference_multiply(expected, m0, m1);
+	mat4_assign(a, m0);
+	mat4_multiply(a, a, m1);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(float_eq(expected[i], a[i]), "result aliases m0");
+	}
+
+	mat4_assign(a, m1);
+	mat4_multiply(a, m0, a);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(float_eq(expected[i], a[i]), "result aliases m1");
+	}
+
+	reference_multiply(expected, m0, m0);
+	mat4_assign(a, m0);
+	mat4_multiply(a, a, a);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(float_eq(expected[i], a[i]), "result aliases both");
+	}
+}
+
 MU_TEST(test_mat4_multiply_f)
 {
 	mfloat_t m[MAT4_SIZE];
@@ -106,6 +168,43 @@ MU_TEST(test_mat4_inverse_identity)
 	mu_assert(float_eq(1.0f, result[15]), "inverse identity m[3,3]");
 }
 
+MU_TEST(test_mat4_inverse_rigid)
+{
+	mfloat_t position[VEC3_SIZE] = {3.0f, -2.0f, 5.0f};
+	mfloat_t target[VEC3_SIZE] = {0.5f, 1.0f, -1.0f};
+	mfloat_t up[VEC3_SIZE] = {0.0f, 1.0f, 0.0f};
+	mfloat_t view[MAT4_SIZE];
+	mfloat_t expected[MAT4_SIZE];
+	mfloat_t result[MAT4_SIZE];
+	mat4_look_at(view, position, target, up);
+	mat4_inverse(expected, view);
+	mat4_inverse_rigid(result, view);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(float_eq(expected[i], result[i]), "matches mat4_inverse");
+	}
+	mat4_inverse_affine(result, view);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(float_eq(expected[i], result[i]), "affine matches mat4_inverse");
+	}
+}
+
+MU_TEST(test_mat4_inverse_affine)
+{
+	mfloat_t axis[VEC3_SIZE] = {0.0f, 0.6f, 0.8f};
+	mfloat_t scale[VEC3_SIZE] = {2.0f, 0.5f, 3.0f};
+	mfloat_t translation[VEC3_SIZE] = {1.0f, -4.0f, 2.5f};
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t expected[MAT4_SIZE];
+	mat4_rotation_axis(m, axis, 1.2f);
+	mat4_scale(m, m, scale);
+	mat4_translation(m, m, translation);
+	mat4_inverse(expected, m);
+	mat4_inverse_affine(m, m);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(float_eq(expected[i], m[i]), "matches mat4_inverse in place");
+	}
+}
+
 MU_TEST(test_mat4_translation)
 {
 	mfloat_t m[MAT4_SIZE];
@@ -217,6 +316,203 @@ MU_TEST(test_mat4_look_at)
 	mu_assert(result[0] != 0.0f || result[5] != 0.0f, "look_at defined");
 }
 
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+// Stream API tests (mat4_transform_*_n)
+#define VERTEX_COUNT 7
+#define VERTEX_STRIDE 8
+
+static void fill_vertices(mfloat_t* vertices)
+{
+	for (int i = 0; i < VERTEX_COUNT * VERTEX_STRIDE; i++) {
+		vertices[i] = (mfloat_t)((i * 7) % 11) - 5.0f;
+	}
+}
+
+static void affine_matrix(mfloat_t* m)
+{
+	mfloat_t axis[VEC3_SIZE] = {1.0f, 2.0f, -1.0f};
+	mfloat_t scale[VEC3_SIZE] = {2.0f, 0.5f, 3.0f};
+	mfloat_t s[MAT4_SIZE];
+	vec3_normalize(axis, axis);
+	mat4_rotation_axis(m, axis, 0.7f);
+	mat4_identity(s);
+	mat4_scaling(s, s, scale);
+	mat4_multiply(m, m, s);
+	m[12] = 10.0f;
+	m[13] = -20.0f;
+	m[14] = 30.0f;
+}
+
+MU_TEST(test_mat4_transform_points_n_affine)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t vertices[VERTEX_COUNT * VERTEX_STRIDE];
+	mfloat_t result[VERTEX_COUNT * VERTEX_STRIDE];
+	affine_matrix(m);
+	fill_vertices(vertices);
+	for (int i = 0; i < VERTEX_COUNT * VERTEX_STRIDE; i++) {
+		result[i] = 99.0f;
+	}
+	mat4_transform_points_n(result, VERTEX_STRIDE, vertices, VERTEX_STRIDE, m, VERTEX_COUNT);
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		mfloat_t* v = vertices + i * VERTEX_STRIDE;
+		mfloat_t* r = result + i * VERTEX_STRIDE;
+		mfloat_t p[VEC4_SIZE] = {v[0], v[1], v[2], 1.0f};
+		vec4_multiply_mat4(p, p, m);
+		mu_assert(float_eq(p[0], r[0]) && float_eq(p[1], r[1]) && float_eq(p[2], r[2]),
+				  "point transformed");
+		mu_assert(float_eq(99.0f, r[3]) && float_eq(99.0f, r[VERTEX_STRIDE - 1]),
+				  "interleaved attributes untouched");
+	}
+}
+
+MU_TEST(test_mat4_transform_points_n_projective)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t points[VERTEX_COUNT * VEC3_SIZE];
+	mfloat_t result[VERTEX_COUNT * VEC3_SIZE];
+	mat4_perspective(m, 1.0f, 1.5f, 0.1f, 100.0f);
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		points[i * VEC3_SIZE] = (mfloat_t)i - 3.0f;
+		points[i * VEC3_SIZE + 1] = 0.5f * (mfloat_t)i;
+		points[i * VEC3_SIZE + 2] = -2.0f - (mfloat_t)i;
+	}
+	mat4_transform_points_n(result, 0, points, 0, m, VERTEX_COUNT);
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		mfloat_t* v = points + i * VEC3_SIZE;
+		mfloat_t* r = result + i * VEC3_SIZE;
+		mfloat_t p[VEC4_SIZE] = {v[0], v[1], v[2], 1.0f};
+		vec4_multiply_mat4(p, p, m);
+		mu_assert(float_eq(p[0] / p[3], r[0]) && float_eq(p[1] / p[3], r[1])
+					  && float_eq(p[2] / p[3], r[2]),
+				  "point divided by w");
+	}
+}
+
+MU_TEST(test_mat4_transform_directions_n_in_place)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t vertices[VERTEX_COUNT * VERTEX_STRIDE];
+	mfloat_t expected[VERTEX_COUNT * VERTEX_STRIDE];
+	affine_matrix(m);
+	fill_vertices(vertices);
+	fill_vertices(expected);
+	mat4_transform_directions_n(vertices + 3, VERTEX_STRIDE, vertices + 3, VERTEX_STRIDE, m,
+								VERTEX_COUNT);
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		mfloat_t* v = expected + i * VERTEX_STRIDE;
+		mfloat_t* r = vertices + i * VERTEX_STRIDE;
+		mfloat_t d[VEC4_SIZE] = {v[3], v[4], v[5], 0.0f};
+		vec4_multiply_mat4(d, d, m);
+		mu_assert(float_eq(d[0], r[3]) && float_eq(d[1], r[4]) && float_eq(d[2], r[5]),
+				  "direction ignores translation");
+		mu_assert(float_eq(v[0], r[0]) && float_eq(v[6], r[6]), "other attributes untouched");
+	}
+}
+
+#define ROTATION_COUNT 150
+
+MU_TEST(test_mat4_rotation_axis_n)
+{
+	mfloat_t axes[ROTATION_COUNT * VEC3_SIZE];
+	mfloat_t angles[ROTATION_COUNT];
+	mfloat_t result[ROTATION_COUNT * MAT4_SIZE];
+	for (int i = 0; i < ROTATION_COUNT; i++) {
+		mfloat_t axis[VEC3_SIZE] = {(mfloat_t)(i % 5) - 2.0f, 1.0f, (mfloat_t)(i % 3)};
+		vec3_normalize(axes + i * VEC3_SIZE, axis);
+		/* Covers every quadrant and several turns in both directions */
+		angles[i] = ((mfloat_t)i - 75.0f) * 0.37f;
+	}
+	mat4_rotation_axis_n(result, axes, angles, ROTATION_COUNT);
+	for (int i = 0; i < ROTATION_COUNT; i++) {
+		mfloat_t expected[MAT4_SIZE];
+		mat4_rotation_axis(expected, axes + i * VEC3_SIZE, angles[i]);
+		for (int j = 0; j < MAT4_SIZE; j++) {
+			mu_assert(float_eq(expected[j], result[i * MAT4_SIZE + j]),
+					  "matches mat4_rotation_axis");
+		}
+	}
+}
+
+// Each instance holds a mat4 followed by four other values
+#define INSTANCE_COUNT 9
+#define INSTANCE_STRIDE 20
+
+static void fill_instances(mfloat_t* instances)
+{
+	mfloat_t axis[VEC3_SIZE] = {0.0f, 0.6f, 0.8f};
+	for (int i = 0; i < INSTANCE_COUNT; i++) {
+		mfloat_t* m = instances + i * INSTANCE_STRIDE;
+		mat4_rotation_axis(m, axis, 0.3f * (mfloat_t)i);
+		m[12] = (mfloat_t)i;
+		m[13] = -2.0f * (mfloat_t)i;
+		for (int j = MAT4_SIZE; j < INSTANCE_STRIDE; j++) {
+			m[j] = 99.0f;
+		}
+	}
+}
+
+static bool mat4_eq(mfloat_t* m0, mfloat_t* m1)
+{
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		if (!float_eq(m0[i], m1[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+MU_TEST(test_mat4_multiply_n_strided)
+{
+	mfloat_t instances[INSTANCE_COUNT * INSTANCE_STRIDE];
+	mfloat_t packed[INSTANCE_COUNT * MAT4_SIZE];
+	mfloat_t result[INSTANCE_COUNT * INSTANCE_STRIDE];
+	fill_instances(instances);
+	fill_instances(result);
+	for (int i = 0; i < INSTANCE_COUNT; i++) {
+		affine_matrix(packed + i * MAT4_SIZE);
+		packed[i * MAT4_SIZE + 3] = 0.01f * (mfloat_t)i;
+	}
+	mat4_multiply_n(result, INSTANCE_STRIDE, instances, INSTANCE_STRIDE, packed, 0,
+					INSTANCE_COUNT);
+	for (int i = 0; i < INSTANCE_COUNT; i++) {
+		mfloat_t expected[MAT4_SIZE];
+		mfloat_t* r = result + i * INSTANCE_STRIDE;
+		mat4_multiply(expected, instances + i * INSTANCE_STRIDE, packed + i * MAT4_SIZE);
+		mu_assert(mat4_eq(expected, r), "matches mat4_multiply");
+		mu_assert(float_eq(99.0f, r[MAT4_SIZE]) && float_eq(99.0f, r[INSTANCE_STRIDE - 1]),
+				  "other values untouched");
+	}
+}
+
+MU_TEST(test_mat4_multiply_broadcast_n)
+{
+	mfloat_t view_projection[MAT4_SIZE];
+	mfloat_t parent[MAT4_SIZE];
+	mfloat_t instances[INSTANCE_COUNT * INSTANCE_STRIDE];
+	mfloat_t original[INSTANCE_COUNT * INSTANCE_STRIDE];
+	mfloat_t mvp[INSTANCE_COUNT * MAT4_SIZE];
+	mat4_perspective(view_projection, 1.0f, 1.5f, 0.1f, 100.0f);
+	affine_matrix(parent);
+	fill_instances(instances);
+	fill_instances(original);
+	mat4_multiply_broadcast_left_n(mvp, 0, view_projection, instances, INSTANCE_STRIDE,
+								   INSTANCE_COUNT);
+	mat4_multiply_broadcast_right_n(instances, INSTANCE_STRIDE, instances, INSTANCE_STRIDE, parent,
+									INSTANCE_COUNT);
+	for (int i = 0; i < INSTANCE_COUNT; i++) {
+		mfloat_t expected[MAT4_SIZE];
+		mfloat_t* m = original + i * INSTANCE_STRIDE;
+		mat4_multiply(expected, view_projection, m);
+		mu_assert(mat4_eq(expected, mvp + i * MAT4_SIZE), "broadcast on the left");
+		mat4_multiply(expected, m, parent);
+		mu_assert(mat4_eq(expected, instances + i * INSTANCE_STRIDE), "broadcast on the right");
+		mu_assert(float_eq(99.0f, instances[i * INSTANCE_STRIDE + MAT4_SIZE]),
+				  "other values untouched");
+	}
+}
+#endif
+
 // Struct-based API tests (smat4_*)
 MU_TEST(test_smat4_zero)
 {
@@ -286,6 +582,18 @@ MU_TEST(test_smat4_inverse)
 	mu_assert(float_eq(1.0f, result.m22), "inverse identity m[1,1]");
 }
 
+MU_TEST(test_smat4_inverse_rigid)
+{
+	struct mat4 m = smat4_rotation_z(0.5f);
+	m.m14 = 2.0f;
+	m.m24 = -3.0f;
+	struct mat4 result = smat4_multiply(m, smat4_inverse_rigid(m));
+	mu_assert(float_eq(1.0f, result.m11) && float_eq(1.0f, result.m22), "identity");
+	mu_assert(float_eq(0.0f, result.m14) && float_eq(0.0f, result.m24), "no translation");
+	result = smat4_multiply(m, smat4_inverse_affine(m));
+	mu_assert(float_eq(1.0f, result.m11) && float_eq(0.0f, result.m24), "affine identity");
+}
+
 MU_TEST(test_smat4_translation)
 {
 	struct mat4 m = smat4_identity();
@@ -392,8 +700,12 @@ MU_TEST_SUITE(test_suite)
 	MU_RUN_TEST(test_mat4_negative);
 	MU_RUN_TEST(test_mat4_transpose);
 	MU_RUN_TEST(test_mat4_multiply_identity);
+	MU_RUN_TEST(test_mat4_multiply_general);
+	MU_RUN_TEST(test_mat4_multiply_aliasing);
 	MU_RUN_TEST(test_mat4_multiply_f);
 	MU_RUN_TEST(test_mat4_inverse_identity);
+	MU_RUN_TEST(test_mat4_inverse_rigid);
+	MU_RUN_TEST(test_mat4_inverse_affine);
 	MU_RUN_TEST(test_mat4_translation);
 	MU_RUN_TEST(test_mat4_rotation_x);
 	MU_RUN_TEST(test_mat4_rotation_y);
@@ -404,6 +716,16 @@ MU_TEST_SUITE(test_suite)
 	MU_RUN_TEST(test_mat4_perspective);
 	MU_RUN_TEST(test_mat4_look_at);
 
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+	// Stream API tests
+	MU_RUN_TEST(test_mat4_transform_points_n_affine);
+	MU_RUN_TEST(test_mat4_transform_points_n_projective);
+	MU_RUN_TEST(test_mat4_transform_directions_n_in_place);
+	MU_RUN_TEST(test_mat4_rotation_axis_n);
+	MU_RUN_TEST(test_mat4_multiply_n_strided);
+	MU_RUN_TEST(test_mat4_multiply_broadcast_n);
+#endif
+
 	// Struct-based API tests
 	MU_RUN_TEST(test_smat4_zero);
 	MU_RUN_TEST(test_smat4_identity);
@@ -413,6 +735,7 @@ MU_TEST_SUITE(test_suite)
 	MU_RUN_TEST(test_smat4_multiply);
 	MU_RUN_TEST(test_smat4_multiply_f);
 	MU_RUN_TEST(test_smat4_inverse);
+	MU_RUN_TEST(test_smat4_inverse_rigid);
 	MU_RUN_TEST(test_smat4_translation);
 	MU_RUN_TEST(test_smat4_rotation_x);
 	MU_RUN_TEST(test_smat4_rotation_y);
@@ -0,0 +1,153 @@
+#include <float.h>
+#include <stdio.h>
+
+#include "mathc.h"
+#include "minunit.h"
+
+#define SAMPLE_COUNT 100000
+/* Bound on the relative error of the fast functions, 2^-21 */
+#define FAST_ERROR 4.76837158e-7
+
+struct normalize_error {
+	/* Largest error of a component, relative to the length of the exact result */
+	double component;
+	/* Largest difference between the length of the result and 1 */
+	double length;
+};
+
+static unsigned int random_state = 12345u;
+
+/* Deterministic pseudo-random value in [-1, 1), scaled by a power of ten in [1e-3, 1e3] */
+static mfloat_t random_component(void)
+{
+	random_state = random_state * 1664525u + 1013904223u;
+	double value = (double)(random_state >> 8) / 8388608.0 - 1.0;
+	double scale = pow(10.0, (double)((random_state >> 4) % 7) - 3.0);
+	return (mfloat_t)(value * scale);
+}
+
+static void measure(struct normalize_error* error, const mfloat_t* v, const mfloat_t* r, int size)
+{
+	double length_squared = 0.0;
+	double result_squared = 0.0;
+	for (int i = 0; i < size; i++) {
+		length_squared += (double)v[i] * (double)v[i];
+		result_squared += (double)r[i] * (double)r[i];
+	}
+	double length = sqrt(length_squared);
+	for (int i = 0; i < size; i++) {
+		double e = fabs((double)v[i] / length - (double)r[i]);
+		error->component = e > error->component ? e : error->component;
+	}
+	double e = fabs(sqrt(result_squared) - 1.0);
+	error->length = e > error->length ? e : error->length;
+}
+
+/* Measures the exact and the fast function over the same vectors */
+static void measure_function(struct normalize_error* exact, struct normalize_error* fast,
+							 mfloat_t* (*normalize)(mfloat_t*, mfloat_t*),
+							 mfloat_t* (*normalize_fast)(mfloat_t*, mfloat_t*), int size)
+{
+	exact->component = exact->length = 0.0;
+	fast->component = fast->length = 0.0;
+	for (int n = 0; n < SAMPLE_COUNT; n++) {
+		mfloat_t v[VEC4_SIZE];
+		mfloat_t r[VEC4_SIZE];
+		for (int i = 0; i < size; i++) {
+			v[i] = random_component();
+		}
+		normalize(r, v);
+		measure(exact, v, r, size);
+		normalize_fast(r, v);
+		measure(fast, v, r, size);
+	}
+}
+
+static void print_row(const char* name, struct normalize_error* exact,
+					  struct normalize_error* fast)
+{
+	printf("%-6s %14.3e %14.3e %14.3e %14.3e\n", name, exact->component, fast->component,
+		   exact->length, fast->length);
+}
+
+MU_TEST(test_normalize_fast_error_table)
+{
+	struct normalize_error exact[4];
+	struct normalize_error fast[4];
+	measure_function(&exact[0], &fast[0], vec2_normalize, vec2_normalize_fast, VEC2_SIZE);
+	measure_function(&exact[1], &fast[1], vec3_normalize, vec3_normalize_fast, VEC3_SIZE);
+	measure_function(&exact[2], &fast[2], vec4_normalize, vec4_normalize_fast, VEC4_SIZE);
+	measure_function(&exact[3], &fast[3], quat_normalize, quat_normalize_fast, QUAT_SIZE);
+	printf("\n%-6s %14s %14s %14s %14s\n", "", "component", "fast component", "length",
+		   "fast length");
+	print_row("vec2", &exact[0], &fast[0]);
+	print_row("vec3", &exact[1], &fast[1]);
+	print_row("vec4", &exact[2], &fast[2]);
+	print_row("quat", &exact[3], &fast[3]);
+	for (int i = 0; i < 4; i++) {
+		mu_assert(fast[i].component < FAST_ERROR, "fast component error");
+		mu_assert(fast[i].length < FAST_ERROR, "fast length error");
+	}
+}
+
+MU_TEST(test_normalize_fast_axes)
+{
+	mfloat_t v[VEC3_SIZE] = {0.0f, -8.0f, 0.0f};
+	mfloat_t r[VEC3_SIZE];
+	vec3_normalize_fast(r, v);
+	mu_assert(r[0] == 0.0f && r[2] == 0.0f, "zero components stay zero");
+	mu_assert(fabs((double)r[1] + 1.0) < FAST_ERROR, "unit axis");
+}
+
+#if defined(MATHC_USE_FAST_NORMALIZE)
+MU_TEST(test_normalize_uses_fast)
+{
+	mfloat_t v[VEC4_SIZE] = {0.3f, -1.7f, 2.9f, 0.1f};
+	mfloat_t r[VEC4_SIZE];
+	mfloat_t e[VEC4_SIZE];
+	vec3_normalize(r, v);
+	vec3_normalize_fast(e, v);
+	mu_assert(r[0] == e[0] && r[1] == e[1] && r[2] == e[2], "vec3");
+	quat_normalize(r, v);
+	quat_normalize_fast(e, v);
+	mu_assert(r[0] == e[0] && r[1] == e[1] && r[2] == e[2] && r[3] == e[3], "quat");
+}
+#endif
+
+#if defined(MATHC_USE_STRUCT_FUNCTIONS)
+MU_TEST(test_snormalize_fast)
+{
+	struct vec3 v = svec3(3.0f, -4.0f, 12.0f);
+	struct vec3 r = svec3_normalize_fast(v);
+	mfloat_t e[VEC3_SIZE];
+	vec3_normalize_fast(e, (mfloat_t*)&v);
+	mu_assert(r.x == e[0] && r.y == e[1] && r.z == e[2], "vec3 matches array API");
+	struct quat q = squat(1.0f, 2.0f, -2.0f, 4.0f);
+	struct quat rq = squat_normalize_fast(q);
+	mfloat_t eq[QUAT_SIZE];
+	quat_normalize_fast(eq, (mfloat_t*)&q);
+	mu_assert(rq.x == eq[0] && rq.y == eq[1] && rq.z == eq[2] && rq.w == eq[3],
+			  "quat matches array API");
+}
+#endif
+
+MU_TEST_SUITE(test_suite)
+{
+	MU_RUN_TEST(test_normalize_fast_error_table);
+	MU_RUN_TEST(test_normalize_fast_axes);
+#if defined(MATHC_USE_FAST_NORMALIZE)
+	MU_RUN_TEST(test_normalize_uses_fast);
+#endif
+#if defined(MATHC_USE_STRUCT_FUNCTIONS)
+	MU_RUN_TEST(test_snormalize_fast);
+#endif
+}
+
+int main(int argc, char** argv)
+{
+	(void)argc;
+	(void)argv;
+	MU_RUN_SUITE(test_suite);
+	MU_REPORT();
+	return MU_EXIT_CODE;
+}
@@ -0,0 +1,273 @@
+#include <float.h>
+#include <string.h>
+
+#include "mathc_parallel.h"
+#include "minunit.h"
+
+#define ITEM_COUNT 10007
+#define GRAIN 1000
+
+static unsigned char visits[ITEM_COUNT];
+static size_t chunk_begins[ITEM_COUNT / GRAIN + 1];
+
+static void visit_task(void* context, size_t begin, size_t end)
+{
+	(void)context;
+	chunk_begins[begin / GRAIN] = begin;
+	for (size_t i = begin; i < end; i++) {
+		visits[i]++;
+	}
+}
+
+static bool visited_once(void)
+{
+	for (size_t i = 0; i < ITEM_COUNT; i++) {
+		if (visits[i] != 1) {
+			return false;
+		}
+	}
+	for (size_t c = 0; c < ITEM_COUNT / GRAIN + 1; c++) {
+		if (chunk_begins[c] != c * GRAIN) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void run_visits(void)
+{
+	memset(visits, 0, sizeof(visits));
+	memset(chunk_begins, 0xFF, sizeof(chunk_begins));
+	mathc_parallel_for(ITEM_COUNT, GRAIN, visit_task, NULL);
+}
+
+/* Runs the chunks backwards on the calling thread, like a job system could */
+static size_t scheduler_calls;
+
+static void reverse_scheduler(void* scheduler_context, mathc_parallel_job job, void* job_context,
+							  size_t chunk_count)
+{
+	size_t* calls = scheduler_context;
+	(*calls)++;
+	for (size_t i = chunk_count; i > 0; i--) {
+		job(job_context, i - 1);
+	}
+}
+
+MU_TEST(test_parallel_for_serial)
+{
+	mathc_parallel_shutdown();
+	mu_assert(mathc_parallel_thread_count() == 1, "no pool");
+	run_visits();
+	mu_assert(visited_once(), "every item visited once in fixed chunks");
+}
+
+MU_TEST(test_parallel_for_pool)
+{
+	mu_assert(mathc_parallel_init(4), "pool started");
+	mu_assert(mathc_parallel_thread_count() == 4, "thread count");
+	for (int i = 0; i < 20; i++) {
+		run_visits();
+		mu_assert(visited_once(), "every item visited once in fixed chunks");
+	}
+	mathc_parallel_shutdown();
+	mu_assert(mathc_parallel_thread_count() == 1, "pool stopped");
+	mu_assert(mathc_parallel_init(0), "pool started with one thread per processor");
+	mu_assert(mathc_parallel_thread_count() >= 1, "thread count");
+	run_visits();
+	mu_assert(visited_once(), "every item visited once in fixed chunks");
+	mathc_parallel_shutdown();
+}
+
+MU_TEST(test_parallel_for_scheduler)
+{
+	scheduler_calls = 0;
+	mathc_parallel_set_scheduler(reverse_scheduler, &scheduler_calls);
+	run_visits();
+	mu_assert(visited_once(), "every item visited once in fixed chunks");
+	mu_assert(scheduler_calls == 1, "custom scheduler used");
+	mathc_parallel_for(GRAIN, GRAIN, visit_task, NULL);
+	mu_assert(scheduler_calls == 1, "a single chunk runs on the calling thread");
+	mathc_parallel_set_scheduler(NULL, NULL);
+	run_visits();
+	mu_assert(scheduler_calls == 1, "built-in scheduler restored");
+}
+
+MU_TEST(test_parallel_for_empty)
+{
+	memset(visits, 0, sizeof(visits));
+	mathc_parallel_for(0, GRAIN, visit_task, NULL);
+	mathc_parallel_for(1, 0, visit_task, NULL);
+	mu_assert(visits[0] == 1 && visits[1] == 0, "default grain");
+}
+
+#if defined(MATHC_USE_FLOATING_POINT) && defined(MATHC_USE_STREAM_FUNCTIONS)
+static mfloat_t points[ITEM_COUNT * VEC3_SIZE];
+static mfloat_t expected[ITEM_COUNT * VEC3_SIZE];
+static mfloat_t result[ITEM_COUNT * VEC3_SIZE];
+
+MU_TEST(test_parallel_bit_identical)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t axis[VEC3_SIZE] = {0.0f, 0.6f, 0.8f};
+	mat4_rotation_axis(m, axis, 1.1f);
+	m[3] = 0.001f;
+	m[12] = 5.0f;
+	for (int i = 0; i < ITEM_COUNT * VEC3_SIZE; i++) {
+		points[i] = (mfloat_t)((i * 37) % 101) * 0.1f - 5.0f;
+	}
+	mathc_parallel_mat4_transform_points_n(expected, 0, points, 0, m, ITEM_COUNT);
+	for (size_t threads = 2; threads <= 5; threads++) {
+		mu_assert(mathc_parallel_init(threads), "pool started");
+		memset(result, 0, sizeof(result));
+		mathc_parallel_mat4_transform_points_n(result, 0, points, 0, m, ITEM_COUNT);
+		mu_assert(memcmp(expected, result, sizeof(result)) == 0, "points bit-identical");
+		mathc_parallel_vec3_multiply_mat3_n(result, result + ITEM_COUNT, result + 2 * ITEM_COUNT,
+											points, points + ITEM_COUNT, points + 2 * ITEM_COUNT,
+											m, ITEM_COUNT);
+		vec3_multiply_mat3_n(expected, expected + ITEM_COUNT, expected + 2 * ITEM_COUNT, points,
+							 points + ITEM_COUNT, points + 2 * ITEM_COUNT, m, ITEM_COUNT);
+		mu_assert(memcmp(expected, result, sizeof(result)) == 0, "streams bit-identical");
+		mathc_parallel_mat4_transform_points_n(expected, 0, points, 0, m, ITEM_COUNT);
+	}
+	mathc_parallel_shutdown();
+}
+
+#define MATRIX_COUNT 5003
+
+static mfloat_t models[MATRIX_COUNT * MAT4_SIZE];
+static mfloat_t expected_mvp[MATRIX_COUNT * MAT4_SIZE];
+static mfloat_t mvp[MATRIX_COUNT * MAT4_SIZE];
+
+MU_TEST(test_parallel_mat4_multiply_n)
+{
+	mfloat_t view_projection[MAT4_SIZE];
+	mat4_perspective(view_projection, 1.0f, 1.5f, 0.1f, 100.0f);
+	for (int i = 0; i < MATRIX_COUNT * MAT4_SIZE; i++) {
+		models[i] = (mfloat_t)((i * 37) % 101) * 0.01f - 0.5f;
+	}
+	mat4_multiply_broadcast_left_n(expected_mvp, 0, view_projection, models, 0, MATRIX_COUNT);
+	mu_assert(mathc_parallel_init(3), "pool started");
+	mathc_parallel_mat4_multiply_broadcast_left_n(mvp, 0, view_projection, models, 0,
+												  MATRIX_COUNT);
+	mu_assert(memcmp(expected_mvp, mvp, sizeof(mvp)) == 0, "broadcast on the left");
+	mat4_multiply_broadcast_right_n(expected_mvp, 0, models, 0, view_projection, MATRIX_COUNT);
+	mathc_parallel_mat4_multiply_broadcast_right_n(mvp, 0, models, 0, view_projection,
+												   MATRIX_COUNT);
+	mu_assert(memcmp(expected_mvp, mvp, sizeof(mvp)) == 0, "broadcast on the right");
+	mat4_multiply_n(expected_mvp, 0, models, 0, expected_mvp, 0, MATRIX_COUNT);
+	mathc_parallel_mat4_multiply_n(mvp, 0, models, 0, mvp, 0, MATRIX_COUNT);
+	mu_assert(memcmp(expected_mvp, mvp, sizeof(mvp)) == 0, "arrays in place");
+	mathc_parallel_shutdown();
+}
+
+#define MASK_WORDS ((ITEM_COUNT + 31) / 32)
+
+static uint32_t expected_mask[MASK_WORDS];
+static uint32_t mask[MASK_WORDS];
+
+MU_TEST(test_parallel_frustum_cull)
+{
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t frustum[FRUSTUM_SIZE];
+	mfloat_t* x = points;
+	mfloat_t* y = points + ITEM_COUNT;
+	mfloat_t* z = points + 2 * ITEM_COUNT;
+	mat4_ortho(m, -3.0f, 2.0f, -1.0f, 4.0f, -2.0f, 3.0f);
+	frustum_from_mat4(frustum, m);
+	for (int i = 0; i < ITEM_COUNT * VEC3_SIZE; i++) {
+		points[i] = (mfloat_t)((i * 37) % 101) * 0.1f - 5.0f;
+	}
+	mu_assert(mathc_parallel_init(3), "pool started");
+	frustum_cull_spheres_n(expected_mask, frustum, x, y, z, z, ITEM_COUNT);
+	mathc_parallel_frustum_cull_spheres_n(mask, frustum, x, y, z, z, ITEM_COUNT);
+	mu_assert(memcmp(expected_mask, mask, sizeof(mask)) == 0, "spheres");
+	frustum_cull_aabbs_n(expected_mask, frustum, x, y, z, y, z, x, ITEM_COUNT);
+	mathc_parallel_frustum_cull_aabbs_n(mask, frustum, x, y, z, y, z, x, ITEM_COUNT);
+	mu_assert(memcmp(expected_mask, mask, sizeof(mask)) == 0, "boxes");
+	mathc_parallel_shutdown();
+}
+
+#define BONE_COUNT 8
+
+static uint16_t bones[ITEM_COUNT * SKIN_BONES];
+static mfloat_t weights[ITEM_COUNT * SKIN_BONES];
+static mfloat_t normals[ITEM_COUNT * VEC3_SIZE];
+
+/* Skins the points with the first models as bones, normals and positions in place */
+MU_TEST(test_parallel_skin)
+{
+	mfloat_t palette[BONE_COUNT * AFFINE_SIZE];
+	mfloat_t* x = points;
+	mfloat_t* y = points + ITEM_COUNT;
+	mfloat_t* z = points + 2 * ITEM_COUNT;
+	for (int i = 0; i < BONE_COUNT * MAT4_SIZE; i++) {
+		models[i] = (mfloat_t)((i * 37) % 101) * 0.01f - 0.5f;
+	}
+	for (int b = 0; b < BONE_COUNT; b++) {
+		affine_from_mat4(palette + b * AFFINE_SIZE, models + b * MAT4_SIZE);
+	}
+	for (int i = 0; i < ITEM_COUNT * SKIN_BONES; i++) {
+		bones[i] = (uint16_t)((i * 7) % BONE_COUNT);
+		weights[i] = 0.25f;
+	}
+	for (int i = 0; i < ITEM_COUNT * VEC3_SIZE; i++) {
+		points[i] = (mfloat_t)((i * 37) % 101) * 0.1f - 5.0f;
+		normals[i] = (mfloat_t)((i * 13) % 7) * 0.25f - 0.75f;
+	}
+	mu_assert(mathc_parallel_init(3), "pool started");
+	skin_mat4_n(expected, expected + ITEM_COUNT, expected + 2 * ITEM_COUNT, result,
+				result + ITEM_COUNT, result + 2 * ITEM_COUNT, x, y, z, normals,
+				normals + ITEM_COUNT, normals + 2 * ITEM_COUNT, bones, weights, models,
+				ITEM_COUNT);
+	mathc_parallel_skin_mat4_n(x, y, z, normals, normals + ITEM_COUNT, normals + 2 * ITEM_COUNT,
+							   x, y, z, normals, normals + ITEM_COUNT, normals + 2 * ITEM_COUNT,
+							   bones, weights, models, ITEM_COUNT);
+	mu_assert(memcmp(expected, points, sizeof(points)) == 0, "positions in place");
+	mu_assert(memcmp(result, normals, sizeof(normals)) == 0, "normals in place");
+	skin_affine_n(expected, expected + ITEM_COUNT, expected + 2 * ITEM_COUNT, NULL, NULL, NULL, x,
+				  y, z, NULL, NULL, NULL, bones, weights, palette, ITEM_COUNT);
+	mathc_parallel_skin_affine_n(x, y, z, NULL, NULL, NULL, x, y, z, NULL, NULL, NULL, bones,
+								 weights, palette, ITEM_COUNT);
+	mu_assert(memcmp(expected, points, sizeof(points)) == 0, "affine positions only");
+	for (int b = 0; b < BONE_COUNT; b++) {
+		mfloat_t* dq = palette + b * DUALQUAT_SIZE;
+		quat_normalize(dq, models + b * MAT4_SIZE);
+		dualquat_from_quat_vec3(dq, dq, models + b * MAT4_SIZE + 4);
+	}
+	skin_dualquat_n(expected, expected + ITEM_COUNT, expected + 2 * ITEM_COUNT, result,
+					result + ITEM_COUNT, result + 2 * ITEM_COUNT, x, y, z, normals,
+					normals + ITEM_COUNT, normals + 2 * ITEM_COUNT, bones, weights, palette,
+					ITEM_COUNT);
+	mathc_parallel_skin_dualquat_n(x, y, z, normals, normals + ITEM_COUNT,
+								   normals + 2 * ITEM_COUNT, x, y, z, normals,
+								   normals + ITEM_COUNT, normals + 2 * ITEM_COUNT, bones, weights,
+								   palette, ITEM_COUNT);
+	mu_assert(memcmp(expected, points, sizeof(points)) == 0, "dual quaternion positions");
+	mu_assert(memcmp(result, normals, sizeof(normals)) == 0, "dual quaternion normals");
+	mathc_parallel_shutdown();
+}
+#endif
+
+MU_TEST_SUITE(test_suite)
+{
+	MU_RUN_TEST(test_parallel_for_serial);
+	MU_RUN_TEST(test_parallel_for_pool);
+	MU_RUN_TEST(test_parallel_for_scheduler);
+	MU_RUN_TEST(test_parallel_for_empty);
+#if defined(MATHC_USE_FLOATING_POINT) && defined(MATHC_USE_STREAM_FUNCTIONS)
+	MU_RUN_TEST(test_parallel_bit_identical);
+	MU_RUN_TEST(test_parallel_mat4_multiply_n);
+	MU_RUN_TEST(test_parallel_frustum_cull);
+	MU_RUN_TEST(test_parallel_skin);
+#endif
+}
+
+int main(int argc, char** argv)
+{
+	(void)argc;
+	(void)argv;
+	MU_RUN_SUITE(test_suite);
+	MU_REPORT();
+	return MU_EXIT_CODE;
+}
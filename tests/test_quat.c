@@ -1,4 +1,5 @@
 #include <float.h>
+#include <stdio.h>
 
 #include "mathc.h"
 #include "minunit.h"
@@ -108,6 +109,235 @@ MU_TEST(test_quat_from_axis_angle_90)
 	mu_assert(float_eq(cos45, result[3]), "w");
 }
 
+MU_TEST(test_quat_rotate_vec3_90)
+{
+	mfloat_t axis[VEC3_SIZE] = {0.0f, 0.0f, 1.0f};
+	mfloat_t v[VEC3_SIZE] = {1.0f, 0.0f, 0.0f};
+	mfloat_t q[QUAT_SIZE];
+	quat_from_axis_angle(q, axis, MPI_2);
+	quat_rotate_vec3(v, q, v);
+	mu_assert(float_eq(0.0f, v[0]), "x");
+	mu_assert(float_eq(1.0f, v[1]), "y");
+	mu_assert(float_eq(0.0f, v[2]), "z");
+}
+
+MU_TEST(test_quat_rotate_vec3_matches_mat3)
+{
+	for (int i = 0; i < 50; i++) {
+		mfloat_t axis[VEC3_SIZE] = {(mfloat_t)(i % 3) - 1.0f, 1.0f, (mfloat_t)(i % 5) * 0.5f};
+		mfloat_t v[VEC3_SIZE] = {(mfloat_t)i * 0.1f, -2.0f, (mfloat_t)(i % 4) + 0.5f};
+		mfloat_t q[QUAT_SIZE];
+		mfloat_t m[MAT3_SIZE];
+		mfloat_t expected[VEC3_SIZE];
+		mfloat_t result[VEC3_SIZE];
+		vec3_normalize(axis, axis);
+		quat_from_axis_angle(q, axis, ((mfloat_t)i - 25.0f) * 0.3f);
+		mat3_rotation_quat(m, q);
+		vec3_multiply_mat3(expected, v, m);
+		quat_rotate_vec3(result, q, v);
+		for (int j = 0; j < VEC3_SIZE; j++) {
+			mu_assert(float_eq(expected[j], result[j]), "matches mat3_rotation_quat");
+		}
+		struct quat sq = squat(q[0], q[1], q[2], q[3]);
+		struct vec3 sv = squat_rotate_vec3(sq, svec3(v[0], v[1], v[2]));
+		struct vec3 pv = svec3(v[0], v[1], v[2]);
+		mu_assert(float_eq(result[0], sv.x) && float_eq(result[1], sv.y) &&
+					  float_eq(result[2], sv.z),
+				  "struct");
+		psquat_rotate_vec3(&pv, &sq, &pv);
+		mu_assert(pv.x == sv.x && pv.y == sv.y && pv.z == sv.z, "struct pointer in place");
+	}
+}
+
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+MU_TEST(test_quat_rotate_vec3_n)
+{
+	mfloat_t axis[VEC3_SIZE] = {1.0f, 2.0f, -2.0f};
+	mfloat_t x[100];
+	mfloat_t y[100];
+	mfloat_t z[100];
+	mfloat_t q[QUAT_SIZE];
+	mfloat_t result[VEC3_SIZE * 100];
+	vec3_normalize(axis, axis);
+	quat_from_axis_angle(q, axis, 2.0f);
+	for (int i = 0; i < 100; i++) {
+		x[i] = (mfloat_t)i * 0.1f;
+		y[i] = (mfloat_t)(i % 7) - 3.0f;
+		z[i] = 1.0f;
+		quat_rotate_vec3(result + i * VEC3_SIZE, q, (mfloat_t[VEC3_SIZE]){x[i], y[i], z[i]});
+	}
+	quat_rotate_vec3_n(x, y, z, q, x, y, z, 100);
+	for (int i = 0; i < 100; i++) {
+		mu_assert(float_eq(result[i * VEC3_SIZE], x[i]) &&
+					  float_eq(result[i * VEC3_SIZE + 1], y[i]) &&
+					  float_eq(result[i * VEC3_SIZE + 2], z[i]),
+				  "matches quat_rotate_vec3");
+	}
+}
+
+MU_TEST(test_quat_from_axis_angle_n)
+{
+	mfloat_t axes[100 * VEC3_SIZE];
+	mfloat_t angles[100];
+	mfloat_t result[100 * QUAT_SIZE];
+	for (int i = 0; i < 100; i++) {
+		mfloat_t axis[VEC3_SIZE] = {1.0f, (mfloat_t)(i % 4) - 1.5f, (mfloat_t)(i % 7) * 0.5f};
+		vec3_normalize(axes + i * VEC3_SIZE, axis);
+		angles[i] = ((mfloat_t)i - 50.0f) * 0.9f;
+	}
+	quat_from_axis_angle_n(result, axes, angles, 100);
+	for (int i = 0; i < 100; i++) {
+		mfloat_t expected[QUAT_SIZE];
+		quat_from_axis_angle(expected, axes + i * VEC3_SIZE, angles[i]);
+		for (int j = 0; j < QUAT_SIZE; j++) {
+			mu_assert(float_eq(expected[j], result[i * QUAT_SIZE + j]),
+					  "matches quat_from_axis_angle");
+		}
+	}
+}
+#endif
+
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+#define BLEND_COUNT 1024
+#define BLEND_STEPS 11
+
+typedef void (*quat_blend_function)(mfloat_t*, mfloat_t*, mfloat_t*, mfloat_t*, mfloat_t*,
+									mfloat_t*, mfloat_t*, mfloat_t*, mfloat_t*, mfloat_t*,
+									mfloat_t*, mfloat_t*, mfloat_t, size_t);
+
+struct blend_error {
+	/* Largest rotation angle between the result and the exact slerp, in radians */
+	double angle;
+	/* Largest difference between the length of the result and 1 */
+	double length;
+};
+
+static mfloat_t blend_q0[QUAT_SIZE][BLEND_COUNT];
+static mfloat_t blend_q1[QUAT_SIZE][BLEND_COUNT];
+static mfloat_t blend_r[QUAT_SIZE][BLEND_COUNT];
+static unsigned int blend_state = 777u;
+
+static double blend_random(void)
+{
+	blend_state = blend_state * 1664525u + 1013904223u;
+	return (double)(blend_state >> 8) / 16777216.0;
+}
+
+/* Pairs of unit quaternions from 0 to 180 degrees apart, half of them in opposite hemispheres */
+static void blend_setup(void)
+{
+	for (int i = 0; i < BLEND_COUNT; i++) {
+		double half = 0.5 * MPI * (double)i / (double)(BLEND_COUNT - 1);
+		double a[QUAT_SIZE];
+		double b[QUAT_SIZE];
+		double length = 0.0;
+		for (int j = 0; j < QUAT_SIZE; j++) {
+			a[j] = blend_random() * 2.0 - 1.0;
+			length += a[j] * a[j];
+		}
+		for (int j = 0; j < QUAT_SIZE; j++) {
+			a[j] /= sqrt(length);
+		}
+		/* A unit direction orthogonal to a */
+		double dot = 0.0;
+		length = 0.0;
+		for (int j = 0; j < QUAT_SIZE; j++) {
+			b[j] = blend_random() * 2.0 - 1.0;
+			dot += a[j] * b[j];
+		}
+		for (int j = 0; j < QUAT_SIZE; j++) {
+			b[j] -= dot * a[j];
+			length += b[j] * b[j];
+		}
+		for (int j = 0; j < QUAT_SIZE; j++) {
+			double sign = i % 2 ? -1.0 : 1.0;
+			blend_q0[j][i] = (mfloat_t)a[j];
+			double q = cos(half) * a[j] + sin(half) * b[j] / sqrt(length);
+			blend_q1[j][i] = (mfloat_t)(sign * q);
+		}
+	}
+}
+
+static void blend_measure(struct blend_error* error, quat_blend_function blend)
+{
+	error->angle = 0.0;
+	error->length = 0.0;
+	for (int s = 0; s < BLEND_STEPS; s++) {
+		mfloat_t f = (mfloat_t)s / (mfloat_t)(BLEND_STEPS - 1);
+		blend(blend_r[0], blend_r[1], blend_r[2], blend_r[3], blend_q0[0], blend_q0[1],
+			  blend_q0[2], blend_q0[3], blend_q1[0], blend_q1[1], blend_q1[2], blend_q1[3], f,
+			  BLEND_COUNT);
+		for (int i = 0; i < BLEND_COUNT; i++) {
+			double d = 0.0;
+			double r = 0.0;
+			double dot = 0.0;
+			double e = 0.0;
+			for (int j = 0; j < QUAT_SIZE; j++) {
+				d += (double)blend_q0[j][i] * (double)blend_q1[j][i];
+			}
+			double sign = d < 0.0 ? -1.0 : 1.0;
+			double theta = acos(fmin(d * sign, 1.0));
+			double s0 = theta > 1e-9 ? sin((1.0 - f) * theta) / sin(theta) : 1.0 - f;
+			double s1 = theta > 1e-9 ? sin(f * theta) / sin(theta) : f;
+			for (int j = 0; j < QUAT_SIZE; j++) {
+				double exact = s0 * blend_q0[j][i] + sign * s1 * blend_q1[j][i];
+				r += (double)blend_r[j][i] * (double)blend_r[j][i];
+				dot += (double)blend_r[j][i] * exact;
+				e += exact * exact;
+			}
+			double c = fabs(dot) / sqrt(r * e);
+			double angle = 2.0 * atan2(sqrt(fmax(1.0 - c * c, 0.0)), c);
+			error->angle = angle > error->angle ? angle : error->angle;
+			e = fabs(sqrt(r) - 1.0);
+			error->length = e > error->length ? e : error->length;
+		}
+	}
+}
+
+MU_TEST(test_quat_blend_n_error_table)
+{
+	struct blend_error slerp;
+	struct blend_error nlerp;
+	struct blend_error fast;
+	blend_setup();
+	blend_measure(&slerp, quat_slerp_n);
+	blend_measure(&nlerp, quat_nlerp_n);
+	blend_measure(&fast, quat_slerp_fast_n);
+	printf("\n%-18s %14s %14s\n", "", "angle", "length");
+	printf("%-18s %14.3e %14.3e\n", "quat_slerp_n", slerp.angle, slerp.length);
+	printf("%-18s %14.3e %14.3e\n", "quat_nlerp_n", nlerp.angle, nlerp.length);
+	printf("%-18s %14.3e %14.3e\n", "quat_slerp_fast_n", fast.angle, fast.length);
+	mu_assert(slerp.angle < 1e-5, "slerp angle error");
+	mu_assert(nlerp.angle < 0.15, "nlerp angle error");
+	mu_assert(fast.angle < 1e-3, "fast slerp angle error");
+	mu_assert(nlerp.length < 1e-5 && fast.length < 1e-5, "normalized");
+}
+
+MU_TEST(test_quat_slerp_n_matches_scalar)
+{
+	blend_setup();
+	quat_slerp_n(blend_r[0], blend_r[1], blend_r[2], blend_r[3], blend_q0[0], blend_q0[1],
+				 blend_q0[2], blend_q0[3], blend_q1[0], blend_q1[1], blend_q1[2], blend_q1[3],
+				 0.3f, BLEND_COUNT);
+	for (int i = 0; i < BLEND_COUNT; i++) {
+		mfloat_t a[QUAT_SIZE] = {blend_q0[0][i], blend_q0[1][i], blend_q0[2][i], blend_q0[3][i]};
+		mfloat_t b[QUAT_SIZE] = {blend_q1[0][i], blend_q1[1][i], blend_q1[2][i], blend_q1[3][i]};
+		mfloat_t expected[QUAT_SIZE];
+		quat_slerp(expected, a, b, 0.3f);
+		for (int j = 0; j < QUAT_SIZE; j++) {
+			mu_assert(float_eq(expected[j], blend_r[j][i]), "matches quat_slerp");
+		}
+	}
+	/* In place, over q1 */
+	quat_nlerp_n(blend_q1[0], blend_q1[1], blend_q1[2], blend_q1[3], blend_q0[0], blend_q0[1],
+				 blend_q0[2], blend_q0[3], blend_q1[0], blend_q1[1], blend_q1[2], blend_q1[3],
+				 0.0f, BLEND_COUNT);
+	for (int j = 0; j < QUAT_SIZE; j++) {
+		mu_assert(float_eq(blend_q0[j][7], blend_q1[j][7]), "nlerp at 0 is q0");
+	}
+}
+#endif
+
 MU_TEST(test_quat_lerp)
 {
 	mfloat_t q0[QUAT_SIZE] = {0.0f, 0.0f, 0.0f, 1.0f};
@@ -179,6 +409,56 @@ MU_TEST(test_squat_normalize)
 	mu_assert(float_eq(1.0f, result.w), "w");
 }
 
+MU_TEST(test_quat_divide)
+{
+	mfloat_t axis[VEC3_SIZE] = {0.0f, 0.0f, 1.0f};
+	mfloat_t q0[QUAT_SIZE];
+	mfloat_t q1[QUAT_SIZE];
+	mfloat_t result[QUAT_SIZE];
+	quat_from_axis_angle(q0, axis, MPI_2);
+	quat_from_axis_angle(q1, axis, MPI_4);
+	quat_divide(result, q0, q1);
+	mu_assert(float_eq(0.0f, result[0]), "x");
+	mu_assert(float_eq(0.0f, result[1]), "y");
+	mu_assert(float_eq(MSIN(MPI / 8.0f), result[2]), "z");
+	mu_assert(float_eq(MCOS(MPI / 8.0f), result[3]), "w");
+}
+
+MU_TEST(test_squat_matches_array_api)
+{
+	mfloat_t a[QUAT_SIZE] = {0.5f, -0.25f, 0.75f, 0.5f};
+	mfloat_t b[QUAT_SIZE] = {-0.1f, 0.6f, 0.2f, 0.8f};
+	mfloat_t e[QUAT_SIZE];
+	struct quat q0 = squat(a[0], a[1], a[2], a[3]);
+	struct quat q1 = squat(b[0], b[1], b[2], b[3]);
+#define ASSERT_SQUAT(q, message)                                                                   \
+	mu_assert(float_eq(e[0], (q).x) && float_eq(e[1], (q).y) && float_eq(e[2], (q).z) &&           \
+				  float_eq(e[3], (q).w),                                                           \
+			  message)
+	quat_multiply(e, a, b);
+	ASSERT_SQUAT(squat_multiply(q0, q1), "multiply");
+	quat_multiply_f(e, a, 3.0f);
+	ASSERT_SQUAT(squat_multiply_f(q0, 3.0f), "multiply_f");
+	quat_divide(e, a, b);
+	ASSERT_SQUAT(squat_divide(q0, q1), "divide");
+	quat_divide_f(e, a, 2.0f);
+	ASSERT_SQUAT(squat_divide_f(q0, 2.0f), "divide_f");
+	quat_negative(e, a);
+	ASSERT_SQUAT(squat_negative(q0), "negative");
+	quat_conjugate(e, a);
+	ASSERT_SQUAT(squat_conjugate(q0), "conjugate");
+	quat_inverse(e, a);
+	ASSERT_SQUAT(squat_inverse(q0), "inverse");
+	quat_normalize(e, a);
+	ASSERT_SQUAT(squat_normalize(q0), "normalize");
+	quat_lerp(e, a, b, 0.3f);
+	ASSERT_SQUAT(squat_lerp(q0, q1, 0.3f), "lerp");
+#undef ASSERT_SQUAT
+	mu_assert(float_eq(quat_dot(a, b), squat_dot(q0, q1)), "dot");
+	mu_assert(float_eq(quat_length(a), squat_length(q0)), "length");
+	mu_assert(float_eq(quat_length_squared(a), squat_length_squared(q0)), "length_squared");
+}
+
 MU_TEST_SUITE(test_suite)
 {
 	MU_RUN_TEST(test_quat_create);
@@ -191,6 +471,14 @@ MU_TEST_SUITE(test_suite)
 	MU_RUN_TEST(test_quat_length);
 	MU_RUN_TEST(test_quat_from_axis_angle);
 	MU_RUN_TEST(test_quat_from_axis_angle_90);
+	MU_RUN_TEST(test_quat_rotate_vec3_90);
+	MU_RUN_TEST(test_quat_rotate_vec3_matches_mat3);
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+	MU_RUN_TEST(test_quat_rotate_vec3_n);
+	MU_RUN_TEST(test_quat_from_axis_angle_n);
+	MU_RUN_TEST(test_quat_blend_n_error_table);
+	MU_RUN_TEST(test_quat_slerp_n_matches_scalar);
+#endif
 	MU_RUN_TEST(test_quat_lerp);
 	MU_RUN_TEST(test_quat_inverse_multiply);
 
@@ -199,6 +487,8 @@ MU_TEST_SUITE(test_suite)
 	MU_RUN_TEST(test_squat_multiply_identity);
 	MU_RUN_TEST(test_squat_conjugate);
 	MU_RUN_TEST(test_squat_normalize);
+	MU_RUN_TEST(test_quat_divide);
+	MU_RUN_TEST(test_squat_matches_array_api);
 }
 
 int main(int argc, char** argv)
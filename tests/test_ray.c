@@ -0,0 +1,239 @@
+#include <float.h>
+
+#include "mathc.h"
+#include "minunit.h"
+
+#define EPSILON 0.0001f
+#define OBJECT_COUNT 150
+
+static bool float_eq(mfloat_t a, mfloat_t b)
+{
+	return MFABS(a - b) < EPSILON;
+}
+
+static mfloat_t vx0[OBJECT_COUNT], vy0[OBJECT_COUNT], vz0[OBJECT_COUNT];
+static mfloat_t vx1[OBJECT_COUNT], vy1[OBJECT_COUNT], vz1[OBJECT_COUNT];
+static mfloat_t vx2[OBJECT_COUNT], vy2[OBJECT_COUNT], vz2[OBJECT_COUNT];
+static mfloat_t ex[OBJECT_COUNT], ey[OBJECT_COUNT], ez[OBJECT_COUNT];
+
+/* Triangles, and boxes centered on their first vertex, in 20 units around the origin */
+static void fill_objects(void)
+{
+	for (int i = 0; i < OBJECT_COUNT; i++) {
+		vx0[i] = (mfloat_t)((i * 7) % 23) - 11.0f;
+		vy0[i] = (mfloat_t)((i * 5) % 17) * 1.25f - 10.0f;
+		vz0[i] = (mfloat_t)((i * 3) % 19) - 9.0f;
+		vx1[i] = vx0[i] + (mfloat_t)(i % 3) + 0.5f;
+		vy1[i] = vy0[i] + (mfloat_t)(i % 5) * 0.5f - 1.0f;
+		vz1[i] = vz0[i] + 0.75f;
+		vx2[i] = vx0[i] - 0.5f;
+		vy2[i] = vy0[i] + (mfloat_t)(i % 4) + 0.5f;
+		vz2[i] = vz0[i] - (mfloat_t)(i % 2);
+		ex[i] = (mfloat_t)(i % 3) * 0.5f + 0.25f;
+		ey[i] = (mfloat_t)(i % 5) * 0.25f + 0.5f;
+		ez[i] = (mfloat_t)(i % 4) * 0.5f + 0.25f;
+	}
+}
+
+/* The slab method with the vec3 functions, returns INFINITY for a miss */
+static mfloat_t reference_aabb(mfloat_t* origin, mfloat_t* direction, int i)
+{
+	mfloat_t center[VEC3_SIZE] = {vx0[i], vy0[i], vz0[i]};
+	mfloat_t extent[VEC3_SIZE] = {ex[i], ey[i], ez[i]};
+	mfloat_t low[VEC3_SIZE];
+	mfloat_t high[VEC3_SIZE];
+	mfloat_t enter = 0.0f;
+	mfloat_t leave = INFINITY;
+	vec3_subtract(low, center, extent);
+	vec3_subtract(low, low, origin);
+	vec3_add(high, center, extent);
+	vec3_subtract(high, high, origin);
+	for (int axis = 0; axis < 3; axis++) {
+		if (direction[axis] == 0.0f) {
+			if (low[axis] > 0.0f || high[axis] < 0.0f) {
+				return INFINITY;
+			}
+			continue;
+		}
+		mfloat_t t0 = low[axis] / direction[axis];
+		mfloat_t t1 = high[axis] / direction[axis];
+		enter = MFMAX(enter, MFMIN(t0, t1));
+		leave = MFMIN(leave, MFMAX(t0, t1));
+	}
+	return enter <= leave ? enter : INFINITY;
+}
+
+/* Moller-Trumbore with the vec3 functions, returns INFINITY for a miss */
+static mfloat_t reference_triangle(mfloat_t* origin, mfloat_t* direction, int i)
+{
+	mfloat_t v0[VEC3_SIZE] = {vx0[i], vy0[i], vz0[i]};
+	mfloat_t v1[VEC3_SIZE] = {vx1[i], vy1[i], vz1[i]};
+	mfloat_t v2[VEC3_SIZE] = {vx2[i], vy2[i], vz2[i]};
+	mfloat_t e1[VEC3_SIZE];
+	mfloat_t e2[VEC3_SIZE];
+	mfloat_t p[VEC3_SIZE];
+	mfloat_t s[VEC3_SIZE];
+	mfloat_t q[VEC3_SIZE];
+	vec3_subtract(e1, v1, v0);
+	vec3_subtract(e2, v2, v0);
+	vec3_cross(p, direction, e2);
+	mfloat_t det = vec3_dot(e1, p);
+	if (det == 0.0f) {
+		return INFINITY;
+	}
+	vec3_subtract(s, origin, v0);
+	mfloat_t u = vec3_dot(s, p) / det;
+	vec3_cross(q, s, e1);
+	mfloat_t v = vec3_dot(direction, q) / det;
+	mfloat_t t = vec3_dot(e2, q) / det;
+	if (u < 0.0f || v < 0.0f || u + v > 1.0f || t < 0.0f) {
+		return INFINITY;
+	}
+	return t;
+}
+
+static int reference_nearest(mfloat_t* distance, mfloat_t* origin, mfloat_t* direction,
+							 bool triangles)
+{
+	int nearest = -1;
+	*distance = INFINITY;
+	for (int i = 0; i < OBJECT_COUNT; i++) {
+		mfloat_t t = triangles ? reference_triangle(origin, direction, i)
+							   : reference_aabb(origin, direction, i);
+		if (t < *distance) {
+			*distance = t;
+			nearest = i;
+		}
+	}
+	return nearest;
+}
+
+MU_TEST(test_ray_intersect_aabbs)
+{
+	int hits = 0;
+	fill_objects();
+	for (int r = 0; r < 40; r++) {
+		mfloat_t origin[VEC3_SIZE] = {(mfloat_t)(r % 7) - 3.0f, (mfloat_t)(r % 5) * 2.0f - 4.0f,
+									  -20.0f + (mfloat_t)(r % 3) * 15.0f};
+		mfloat_t direction[VEC3_SIZE] = {(mfloat_t)(r % 4) * 0.25f - 0.4f,
+										 (mfloat_t)(r % 6) * 0.125f - 0.3f, 1.0f - (r % 2) * 2.0f};
+		mfloat_t expected_distance;
+		int expected = reference_nearest(&expected_distance, origin, direction, false);
+		mfloat_t distance = -1.0f;
+		size_t index = OBJECT_COUNT;
+		bool hit = ray_intersect_aabbs_n(&distance, &index, origin, direction, INFINITY, vx0, vy0,
+										 vz0, ex, ey, ez, OBJECT_COUNT);
+		mu_assert(hit == (expected >= 0), "hit");
+		if (hit) {
+			mu_assert(float_eq(distance, expected_distance), "nearest distance");
+			mu_assert(float_eq(reference_aabb(origin, direction, (int)index), distance),
+					  "index of the nearest box");
+			hits++;
+		} else {
+			mu_assert(distance == -1.0f && index == OBJECT_COUNT, "unchanged on a miss");
+		}
+	}
+	mu_assert(hits > 10, "most rays hit");
+}
+
+MU_TEST(test_ray_intersect_aabbs_edges)
+{
+	mfloat_t cx[2] = {0.0f, 0.0f};
+	mfloat_t cy[2] = {0.0f, 0.0f};
+	mfloat_t cz[2] = {-5.0f, 5.0f};
+	mfloat_t e[2] = {1.0f, 1.0f};
+	mfloat_t origin[VEC3_SIZE] = {0.5f, 0.0f, 0.0f};
+	mfloat_t direction[VEC3_SIZE] = {0.0f, 0.0f, -2.0f};
+	mfloat_t distance;
+	size_t index;
+	/* Parallel to the x and y slabs, inside them */
+	mu_assert(ray_intersect_aabbs_n(&distance, &index, origin, direction, INFINITY, cx, cy, cz, e,
+									e, e, 2),
+			  "hit");
+	mu_assert(index == 0 && float_eq(distance, 2.0f), "in units of the direction");
+	mu_assert(!ray_intersect_aabbs_n(&distance, &index, origin, direction, 1.5f, cx, cy, cz, e, e,
+									 e, 2),
+			  "beyond the maximum distance");
+	origin[2] = 5.5f;
+	mu_assert(ray_intersect_aabbs_n(&distance, &index, origin, direction, INFINITY, cx, cy, cz, e,
+									e, e, 2),
+			  "inside");
+	mu_assert(index == 1 && distance == 0.0f, "inside at distance 0");
+	origin[0] = 1.5f;
+	mu_assert(!ray_intersect_aabbs_n(&distance, &index, origin, direction, INFINITY, cx, cy, cz, e,
+									 e, e, 2),
+			  "parallel outside a slab");
+}
+
+MU_TEST(test_ray_intersect_triangles)
+{
+	int hits = 0;
+	fill_objects();
+	for (int r = 0; r < 40; r++) {
+		mfloat_t origin[VEC3_SIZE] = {(mfloat_t)(r % 7) - 3.0f, (mfloat_t)(r % 5) * 2.0f - 4.0f,
+									  -20.0f + (mfloat_t)(r % 3) * 15.0f};
+		mfloat_t direction[VEC3_SIZE] = {(mfloat_t)(r % 4) * 0.05f - 0.1f,
+										 (mfloat_t)(r % 6) * 0.03f - 0.07f, 1.0f - (r % 2) * 2.0f};
+		mfloat_t expected_distance;
+		int expected = reference_nearest(&expected_distance, origin, direction, true);
+		mfloat_t distance;
+		size_t index;
+		bool hit = ray_intersect_triangles_n(&distance, &index, origin, direction, INFINITY, vx0,
+											 vy0, vz0, vx1, vy1, vz1, vx2, vy2, vz2, OBJECT_COUNT);
+		mu_assert(hit == (expected >= 0), "hit");
+		if (hit) {
+			mu_assert(float_eq(distance, expected_distance), "nearest distance");
+			mu_assert(float_eq(reference_triangle(origin, direction, (int)index), distance),
+					  "index of the nearest triangle");
+			hits++;
+		}
+	}
+	mu_assert(hits > 5, "some rays hit");
+}
+
+MU_TEST(test_ray_intersect_triangles_edges)
+{
+	/* A triangle seen from both sides and a degenerate one in front of it */
+	mfloat_t tx0[2] = {-1.0f, 0.0f}, ty0[2] = {-1.0f, 0.0f}, tz0[2] = {0.0f, 1.0f};
+	mfloat_t tx1[2] = {2.0f, 1.0f}, ty1[2] = {-1.0f, 1.0f}, tz1[2] = {0.0f, 1.0f};
+	mfloat_t tx2[2] = {-1.0f, 2.0f}, ty2[2] = {2.0f, 2.0f}, tz2[2] = {0.0f, 1.0f};
+	mfloat_t origin[VEC3_SIZE] = {0.0f, 0.0f, 3.0f};
+	mfloat_t direction[VEC3_SIZE] = {0.0f, 0.0f, -1.0f};
+	mfloat_t distance;
+	size_t index;
+	mu_assert(ray_intersect_triangles_n(&distance, &index, origin, direction, INFINITY, tx0, ty0,
+										tz0, tx1, ty1, tz1, tx2, ty2, tz2, 2),
+			  "front");
+	mu_assert(index == 0 && float_eq(distance, 3.0f), "degenerate triangle skipped");
+	origin[2] = -3.0f;
+	direction[2] = 1.0f;
+	mu_assert(ray_intersect_triangles_n(&distance, &index, origin, direction, INFINITY, tx0, ty0,
+										tz0, tx1, ty1, tz1, tx2, ty2, tz2, 2),
+			  "back");
+	mu_assert(index == 0 && float_eq(distance, 3.0f), "back distance");
+	direction[2] = -1.0f;
+	mu_assert(!ray_intersect_triangles_n(&distance, &index, origin, direction, INFINITY, tx0, ty0,
+										 tz0, tx1, ty1, tz1, tx2, ty2, tz2, 2),
+			  "behind the origin");
+	mu_assert(!ray_intersect_triangles_n(&distance, &index, origin, direction, INFINITY, tx0, ty0,
+										 tz0, tx1, ty1, tz1, tx2, ty2, tz2, 0),
+			  "no triangles");
+}
+
+MU_TEST_SUITE(test_suite)
+{
+	MU_RUN_TEST(test_ray_intersect_aabbs);
+	MU_RUN_TEST(test_ray_intersect_aabbs_edges);
+	MU_RUN_TEST(test_ray_intersect_triangles);
+	MU_RUN_TEST(test_ray_intersect_triangles_edges);
+}
+
+int main(int argc, char** argv)
+{
+	(void)argc;
+	(void)argv;
+
+	MU_RUN_SUITE(test_suite);
+	MU_REPORT();
+	return MU_EXIT_CODE;
+}
@@ -0,0 +1,474 @@
+#include <float.h>
+#if defined(MATHC_USE_DISPATCH) && !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+#include "mathc.h"
+#include "minunit.h"
+
+#define EPSILON 0.0001f
+#define STREAM_COUNT 131
+#define MATRIX_COUNT 7
+
+static bool float_eq(mfloat_t a, mfloat_t b)
+{
+	return MFABS(a - b) < EPSILON;
+}
+
+static bool array_eq(const mfloat_t* a, const mfloat_t* b, int n)
+{
+	for (int i = 0; i < n; i++) {
+		if (!float_eq(a[i], b[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void reference_multiply(mfloat_t* result, const mfloat_t* m0, const mfloat_t* m1)
+{
+	for (int c = 0; c < 4; c++) {
+		for (int r = 0; r < 4; r++) {
+			mfloat_t sum = 0.0f;
+			for (int k = 0; k < 4; k++) {
+				sum += m0[k * 4 + r] * m1[c * 4 + k];
+			}
+			result[c * 4 + r] = sum;
+		}
+	}
+}
+
+/* Multiplies v in place by the column-major matrix m */
+static void vec4_multiply_mat4_reference(mfloat_t* v, const mfloat_t* m)
+{
+	mfloat_t r[VEC4_SIZE];
+	for (int i = 0; i < 4; i++) {
+		r[i] = m[i] * v[0] + m[4 + i] * v[1] + m[8 + i] * v[2] + m[12 + i] * v[3];
+	}
+	for (int i = 0; i < 4; i++) {
+		v[i] = r[i];
+	}
+}
+
+static void fill_stream(mfloat_t* x, mfloat_t* y, mfloat_t* z, int seed)
+{
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		x[i] = (mfloat_t)((i * 7 + seed) % 23) - 11.0f;
+		y[i] = (mfloat_t)((i * 5 + seed * 3) % 17) * 0.5f - 4.0f;
+		z[i] = (mfloat_t)((i * 3 + seed * 5) % 13) * 0.25f + 0.5f;
+	}
+}
+
+/* Runs the SIMD functions with the current selection and checks them */
+static bool check_current_tier(void)
+{
+	mfloat_t m0[MAT4_SIZE] = {2.0f, 0.5f, -1.0f, 0.0f, 1.0f, 3.0f, 0.25f, 0.0f, -0.5f, 1.5f, 4.0f,
+							  0.0f, 3.0f, -2.0f, 1.0f, 1.0f};
+	mfloat_t m1[MAT4_SIZE];
+	mfloat_t result[MAT4_SIZE];
+	mfloat_t expected[MAT4_SIZE];
+	mfloat_t identity[MAT4_SIZE];
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		m1[i] = (mfloat_t)(i + 1) * 0.5f - 3.0f;
+	}
+	reference_multiply(expected, m0, m1);
+	mat4_multiply(result, m0, m1);
+	if (!array_eq(expected, result, MAT4_SIZE)) {
+		return false;
+	}
+	mat4_inverse(result, m0);
+	mat4_multiply(result, m0, result);
+	mat4_identity(identity);
+	if (!array_eq(identity, result, MAT4_SIZE)) {
+		return false;
+	}
+	mfloat_t v0[VEC4_SIZE] = {1.0f, -2.0f, 0.5f, 3.0f};
+	mfloat_t v1[VEC4_SIZE];
+	mfloat_t v2[VEC4_SIZE];
+	vec4_multiply_mat4(v1, v0, m1);
+	for (int r = 0; r < 4; r++) {
+		v2[r] = m1[r] * v0[0] + m1[4 + r] * v0[1] + m1[8 + r] * v0[2] + m1[12 + r] * v0[3];
+	}
+	if (!array_eq(v1, v2, VEC4_SIZE)) {
+		return false;
+	}
+	/* Rotation of 90 degrees around z, and its negative to force the sign flip */
+	mfloat_t q0[QUAT_SIZE] = {0.0f, 0.0f, 0.0f, 1.0f};
+	mfloat_t q1[QUAT_SIZE] = {0.0f, 0.0f, -0.70710678f, -0.70710678f};
+	mfloat_t q2[QUAT_SIZE];
+	quat_slerp(q2, q0, q1, 0.5f);
+	if (!float_eq(0.0f, q2[0]) || !float_eq(0.0f, q2[1]) || !float_eq(MSIN(MPI / 8.0f), q2[2])
+		|| !float_eq(MCOS(MPI / 8.0f), q2[3])) {
+		return false;
+	}
+	mfloat_t a0[AFFINE_SIZE];
+	mfloat_t a1[AFFINE_SIZE];
+	affine_from_mat4(a0, m0);
+	affine_from_mat4(a1, m1);
+	mat4_from_affine(m1, a1);
+	reference_multiply(expected, m0, m1);
+	affine_multiply(a1, a0, a1);
+	mat4_from_affine(result, a1);
+	if (!array_eq(expected, result, MAT4_SIZE)) {
+		return false;
+	}
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+	mfloat_t x0[STREAM_COUNT], y0[STREAM_COUNT], z0[STREAM_COUNT];
+	mfloat_t x1[STREAM_COUNT], y1[STREAM_COUNT], z1[STREAM_COUNT];
+	mfloat_t rx[STREAM_COUNT], ry[STREAM_COUNT], rz[STREAM_COUNT];
+	mfloat_t m3[MAT3_SIZE] = {1.0f, 0.5f, -2.0f, 0.0f, 3.0f, 1.0f, -1.0f, 0.25f, 2.0f};
+	fill_stream(x0, y0, z0, 1);
+	fill_stream(x1, y1, z1, 4);
+	vec3_multiply_mat3_n(rx, ry, rz, x0, y0, z0, m3, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t a[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t e[VEC3_SIZE];
+		mfloat_t r[VEC3_SIZE] = {rx[i], ry[i], rz[i]};
+		vec3_multiply_mat3(e, a, m3);
+		if (!array_eq(e, r, VEC3_SIZE)) {
+			return false;
+		}
+	}
+	vec3_cross_n(rx, ry, rz, x0, y0, z0, x1, y1, z1, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t a[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t b[VEC3_SIZE] = {x1[i], y1[i], z1[i]};
+		mfloat_t e[VEC3_SIZE];
+		mfloat_t r[VEC3_SIZE] = {rx[i], ry[i], rz[i]};
+		vec3_cross(e, a, b);
+		if (!array_eq(e, r, VEC3_SIZE)) {
+			return false;
+		}
+	}
+	vec3_normalize_n(rx, ry, rz, x0, y0, z0, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t a[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t e[VEC3_SIZE];
+		mfloat_t r[VEC3_SIZE] = {rx[i], ry[i], rz[i]};
+		vec3_normalize(e, a);
+		if (!array_eq(e, r, VEC3_SIZE)) {
+			return false;
+		}
+	}
+	vec3_dot_n(rx, x0, y0, z0, x1, y1, z1, STREAM_COUNT);
+	vec3_length_n(ry, x0, y0, z0, STREAM_COUNT);
+	vec3_distance_n(rz, x0, y0, z0, x1, y1, z1, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t a[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t b[VEC3_SIZE] = {x1[i], y1[i], z1[i]};
+		if (!float_eq(vec3_dot(a, b), rx[i]) || !float_eq(vec3_length(a), ry[i])
+			|| !float_eq(vec3_distance(a, b), rz[i])) {
+			return false;
+		}
+	}
+	/* Odd count with a projective matrix covers the paired kernels' tail and the w divide */
+	mfloat_t packed[STREAM_COUNT * VEC3_SIZE];
+	mfloat_t transformed[STREAM_COUNT * VEC3_SIZE];
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		packed[i * VEC3_SIZE] = x0[i];
+		packed[i * VEC3_SIZE + 1] = y0[i];
+		packed[i * VEC3_SIZE + 2] = z0[i];
+	}
+	m0[3] = 0.01f;
+	mat4_transform_points_n(transformed, 0, packed, 0, m0, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t p[VEC4_SIZE] = {x0[i], y0[i], z0[i], 1.0f};
+		vec4_multiply_mat4_reference(p, m0);
+		if (!float_eq(p[0] / p[3], transformed[i * VEC3_SIZE])
+			|| !float_eq(p[2] / p[3], transformed[i * VEC3_SIZE + 2])) {
+			return false;
+		}
+	}
+	mat4_transform_directions_n(transformed, 0, packed, 0, m0, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t d[VEC4_SIZE] = {x0[i], y0[i], z0[i], 0.0f};
+		vec4_multiply_mat4_reference(d, m0);
+		if (!float_eq(d[0], transformed[i * VEC3_SIZE])
+			|| !float_eq(d[1], transformed[i * VEC3_SIZE + 1])) {
+			return false;
+		}
+	}
+	/* Covers the kernels with both operands in arrays and with the left one broadcast */
+	mfloat_t matrices[MATRIX_COUNT * MAT4_SIZE];
+	mfloat_t products[MATRIX_COUNT * MAT4_SIZE];
+	for (int i = 0; i < MATRIX_COUNT * MAT4_SIZE; i++) {
+		matrices[i] = (mfloat_t)((i * 7) % 19) * 0.125f - 1.0f;
+	}
+	mat4_multiply_n(products, 0, matrices, 0, matrices, 0, MATRIX_COUNT);
+	for (int i = 0; i < MATRIX_COUNT; i++) {
+		mfloat_t* m = matrices + i * MAT4_SIZE;
+		reference_multiply(expected, m, m);
+		if (!array_eq(expected, products + i * MAT4_SIZE, MAT4_SIZE)) {
+			return false;
+		}
+	}
+	mat4_multiply_broadcast_left_n(products, 0, m0, matrices, 0, MATRIX_COUNT);
+	for (int i = 0; i < MATRIX_COUNT; i++) {
+		reference_multiply(expected, m0, matrices + i * MAT4_SIZE);
+		if (!array_eq(expected, products + i * MAT4_SIZE, MAT4_SIZE)) {
+			return false;
+		}
+	}
+	mat4_multiply_broadcast_right_n(products, 0, matrices, 0, m0, MATRIX_COUNT);
+	for (int i = 0; i < MATRIX_COUNT; i++) {
+		reference_multiply(expected, matrices + i * MAT4_SIZE, m0);
+		if (!array_eq(expected, products + i * MAT4_SIZE, MAT4_SIZE)) {
+			return false;
+		}
+	}
+	/* The bounds are off the grid of the centers so no object touches a plane */
+	mfloat_t frustum[FRUSTUM_SIZE];
+	uint32_t spheres[(STREAM_COUNT + 31) / 32];
+	uint32_t boxes[(STREAM_COUNT + 31) / 32];
+	mat4_ortho(result, -6.3f, 5.7f, -2.9f, 3.1f, -3.3f, 2.7f);
+	frustum_from_mat4(frustum, result);
+	frustum_cull_spheres_n(spheres, frustum, x0, y0, z0, z1, STREAM_COUNT);
+	frustum_cull_aabbs_n(boxes, frustum, x0, y0, z0, z1, z1, z1, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		bool sphere = true;
+		bool box = true;
+		for (int p = 0; p < FRUSTUM_SIZE; p += 4) {
+			mfloat_t d = frustum[p] * x0[i] + frustum[p + 1] * y0[i] + frustum[p + 2] * z0[i]
+				+ frustum[p + 3];
+			mfloat_t reach = (MFABS(frustum[p]) + MFABS(frustum[p + 1]) + MFABS(frustum[p + 2]))
+				* z1[i];
+			sphere = sphere && d >= -z1[i];
+			box = box && d + reach >= 0.0f;
+		}
+		if ((((spheres[i / 32] >> (i % 32)) & 1u) != sphere)
+			|| (((boxes[i / 32] >> (i % 32)) & 1u) != box)) {
+			return false;
+		}
+	}
+	/* Right triangles facing the ray, with legs of length z1 along x and y */
+	mfloat_t origin[VEC3_SIZE] = {0.31f, 0.17f, -20.0f};
+	mfloat_t direction[VEC3_SIZE] = {0.0f, 0.0f, 1.0f};
+	mfloat_t box_distances[STREAM_COUNT];
+	mfloat_t triangle_distances[STREAM_COUNT];
+	mfloat_t nearest_box = INFINITY;
+	mfloat_t nearest_triangle = INFINITY;
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t u = (origin[0] - x0[i]) / z1[i];
+		mfloat_t v = (origin[1] - y0[i]) / z1[i];
+		bool inside = MFABS(origin[0] - x0[i]) <= z1[i] && MFABS(origin[1] - y0[i]) <= z1[i];
+		box_distances[i] = inside ? z0[i] - z1[i] - origin[2] : INFINITY;
+		triangle_distances[i] = u >= 0.0f && v >= 0.0f && u + v <= 1.0f ? z0[i] - origin[2]
+																		 : INFINITY;
+		nearest_box = MFMIN(nearest_box, box_distances[i]);
+		nearest_triangle = MFMIN(nearest_triangle, triangle_distances[i]);
+		rx[i] = x0[i] + z1[i];
+		ry[i] = y0[i] + z1[i];
+	}
+	mfloat_t distance;
+	size_t index;
+	if (!ray_intersect_aabbs_n(&distance, &index, origin, direction, INFINITY, x0, y0, z0, z1, z1,
+							   z1, STREAM_COUNT)
+		|| !float_eq(distance, nearest_box) || box_distances[index] != nearest_box) {
+		return false;
+	}
+	if (!ray_intersect_triangles_n(&distance, &index, origin, direction, INFINITY, x0, y0, z0, rx,
+								   y0, z0, x0, ry, z0, STREAM_COUNT)
+		|| !float_eq(distance, nearest_triangle) || triangle_distances[index] != nearest_triangle) {
+		return false;
+	}
+	/* Two bones weighted 3:1, alternating between the vertices */
+	mfloat_t palette[2 * MAT4_SIZE];
+	mfloat_t affine_palette[2 * AFFINE_SIZE];
+	uint16_t bones[STREAM_COUNT * SKIN_BONES];
+	mfloat_t weights[STREAM_COUNT * SKIN_BONES];
+	mfloat_t ax[STREAM_COUNT], ay[STREAM_COUNT], az[STREAM_COUNT];
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		palette[i] = m0[i];
+		palette[MAT4_SIZE + i] = m1[i];
+	}
+	affine_from_mat4(affine_palette, m0);
+	affine_from_mat4(affine_palette + AFFINE_SIZE, m1);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		bones[i * SKIN_BONES] = (uint16_t)(i % 2);
+		bones[i * SKIN_BONES + 1] = (uint16_t)(1 - i % 2);
+		bones[i * SKIN_BONES + 2] = 0;
+		bones[i * SKIN_BONES + 3] = 0;
+		weights[i * SKIN_BONES] = 0.75f;
+		weights[i * SKIN_BONES + 1] = 0.25f;
+		weights[i * SKIN_BONES + 2] = 0.0f;
+		weights[i * SKIN_BONES + 3] = 0.0f;
+	}
+	skin_mat4_n(rx, ry, rz, x1, y1, z1, x0, y0, z0, x0, y0, z0, bones, weights, palette,
+				STREAM_COUNT);
+	skin_affine_n(ax, ay, az, NULL, NULL, NULL, x0, y0, z0, NULL, NULL, NULL, bones, weights,
+				  affine_palette, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t p0[VEC4_SIZE] = {x0[i], y0[i], z0[i], 1.0f};
+		mfloat_t p1[VEC4_SIZE] = {x0[i], y0[i], z0[i], 1.0f};
+		mfloat_t n0[VEC4_SIZE] = {x0[i], y0[i], z0[i], 0.0f};
+		mfloat_t n1[VEC4_SIZE] = {x0[i], y0[i], z0[i], 0.0f};
+		vec4_multiply_mat4_reference(p0, palette + (i % 2) * MAT4_SIZE);
+		vec4_multiply_mat4_reference(p1, palette + (1 - i % 2) * MAT4_SIZE);
+		vec4_multiply_mat4_reference(n0, palette + (i % 2) * MAT4_SIZE);
+		vec4_multiply_mat4_reference(n1, palette + (1 - i % 2) * MAT4_SIZE);
+		mfloat_t e[VEC3_SIZE] = {p0[0] * 0.75f + p1[0] * 0.25f, p0[1] * 0.75f + p1[1] * 0.25f,
+								 p0[2] * 0.75f + p1[2] * 0.25f};
+		mfloat_t en[VEC3_SIZE] = {n0[0] * 0.75f + n1[0] * 0.25f, n0[1] * 0.75f + n1[1] * 0.25f,
+								  n0[2] * 0.75f + n1[2] * 0.25f};
+		mfloat_t r[VEC3_SIZE] = {rx[i], ry[i], rz[i]};
+		mfloat_t rn[VEC3_SIZE] = {x1[i], y1[i], z1[i]};
+		mfloat_t a[VEC3_SIZE] = {ax[i], ay[i], az[i]};
+		if (!array_eq(e, r, VEC3_SIZE) || !array_eq(en, rn, VEC3_SIZE)
+			|| !array_eq(e, a, VEC3_SIZE)) {
+			return false;
+		}
+	}
+	/* The same bones as dual quaternions, with the rotations of opposite sign */
+	mfloat_t dq_palette[2 * DUALQUAT_SIZE];
+	mfloat_t t0[VEC3_SIZE] = {1.0f, 2.0f, 3.0f};
+	mfloat_t t1[VEC3_SIZE] = {-2.0f, 0.0f, 1.0f};
+	dualquat_from_quat_vec3(dq_palette, q0, t0);
+	dualquat_from_quat_vec3(dq_palette + DUALQUAT_SIZE, q1, t1);
+	skin_dualquat_n(rx, ry, rz, x1, y1, z1, x0, y0, z0, x0, y0, z0, bones, weights, dq_palette,
+					STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t* first = dq_palette + (i % 2) * DUALQUAT_SIZE;
+		mfloat_t* second = dq_palette + (1 - i % 2) * DUALQUAT_SIZE;
+		mfloat_t blended[DUALQUAT_SIZE];
+		mfloat_t e[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t en[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t r[VEC3_SIZE] = {rx[i], ry[i], rz[i]};
+		mfloat_t rn[VEC3_SIZE] = {x1[i], y1[i], z1[i]};
+		for (int j = 0; j < DUALQUAT_SIZE; j++) {
+			blended[j] = first[j] * 0.75f - second[j] * 0.25f;
+		}
+		dualquat_normalize(blended, blended);
+		dualquat_transform_point(e, blended, e);
+		quat_rotate_vec3(en, blended, en);
+		if (!array_eq(e, r, VEC3_SIZE) || !array_eq(en, rn, VEC3_SIZE)) {
+			return false;
+		}
+	}
+	/* A root and two children of it, one scaled, and their world matrices */
+	mfloat_t nodes[3 * TRANSFORM_SIZE];
+	mfloat_t worlds[3 * MAT4_SIZE];
+	int32_t parents[3] = {-1, 0, 0};
+	mfloat_t scale[VEC3_SIZE] = {2.0f, 0.5f, 1.0f};
+	mfloat_t one[VEC3_SIZE] = {1.0f, 1.0f, 1.0f};
+	transform_from_trs(nodes, t0, q1, one);
+	transform_from_trs(nodes + TRANSFORM_SIZE, t1, q1, scale);
+	transform_from_trs(nodes + 2 * TRANSFORM_SIZE, t0, q0, one);
+	mat4_from_transform_hierarchy_n(worlds, nodes, parents, 3);
+	mat4_from_transform(expected, nodes);
+	if (!array_eq(expected, worlds, MAT4_SIZE)) {
+		return false;
+	}
+	for (int i = 1; i < 3; i++) {
+		mat4_from_transform(m0, nodes + i * TRANSFORM_SIZE);
+		reference_multiply(result, worlds, m0);
+		if (!array_eq(result, worlds + i * MAT4_SIZE, MAT4_SIZE)) {
+			return false;
+		}
+	}
+#endif
+	return true;
+}
+
+MU_TEST(test_simd_detect)
+{
+	enum mathc_simd best = mathc_simd_detect();
+	mu_assert(best >= MATHC_SIMD_SCALAR && best <= MATHC_SIMD_AVX512, "valid tier");
+	mu_assert(mathc_simd_get() == best, "best tier selected by default");
+#if defined(MATHC_USE_DISPATCH)
+	unsigned int features = mathc_cpu_features();
+	if (best >= MATHC_SIMD_SSE) {
+		mu_assert(features & MATHC_CPU_SSE41, "sse tier needs sse4.1");
+	}
+	if (best >= MATHC_SIMD_AVX2) {
+		mu_assert((features & MATHC_CPU_AVX2) && (features & MATHC_CPU_FMA),
+				  "avx2 tier needs avx2 and fma");
+	}
+	if (best >= MATHC_SIMD_AVX512) {
+		mu_assert(features & MATHC_CPU_AVX512F, "avx512 tier needs avx512f");
+	}
+#endif
+}
+
+MU_TEST(test_simd_tiers)
+{
+	enum mathc_simd best = mathc_simd_detect();
+	int checked = 0;
+	for (int tier = MATHC_SIMD_SCALAR; tier <= MATHC_SIMD_AVX512; tier++) {
+		bool accepted = mathc_simd_set((enum mathc_simd)tier);
+#if defined(MATHC_USE_DISPATCH)
+		mu_assert(accepted == (tier <= (int)best), "supported tiers are accepted");
+#else
+		mu_assert(accepted == (tier == (int)best), "only the compiled tier is accepted");
+#endif
+		if (!accepted) {
+			mu_assert(mathc_simd_get() != (enum mathc_simd)tier, "rejected tier not selected");
+			continue;
+		}
+		mu_assert(mathc_simd_get() == (enum mathc_simd)tier, "tier selected");
+		mu_assert(check_current_tier(), "tier matches the reference results");
+		checked++;
+	}
+	mu_assert(checked > 0, "at least one tier checked");
+	mu_assert(mathc_simd_set(best), "restore best tier");
+	mu_assert(mathc_simd_get() == best, "best tier restored");
+}
+
+#if defined(MATHC_USE_DISPATCH) && !defined(_WIN32)
+#define SWITCH_CALLS 200000
+#define SWITCH_COUNT 20000
+
+/* Multiplies the same matrices while the main thread switches tiers, and counts the mismatches */
+static void* multiply_while_switching(void* argument)
+{
+	int* mismatches = argument;
+	mfloat_t m0[MAT4_SIZE];
+	mfloat_t m1[MAT4_SIZE];
+	mfloat_t expected[MAT4_SIZE];
+	mfloat_t result[MAT4_SIZE];
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		m0[i] = (mfloat_t)(i % 5) - 2.0f;
+		m1[i] = (mfloat_t)(i % 7) * 0.5f - 1.0f;
+	}
+	reference_multiply(expected, m0, m1);
+	for (int i = 0; i < SWITCH_CALLS; i++) {
+		mat4_multiply(result, m0, m1);
+		if (!array_eq(result, expected, MAT4_SIZE)) {
+			(*mismatches)++;
+		}
+	}
+	return NULL;
+}
+
+MU_TEST(test_simd_switch_concurrent)
+{
+	enum mathc_simd best = mathc_simd_detect();
+	int mismatches = 0;
+	pthread_t thread;
+	mu_assert(pthread_create(&thread, NULL, multiply_while_switching, &mismatches) == 0,
+			  "start thread");
+	for (int i = 0; i < SWITCH_COUNT; i++) {
+		mu_assert(mathc_simd_set((enum mathc_simd)(i % ((int)best + 1))), "switch tier");
+	}
+	mu_assert(pthread_join(thread, NULL) == 0, "join thread");
+	mu_assert(mismatches == 0, "calls during a switch use a complete tier");
+	mu_assert(mathc_simd_set(best), "restore best tier");
+}
+#endif
+
+MU_TEST_SUITE(test_suite)
+{
+	MU_RUN_TEST(test_simd_detect);
+	MU_RUN_TEST(test_simd_tiers);
+#if defined(MATHC_USE_DISPATCH) && !defined(_WIN32)
+	MU_RUN_TEST(test_simd_switch_concurrent);
+#endif
+}
+
+int main(int argc, char** argv)
+{
+	(void)argc;
+	(void)argv;
+	MU_RUN_SUITE(test_suite);
+	MU_REPORT();
+	return MU_EXIT_CODE;
+}
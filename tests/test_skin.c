@@ -0,0 +1,182 @@
+#include <float.h>
+
+#include "mathc.h"
+#include "minunit.h"
+
+#define EPSILON 0.0001f
+#define BONE_COUNT 6
+#define VERTEX_COUNT 37
+
+static bool float_eq(mfloat_t a, mfloat_t b)
+{
+	return MFABS(a - b) < EPSILON;
+}
+
+static mfloat_t palette[BONE_COUNT * MAT4_SIZE];
+static mfloat_t affine_palette[BONE_COUNT * AFFINE_SIZE];
+static uint16_t bones[VERTEX_COUNT * SKIN_BONES];
+static mfloat_t weights[VERTEX_COUNT * SKIN_BONES];
+static mfloat_t px[VERTEX_COUNT], py[VERTEX_COUNT], pz[VERTEX_COUNT];
+static mfloat_t nx[VERTEX_COUNT], ny[VERTEX_COUNT], nz[VERTEX_COUNT];
+static mfloat_t rx[VERTEX_COUNT], ry[VERTEX_COUNT], rz[VERTEX_COUNT];
+static mfloat_t rnx[VERTEX_COUNT], rny[VERTEX_COUNT], rnz[VERTEX_COUNT];
+
+/*
+Bones rotated, scaled and moved by different amounts, and vertices with one to
+four bones whose weights add up to 1. The last row of the mat4 bones is garbage.
+*/
+static void fill_skin(void)
+{
+	for (int b = 0; b < BONE_COUNT; b++) {
+		mfloat_t axis[VEC3_SIZE] = {(mfloat_t)(b % 3) - 1.0f, 1.0f, (mfloat_t)(b % 2)};
+		mfloat_t scale[VEC3_SIZE] = {1.0f + b * 0.25f, 1.0f, 0.5f + b * 0.125f};
+		mfloat_t position[VEC3_SIZE] = {(mfloat_t)b - 2.0f, 0.5f * b, 3.0f - b};
+		mfloat_t* m = palette + b * MAT4_SIZE;
+		vec3_normalize(axis, axis);
+		mat4_rotation_axis(m, axis, 0.4f * b);
+		mat4_scaling(m, m, scale);
+		mat4_translation(m, m, position);
+		affine_from_mat4(affine_palette + b * AFFINE_SIZE, m);
+		m[3] = 7.0f;
+		m[7] = -7.0f;
+		m[11] = 0.5f;
+		m[15] = 2.0f;
+	}
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		int used = i % SKIN_BONES + 1;
+		mfloat_t total = 0.0f;
+		for (int k = 0; k < SKIN_BONES; k++) {
+			bones[i * SKIN_BONES + k] = (uint16_t)((i + k * 5) % BONE_COUNT);
+			weights[i * SKIN_BONES + k] = k < used ? (mfloat_t)(k + 1) : 0.0f;
+			total += weights[i * SKIN_BONES + k];
+		}
+		for (int k = 0; k < SKIN_BONES; k++) {
+			weights[i * SKIN_BONES + k] /= total;
+		}
+		px[i] = (mfloat_t)((i * 7) % 11) - 5.0f;
+		py[i] = (mfloat_t)((i * 3) % 13) * 0.5f - 3.0f;
+		pz[i] = (mfloat_t)(i % 5) - 2.0f;
+		nx[i] = (mfloat_t)(i % 3) - 1.0f;
+		ny[i] = 1.0f;
+		nz[i] = (mfloat_t)(i % 4) * 0.5f - 0.75f;
+	}
+}
+
+/* Blends the bone matrices of vertex i with the mat4 functions and transforms p and n */
+static void reference_skin(mfloat_t* p, mfloat_t* n, int i)
+{
+	mfloat_t blended[MAT4_SIZE];
+	mfloat_t weighted[MAT4_SIZE];
+	mfloat_t point[VEC4_SIZE] = {px[i], py[i], pz[i], 1.0f};
+	mfloat_t normal[VEC4_SIZE] = {nx[i], ny[i], nz[i], 0.0f};
+	mat4_zero(blended);
+	for (int k = 0; k < SKIN_BONES; k++) {
+		mat4_multiply_f(weighted, palette + bones[i * SKIN_BONES + k] * MAT4_SIZE,
+						weights[i * SKIN_BONES + k]);
+		for (int j = 0; j < MAT4_SIZE; j++) {
+			blended[j] += weighted[j];
+		}
+	}
+	vec4_multiply_mat4(point, point, blended);
+	vec4_multiply_mat4(normal, normal, blended);
+	vec3_assign(p, point);
+	vec3_assign(n, normal);
+}
+
+MU_TEST(test_skin_mat4)
+{
+	fill_skin();
+	skin_mat4_n(rx, ry, rz, rnx, rny, rnz, px, py, pz, nx, ny, nz, bones, weights, palette,
+				VERTEX_COUNT);
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		mfloat_t p[VEC3_SIZE];
+		mfloat_t n[VEC3_SIZE];
+		reference_skin(p, n, i);
+		mu_assert(float_eq(rx[i], p[0]) && float_eq(ry[i], p[1]) && float_eq(rz[i], p[2]),
+				  "position");
+		mu_assert(float_eq(rnx[i], n[0]) && float_eq(rny[i], n[1]) && float_eq(rnz[i], n[2]),
+				  "normal");
+	}
+}
+
+MU_TEST(test_skin_affine)
+{
+	fill_skin();
+	skin_affine_n(rx, ry, rz, rnx, rny, rnz, px, py, pz, nx, ny, nz, bones, weights,
+				  affine_palette, VERTEX_COUNT);
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		mfloat_t p[VEC3_SIZE];
+		mfloat_t n[VEC3_SIZE];
+		reference_skin(p, n, i);
+		mu_assert(float_eq(rx[i], p[0]) && float_eq(ry[i], p[1]) && float_eq(rz[i], p[2]),
+				  "position");
+		mu_assert(float_eq(rnx[i], n[0]) && float_eq(rny[i], n[1]) && float_eq(rnz[i], n[2]),
+				  "normal");
+	}
+}
+
+MU_TEST(test_skin_single_bone)
+{
+	fill_skin();
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		weights[i * SKIN_BONES] = 1.0f;
+		weights[i * SKIN_BONES + 1] = 0.0f;
+		weights[i * SKIN_BONES + 2] = 0.0f;
+		weights[i * SKIN_BONES + 3] = 0.0f;
+	}
+	skin_affine_n(rx, ry, rz, rnx, rny, rnz, px, py, pz, nx, ny, nz, bones, weights,
+				  affine_palette, VERTEX_COUNT);
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		mfloat_t* a = affine_palette + bones[i * SKIN_BONES] * AFFINE_SIZE;
+		mfloat_t v[VEC3_SIZE] = {px[i], py[i], pz[i]};
+		mfloat_t d[VEC3_SIZE] = {nx[i], ny[i], nz[i]};
+		affine_transform_point(v, a, v);
+		affine_transform_direction(d, a, d);
+		mu_assert(float_eq(rx[i], v[0]) && float_eq(ry[i], v[1]) && float_eq(rz[i], v[2]),
+				  "position of one bone");
+		mu_assert(float_eq(rnx[i], d[0]) && float_eq(rny[i], d[1]) && float_eq(rnz[i], d[2]),
+				  "normal of one bone");
+	}
+}
+
+MU_TEST(test_skin_in_place)
+{
+	mfloat_t expected[VERTEX_COUNT * VEC3_SIZE];
+	fill_skin();
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		mfloat_t n[VEC3_SIZE];
+		reference_skin(expected + i * VEC3_SIZE, n, i);
+		rnx[i] = -1.0f;
+	}
+	/* Positions only, written over the inputs */
+	skin_mat4_n(px, py, pz, NULL, NULL, NULL, px, py, pz, NULL, NULL, NULL, bones, weights,
+				palette, VERTEX_COUNT);
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		mu_assert(float_eq(px[i], expected[i * VEC3_SIZE])
+					  && float_eq(py[i], expected[i * VEC3_SIZE + 1])
+					  && float_eq(pz[i], expected[i * VEC3_SIZE + 2]),
+				  "position in place");
+		mu_assert(rnx[i] == -1.0f, "normals untouched");
+	}
+	skin_affine_n(rx, ry, rz, NULL, NULL, NULL, px, py, pz, NULL, NULL, NULL, bones, weights,
+				  affine_palette, 0);
+	mu_assert(rnx[0] == -1.0f, "no vertices");
+}
+
+MU_TEST_SUITE(test_suite)
+{
+	MU_RUN_TEST(test_skin_mat4);
+	MU_RUN_TEST(test_skin_affine);
+	MU_RUN_TEST(test_skin_single_bone);
+	MU_RUN_TEST(test_skin_in_place);
+}
+
+int main(int argc, char** argv)
+{
+	(void)argc;
+	(void)argv;
+
+	MU_RUN_SUITE(test_suite);
+	MU_REPORT();
+	return MU_EXIT_CODE;
+}
@@ -0,0 +1,168 @@
+#include <float.h>
+#include <stdio.h>
+
+#include "mathc.h"
+#include "minunit.h"
+
+#define SAMPLE_COUNT 200000
+
+#if defined(MATHC_USE_SINGLE_FLOATING_POINT)
+struct transcendental_error {
+	/* Largest error in units in the last place of the exact result */
+	double ulp;
+	/* Largest absolute error */
+	double absolute;
+};
+
+/* Spacing of single precision values around `x`, or of denormals below FLT_MIN */
+static double ulp_of(double x)
+{
+	int exponent;
+	if (fabs(x) < FLT_MIN) {
+		return ldexp(1.0, -149);
+	}
+	frexp(x, &exponent);
+	return ldexp(1.0, exponent - 24);
+}
+
+static void measure(struct transcendental_error* error, double exact, mfloat_t result)
+{
+	double e = fabs((double)result - exact);
+	double u = e / ulp_of(exact);
+	error->ulp = u > error->ulp ? u : error->ulp;
+	error->absolute = e > error->absolute ? e : error->absolute;
+}
+
+static mfloat_t sample(double min, double max, int i)
+{
+	return (mfloat_t)(min + (max - min) * (double)i / (double)(SAMPLE_COUNT - 1));
+}
+
+static void print_row(const char* name, const char* range, struct transcendental_error* error)
+{
+	printf("%-6s %-18s %10.2f %12.3e\n", name, range, error->ulp, error->absolute);
+}
+
+MU_TEST(test_transcendental_error_table)
+{
+	struct transcendental_error sin_error = {0.0, 0.0};
+	struct transcendental_error cos_error = {0.0, 0.0};
+	struct transcendental_error sin_wide = {0.0, 0.0};
+	struct transcendental_error acos_error = {0.0, 0.0};
+	struct transcendental_error atan2_error = {0.0, 0.0};
+	struct transcendental_error exp2_error = {0.0, 0.0};
+	struct transcendental_error log2_error = {0.0, 0.0};
+	struct transcendental_error pow_error = {0.0, 0.0};
+	for (int i = 0; i < SAMPLE_COUNT; i++) {
+		mfloat_t x = sample(-MPI, MPI, i);
+		measure(&sin_error, sin((double)x), mathc_sin_fast(x));
+		measure(&cos_error, cos((double)x), mathc_cos_fast(x));
+		x = sample(-10000.0, 10000.0, i);
+		measure(&sin_wide, sin((double)x), mathc_sin_fast(x));
+		x = sample(-1.0, 1.0, i);
+		measure(&acos_error, acos((double)x), mathc_acos_fast(x));
+		x = sample(-126.0, 127.99, i);
+		measure(&exp2_error, exp2((double)x), mathc_exp2_fast(x));
+		x = sample(0.001, 1000.0, i);
+		measure(&log2_error, log2((double)x), mathc_log2_fast(x));
+		x = sample(0.5, 2.0, i);
+		measure(&pow_error, pow((double)x, 2.2), mathc_pow_fast(x, 2.2f));
+	}
+	for (int i = 0; i < 1000; i++) {
+		for (int j = 0; j < 200; j++) {
+			mfloat_t x = (mfloat_t)(-10.0 + 20.0 * i / 999.0);
+			mfloat_t y = (mfloat_t)(-10.0 + 20.0 * j / 199.0);
+			measure(&atan2_error, atan2((double)y, (double)x), mathc_atan2_fast(y, x));
+		}
+	}
+	printf("\n%-6s %-18s %10s %12s\n", "", "range", "ulp", "absolute");
+	print_row("sin", "[-pi, pi]", &sin_error);
+	print_row("cos", "[-pi, pi]", &cos_error);
+	print_row("sin", "[-1e4, 1e4]", &sin_wide);
+	print_row("acos", "[-1, 1]", &acos_error);
+	print_row("atan2", "[-10, 10]^2", &atan2_error);
+	print_row("exp2", "[-126, 128)", &exp2_error);
+	print_row("log2", "[1e-3, 1e3]", &log2_error);
+	print_row("pow", "[0.5, 2]^2.2", &pow_error);
+	mu_assert(sin_error.ulp < 2.0 && cos_error.ulp < 2.0, "sin and cos ulp");
+	mu_assert(sin_wide.absolute < 1e-7, "sin absolute error of large angles");
+	mu_assert(acos_error.ulp < 3.5, "acos ulp");
+	mu_assert(atan2_error.ulp < 3.5, "atan2 ulp");
+	mu_assert(exp2_error.ulp < 1.5, "exp2 ulp");
+	mu_assert(log2_error.ulp < 2.0, "log2 ulp");
+	mu_assert(pow_error.ulp < 2.0 + 2.2, "pow ulp");
+}
+
+MU_TEST(test_transcendental_special_values)
+{
+	mu_assert(mathc_sin_fast(0.0f) == 0.0f && mathc_cos_fast(0.0f) == 1.0f, "sin and cos of 0");
+	mu_assert(isnan(mathc_sin_fast(INFINITY)) && isnan(mathc_cos_fast(-INFINITY)), "sin of inf");
+	mu_assert(isnan(mathc_sin_fast(NAN)) && isnan(mathc_cos_fast(NAN)), "sin of NAN");
+	mu_assert(isnan(mathc_sin_fast(7e6f)) && isnan(mathc_cos_fast(-3e9f)), "beyond 6.5e6");
+	mu_assert(!isnan(mathc_sin_fast(6e6f)), "below 6.5e6");
+	mu_assert(mathc_acos_fast(1.0f) == 0.0f, "acos of 1");
+	mu_assert(fabs(mathc_acos_fast(1.5f)) == 0.0f, "acos clamps");
+	mu_assert(mathc_atan2_fast(0.0f, 0.0f) == 0.0f, "atan2 of the origin");
+	mu_assert(mathc_exp2_fast(10.0f) == 1024.0f, "exp2 of an integer");
+	mu_assert(mathc_exp2_fast(-149.0f) == FLT_MIN * FLT_EPSILON, "smallest denormal");
+	mu_assert(mathc_exp2_fast(-200.0f) == 0.0f, "underflow");
+	mu_assert(isinf(mathc_exp2_fast(200.0f)), "overflow");
+	mu_assert(mathc_exp2_fast(127.9f) < FLT_MAX, "largest finite results");
+	mu_assert(isinf(mathc_exp2_fast(INFINITY)), "exp2 of inf");
+	mu_assert(mathc_exp2_fast(-INFINITY) == 0.0f, "exp2 of -inf");
+	mu_assert(isnan(mathc_exp2_fast(NAN)), "exp2 of NAN");
+	mu_assert(mathc_log2_fast(8.0f) == 3.0f, "log2 of a power of two");
+	mu_assert(isinf(mathc_log2_fast(0.0f)) && mathc_log2_fast(0.0f) < 0.0f, "log2 of 0");
+	mu_assert(isnan(mathc_log2_fast(-1.0f)), "log2 of a negative value");
+	mu_assert(isinf(mathc_log2_fast(INFINITY)) && mathc_log2_fast(INFINITY) > 0.0f, "log2 of inf");
+	mu_assert(isnan(mathc_log2_fast(NAN)), "log2 of NAN");
+	mu_assert(mathc_pow_fast(0.0f, 2.0f) == 0.0f, "pow of 0");
+	mu_assert(mathc_pow_fast(0.0f, 0.0f) == 1.0f, "0 to the power 0");
+	mu_assert(mathc_pow_fast(INFINITY, 0.0f) == 1.0f, "inf to the power 0");
+	mu_assert(mathc_pow_fast(1.0f, INFINITY) == 1.0f, "1 to the power inf");
+	mu_assert(isinf(mathc_pow_fast(0.0f, -2.0f)), "pow of 0 with a negative exponent");
+}
+#endif
+
+#if defined(MATHC_FAST_TRANSCENDENTALS) && defined(MATHC_USE_SINGLE_FLOATING_POINT)
+MU_TEST(test_transcendental_used)
+{
+	mfloat_t v[VEC2_SIZE] = {-0.3f, 0.7f};
+	mu_assert(vec2_angle(v) == mathc_atan2_fast(0.7f, -0.3f), "vec2_angle");
+	mu_assert(sine_ease_in_out(0.3f) == 0.5f * (1.0f - mathc_cos_fast(0.3f * MPI)), "easing");
+}
+#endif
+
+MU_TEST(test_transcendental_matches_c_library)
+{
+	for (int i = 0; i < 1000; i++) {
+		mfloat_t x = (mfloat_t)(i - 500) * MFLOAT_C(0.01);
+		mu_assert(MFABS(mathc_sin_fast(x) - MSIN(x)) < MFLOAT_C(1e-6), "sin");
+		mu_assert(MFABS(mathc_cos_fast(x) - MCOS(x)) < MFLOAT_C(1e-6), "cos");
+		mu_assert(MFABS(mathc_acos_fast(x * 0.19f) - MACOS(x * 0.19f)) < MFLOAT_C(1e-6), "acos");
+		mu_assert(MFABS(mathc_atan2_fast(x, 1.0f - x) - MATAN2(x, 1.0f - x)) < MFLOAT_C(1e-6),
+				  "atan2");
+		mu_assert(MFABS(mathc_exp2_fast(x) / MPOW(2.0f, x) - 1.0f) < MFLOAT_C(1e-6), "exp2");
+	}
+}
+
+MU_TEST_SUITE(test_suite)
+{
+#if defined(MATHC_USE_SINGLE_FLOATING_POINT)
+	MU_RUN_TEST(test_transcendental_error_table);
+	MU_RUN_TEST(test_transcendental_special_values);
+#endif
+#if defined(MATHC_FAST_TRANSCENDENTALS) && defined(MATHC_USE_SINGLE_FLOATING_POINT)
+	MU_RUN_TEST(test_transcendental_used);
+#endif
+	MU_RUN_TEST(test_transcendental_matches_c_library);
+}
+
+int main(int argc, char** argv)
+{
+	(void)argc;
+	(void)argv;
+	MU_RUN_SUITE(test_suite);
+	MU_REPORT();
+	return MU_EXIT_CODE;
+}
@@ -0,0 +1,231 @@
+#include <float.h>
+
+#include "mathc.h"
+#include "minunit.h"
+
+#define EPSILON 0.0001f
+#define NODE_COUNT 9
+
+static bool float_eq(mfloat_t a, mfloat_t b)
+{
+	return MFABS(a - b) < EPSILON;
+}
+
+static bool array_eq(mfloat_t* a, mfloat_t* b, int n)
+{
+	for (int i = 0; i < n; i++) {
+		if (!float_eq(a[i], b[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/* The rotations are about the axes, or about a unit axis that mixes x and z */
+static mfloat_t x_axis[VEC3_SIZE] = {1.0f, 0.0f, 0.0f};
+static mfloat_t y_axis[VEC3_SIZE] = {0.0f, 1.0f, 0.0f};
+static mfloat_t z_axis[VEC3_SIZE] = {0.0f, 0.0f, 1.0f};
+static mfloat_t xz_axis[VEC3_SIZE] = {0.6f, 0.0f, 0.8f};
+
+static void make_transform(mfloat_t* t, mfloat_t x, mfloat_t y, mfloat_t z, mfloat_t* axis,
+						   mfloat_t angle, mfloat_t sx, mfloat_t sy, mfloat_t sz)
+{
+	mfloat_t position[VEC3_SIZE] = {x, y, z};
+	mfloat_t scale[VEC3_SIZE] = {sx, sy, sz};
+	mfloat_t q[QUAT_SIZE];
+	quat_from_axis_angle(q, axis, angle);
+	transform_from_trs(t, position, q, scale);
+}
+
+/* What mat4_from_transform() replaces: translation * rotation * scaling */
+static void reference_mat4(mfloat_t* result, mfloat_t* t)
+{
+	mfloat_t translation[MAT4_SIZE];
+	mfloat_t rotation[MAT4_SIZE];
+	mfloat_t scaling[MAT4_SIZE];
+	mat4_identity(translation);
+	mat4_identity(scaling);
+	mat4_translation(translation, translation, t);
+	mat4_rotation_quat(rotation, t + 3);
+	mat4_scaling(scaling, scaling, t + 7);
+	mat4_multiply(result, rotation, scaling);
+	mat4_multiply(result, translation, result);
+}
+
+MU_TEST(test_transform_identity)
+{
+	mfloat_t t[TRANSFORM_SIZE];
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t identity[MAT4_SIZE];
+	transform_identity(t);
+	mat4_from_transform(m, t);
+	mat4_identity(identity);
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		mu_assert(identity[i] == m[i], "identity");
+	}
+}
+
+MU_TEST(test_transform_matrices)
+{
+	mfloat_t t[TRANSFORM_SIZE];
+	mfloat_t expected[MAT4_SIZE];
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t a[AFFINE_SIZE];
+	mfloat_t from_mat4[AFFINE_SIZE];
+	/* A quarter turn about z maps the scaled x axis to y and the y axis to -x */
+	mfloat_t quarter_turn[MAT4_SIZE] = {0.0f, 2.0f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,
+										0.0f, 0.0f, 0.5f, 0.0f, 1.0f, 2.0f, 3.0f, 1.0f};
+	make_transform(t, 1.0f, 2.0f, 3.0f, z_axis, MPI_2, 2.0f, 1.0f, 0.5f);
+	mat4_from_transform(m, t);
+	mu_assert(array_eq(quarter_turn, m, MAT4_SIZE), "quarter turn");
+	make_transform(t, -1.5f, 0.25f, 4.0f, xz_axis, MPI / 3.0f, 0.5f, 2.0f, 1.25f);
+	reference_mat4(expected, t);
+	mat4_from_transform(m, t);
+	mu_assert(array_eq(expected, m, MAT4_SIZE), "same as the product of three mat4");
+	affine_from_transform(a, t);
+	affine_from_mat4(from_mat4, expected);
+	mu_assert(array_eq(from_mat4, a, AFFINE_SIZE), "affine");
+}
+
+MU_TEST(test_transform_multiply)
+{
+	mfloat_t t0[TRANSFORM_SIZE];
+	mfloat_t t1[TRANSFORM_SIZE];
+	mfloat_t t[TRANSFORM_SIZE];
+	mfloat_t m0[MAT4_SIZE];
+	mfloat_t m1[MAT4_SIZE];
+	mfloat_t expected[MAT4_SIZE];
+	mfloat_t result[MAT4_SIZE];
+	/* The scale of t1 doesn't have to be uniform */
+	make_transform(t0, 1.0f, -2.0f, 0.5f, y_axis, MPI_2, 2.0f, 2.0f, 2.0f);
+	make_transform(t1, 3.0f, 0.0f, -1.0f, xz_axis, MPI / 3.0f, 0.5f, 1.5f, 3.0f);
+	mat4_from_transform(m0, t0);
+	mat4_from_transform(m1, t1);
+	mat4_multiply(expected, m0, m1);
+	transform_multiply(t, t0, t1);
+	mat4_from_transform(result, t);
+	mu_assert(array_eq(expected, result, MAT4_SIZE), "same as mat4_multiply");
+	transform_multiply(t1, t0, t1);
+	mu_assert(array_eq(t, t1, TRANSFORM_SIZE), "result aliases an operand");
+}
+
+MU_TEST(test_transform_inverse)
+{
+	mfloat_t t[TRANSFORM_SIZE];
+	mfloat_t inverse[TRANSFORM_SIZE];
+	mfloat_t product[TRANSFORM_SIZE];
+	mfloat_t identity[TRANSFORM_SIZE];
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t expected[MAT4_SIZE];
+	mfloat_t result[MAT4_SIZE];
+	make_transform(t, -3.0f, 1.0f, 2.0f, xz_axis, -MPI / 4.0f, 4.0f, 4.0f, 4.0f);
+	transform_inverse(inverse, t);
+	transform_multiply(product, t, inverse);
+	transform_identity(identity);
+	mu_assert(array_eq(identity, product, TRANSFORM_SIZE), "t * inverse(t)");
+	mat4_from_transform(m, t);
+	mat4_inverse(expected, m);
+	mat4_from_transform(result, inverse);
+	mu_assert(array_eq(expected, result, MAT4_SIZE), "same as mat4_inverse");
+	transform_inverse(t, t);
+	mu_assert(array_eq(inverse, t, TRANSFORM_SIZE), "in place");
+}
+
+MU_TEST(test_transform_point)
+{
+	mfloat_t t[TRANSFORM_SIZE];
+	mfloat_t m[MAT4_SIZE];
+	mfloat_t v[VEC3_SIZE] = {1.5f, -4.0f, 2.25f};
+	mfloat_t expected[VEC4_SIZE] = {1.5f, -4.0f, 2.25f, 1.0f};
+	make_transform(t, 0.5f, 2.0f, -1.0f, x_axis, MPI, 1.5f, 3.0f, 1.5f);
+	mat4_from_transform(m, t);
+	vec4_multiply_mat4(expected, expected, m);
+	transform_transform_point(v, t, v);
+	mu_assert(array_eq(expected, v, VEC3_SIZE), "same as the mat4");
+}
+
+/* Two roots, the second one last, and a chain and branches in between */
+static int32_t parents[NODE_COUNT] = {-1, 0, 1, 1, 0, 4, 5, 2, -1};
+static mfloat_t local[NODE_COUNT * TRANSFORM_SIZE];
+static mfloat_t world[NODE_COUNT * TRANSFORM_SIZE];
+static mfloat_t matrices[NODE_COUNT * MAT4_SIZE];
+
+/* Turns about each axis in turn, with the scale of the x axis on all three axes if `uniform` */
+static void fill_hierarchy(bool uniform)
+{
+	static mfloat_t* axes[4] = {x_axis, y_axis, z_axis, xz_axis};
+	static mfloat_t angles[NODE_COUNT] = {MPI_2, -MPI_2, MPI, MPI / 3.0f, MPI_4,
+										  -MPI / 3.0f, MPI_2, MPI, -MPI_4};
+	static mfloat_t scales[NODE_COUNT][VEC3_SIZE] = {
+		{2.0f, 1.0f, 0.5f}, {0.5f, 1.5f, 1.0f}, {1.25f, 0.75f, 2.0f},
+		{1.0f, 2.0f, 3.0f}, {0.75f, 0.5f, 1.0f}, {3.0f, 1.0f, 1.5f},
+		{1.5f, 1.25f, 0.5f}, {0.5f, 0.5f, 2.0f}, {2.5f, 1.0f, 0.75f}};
+	for (int i = 0; i < NODE_COUNT; i++) {
+		mfloat_t* s = scales[i];
+		make_transform(local + i * TRANSFORM_SIZE, (mfloat_t)i, 1.0f - 0.5f * i, 0.25f * i,
+					   axes[i % 4], angles[i], s[0], uniform ? s[0] : s[1], uniform ? s[0] : s[2]);
+	}
+}
+
+/* The world matrix of node i as the product of the local matrices up to the root */
+static void reference_world(mfloat_t* result, int32_t i)
+{
+	mfloat_t m[MAT4_SIZE];
+	mat4_identity(result);
+	for (; i >= 0; i = parents[i]) {
+		mat4_from_transform(m, local + i * TRANSFORM_SIZE);
+		mat4_multiply(result, m, result);
+	}
+}
+
+MU_TEST(test_transform_hierarchy)
+{
+	fill_hierarchy(true);
+	transform_hierarchy_n(world, local, parents, NODE_COUNT);
+	for (int i = 0; i < NODE_COUNT; i++) {
+		mfloat_t expected[MAT4_SIZE];
+		mfloat_t result[MAT4_SIZE];
+		reference_world(expected, i);
+		mat4_from_transform(result, world + i * TRANSFORM_SIZE);
+		mu_assert(array_eq(expected, result, MAT4_SIZE), "world transform");
+	}
+	mu_assert(array_eq(local, world, TRANSFORM_SIZE), "root copied");
+	transform_hierarchy_n(local, local, parents, NODE_COUNT);
+	mu_assert(array_eq(world, local, NODE_COUNT * TRANSFORM_SIZE), "in place");
+}
+
+MU_TEST(test_transform_hierarchy_mat4)
+{
+	/* Scales that aren't uniform, which the world matrices keep exactly */
+	fill_hierarchy(false);
+	mat4_from_transform_hierarchy_n(matrices, local, parents, NODE_COUNT);
+	for (int i = 0; i < NODE_COUNT; i++) {
+		mfloat_t expected[MAT4_SIZE];
+		reference_world(expected, i);
+		mu_assert(array_eq(expected, matrices + i * MAT4_SIZE, MAT4_SIZE), "world matrix");
+	}
+	matrices[0] = -1.0f;
+	mat4_from_transform_hierarchy_n(matrices, local, parents, 0);
+	mu_assert(matrices[0] == -1.0f, "no nodes");
+}
+
+MU_TEST_SUITE(test_suite)
+{
+	MU_RUN_TEST(test_transform_identity);
+	MU_RUN_TEST(test_transform_matrices);
+	MU_RUN_TEST(test_transform_multiply);
+	MU_RUN_TEST(test_transform_inverse);
+	MU_RUN_TEST(test_transform_point);
+	MU_RUN_TEST(test_transform_hierarchy);
+	MU_RUN_TEST(test_transform_hierarchy_mat4);
+}
+
+int main(int argc, char** argv)
+{
+	(void)argc;
+	(void)argv;
+
+	MU_RUN_SUITE(test_suite);
+	MU_REPORT();
+	return MU_EXIT_CODE;
+}
@@ -257,6 +257,55 @@ MU_TEST(test_remap_negative_input)
 	mu_assert(float_eq(1.0f, remap(100.0f, -100.0f, 100.0f, 0.0f, 1.0f)), "100 -> 1");
 }
 
+MU_TEST(test_aligned_alloc_alignment)
+{
+	size_t alignments[] = {4, 16, 32, 64, 128};
+	for (int i = 0; i < 5; i++) {
+		unsigned char* p = mathc_aligned_alloc(100, alignments[i]);
+		mu_assert(p != NULL, "allocated");
+		mu_assert((uintptr_t)p % alignments[i] == 0, "aligned");
+		/* The whole block must be writable */
+		for (int j = 0; j < 100; j++) {
+			p[j] = (unsigned char)j;
+		}
+		mathc_aligned_free(p);
+	}
+	mathc_aligned_free(NULL);
+}
+
+MU_TEST(test_aligned_alloc_invalid_alignment)
+{
+	mu_assert(mathc_aligned_alloc(16, 24) == NULL, "alignment must be a power of two");
+	mu_assert(mathc_aligned_alloc(SIZE_MAX, 16) == NULL, "size overflow");
+}
+
+#if defined(MATHC_USE_FLOATING_POINT)
+MU_TEST(test_aligned_mat4_array)
+{
+	struct mat4* transforms = mathc_aligned_alloc(8 * sizeof(struct mat4), MATHC_MAT4_ALIGNMENT);
+	mu_assert(transforms != NULL, "allocated");
+	for (int i = 0; i < 8; i++) {
+		mu_assert((uintptr_t)&transforms[i] % MATHC_MAT4_ALIGNMENT == 0, "mat4 aligned");
+		mat4_identity((mfloat_t*)&transforms[i]);
+	}
+	mu_assert(float_eq(1.0f, transforms[7].m44), "mat4 writable");
+	mathc_aligned_free(transforms);
+#if defined(MATHC_ALIGNED)
+	mu_assert(sizeof(struct vec4) % MATHC_VEC4_ALIGNMENT == 0, "vec4 size");
+	mu_assert(sizeof(struct quat) % MATHC_QUAT_ALIGNMENT == 0, "quat size");
+	mu_assert(sizeof(struct mat4) % MATHC_MAT4_ALIGNMENT == 0, "mat4 size");
+#if defined(MATHC_USE_SINGLE_FLOATING_POINT)
+	mu_assert(sizeof(struct mat4) == MATHC_MAT4_ALIGNMENT, "one mat4 per cache line");
+#endif
+	mu_assert(sizeof(struct affine) == AFFINE_SIZE * sizeof(mfloat_t), "affine not padded");
+	mu_assert(sizeof(struct dualquat) == DUALQUAT_SIZE * sizeof(mfloat_t), "dualquat not padded");
+	mu_assert(sizeof(struct transform) == TRANSFORM_SIZE * sizeof(mfloat_t), "transform packed");
+	struct vec4 v[2];
+	mu_assert((uintptr_t)&v[1] % MATHC_VEC4_ALIGNMENT == 0, "vec4 aligned");
+#endif
+}
+#endif
+
 MU_TEST_SUITE(test_suite)
 {
 	MU_RUN_TEST(test_clampi_within_range);
@@ -306,6 +355,12 @@ MU_TEST_SUITE(test_suite)
 	MU_RUN_TEST(test_remap_negative_output);
 	MU_RUN_TEST(test_remap_inverted_output);
 	MU_RUN_TEST(test_remap_negative_input);
+
+	MU_RUN_TEST(test_aligned_alloc_alignment);
+	MU_RUN_TEST(test_aligned_alloc_invalid_alignment);
+#if defined(MATHC_USE_FLOATING_POINT)
+	MU_RUN_TEST(test_aligned_mat4_array);
+#endif
 }
 
 int main(int argc, char** argv)
@@ -265,6 +265,21 @@ MU_TEST(test_vec2_angle)
 	mu_assert(float_eq(MPI_2, vec2_angle(v1)), "(0,1)");
 }
 
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+MU_TEST(test_vec2_angle_n)
+{
+	mfloat_t x[9] = {1.0f, 0.0f, -1.0f, 0.0f, 3.0f, -2.0f, -0.5f, 4.0f, 0.0f};
+	mfloat_t y[9] = {0.0f, 1.0f, 0.0f, -1.0f, 4.0f, 7.0f, -0.25f, -9.0f, 0.0f};
+	mfloat_t result[9];
+	vec2_angle_n(result, x, y, 9);
+	for (int i = 0; i < 9; i++) {
+		mfloat_t v[VEC2_SIZE] = {x[i], y[i]};
+		mu_assert(float_eq(MATAN2(y[i], x[i]), result[i]), "matches atan2");
+		mu_assert(float_eq(vec2_angle(v), result[i]), "matches vec2_angle");
+	}
+}
+#endif
+
 MU_TEST(test_vec2_rotate)
 {
 	mfloat_t v0[VEC2_SIZE] = {1.0f, 0.0f};
@@ -373,6 +388,54 @@ MU_TEST(test_svec2_chained)
 	mu_assert(float_eq(12.0f, result.y), "y");
 }
 
+MU_TEST(test_svec2_matches_array_api)
+{
+	mfloat_t a[VEC2_SIZE] = {1.5f, -2.0f};
+	mfloat_t b[VEC2_SIZE] = {-0.5f, 4.0f};
+	mfloat_t c[VEC2_SIZE] = {0.0f, 1.0f};
+	mfloat_t m[MAT2_SIZE] = {1.0f, 2.0f, -3.0f, 0.5f};
+	mfloat_t e[VEC2_SIZE];
+	struct vec2 v0 = svec2(a[0], a[1]);
+	struct vec2 v1 = svec2(b[0], b[1]);
+	struct vec2 v2 = svec2(c[0], c[1]);
+	struct mat2 m0 = smat2(m[0], m[2], m[1], m[3]);
+#define ASSERT_SVEC2(v, message) mu_assert(float_eq(e[0], (v).x) && float_eq(e[1], (v).y), message)
+	vec2_add(e, a, b);
+	ASSERT_SVEC2(svec2_add(v0, v1), "add");
+	vec2_add_f(e, a, 0.25f);
+	ASSERT_SVEC2(svec2_add_f(v0, 0.25f), "add_f");
+	vec2_subtract(e, a, b);
+	ASSERT_SVEC2(svec2_subtract(v0, v1), "subtract");
+	vec2_multiply(e, a, b);
+	ASSERT_SVEC2(svec2_multiply(v0, v1), "multiply");
+	vec2_multiply_f(e, a, 3.0f);
+	ASSERT_SVEC2(svec2_multiply_f(v0, 3.0f), "multiply_f");
+	vec2_multiply_mat2(e, a, m);
+	ASSERT_SVEC2(svec2_multiply_mat2(v0, m0), "multiply_mat2");
+	vec2_divide(e, a, b);
+	ASSERT_SVEC2(svec2_divide(v0, v1), "divide");
+	vec2_negative(e, a);
+	ASSERT_SVEC2(svec2_negative(v0), "negative");
+	vec2_abs(e, a);
+	ASSERT_SVEC2(svec2_abs(v0), "abs");
+	vec2_floor(e, a);
+	ASSERT_SVEC2(svec2_floor(v0), "floor");
+	vec2_clamp(e, a, b, c);
+	ASSERT_SVEC2(svec2_clamp(v0, v1, v2), "clamp");
+	vec2_normalize(e, a);
+	ASSERT_SVEC2(svec2_normalize(v0), "normalize");
+	vec2_tangent(e, a);
+	ASSERT_SVEC2(svec2_tangent(v0), "tangent");
+	vec2_lerp(e, a, b, 0.3f);
+	ASSERT_SVEC2(svec2_lerp(v0, v1, 0.3f), "lerp");
+#undef ASSERT_SVEC2
+	mu_assert(float_eq(vec2_dot(a, b), svec2_dot(v0, v1)), "dot");
+	mu_assert(float_eq(vec2_length(a), svec2_length(v0)), "length");
+	mu_assert(float_eq(vec2_distance(a, b), svec2_distance(v0, v1)), "distance");
+	mu_assert(float_eq(vec2_distance_squared(a, b), svec2_distance_squared(v0, v1)),
+			  "distance_squared");
+}
+
 MU_TEST_SUITE(test_suite)
 {
 	MU_RUN_TEST(test_vec2_create);
@@ -404,6 +467,9 @@ MU_TEST_SUITE(test_suite)
 	MU_RUN_TEST(test_vec2_lerp_endpoints);
 	MU_RUN_TEST(test_vec2_tangent);
 	MU_RUN_TEST(test_vec2_angle);
+#if defined(MATHC_USE_STREAM_FUNCTIONS)
+	MU_RUN_TEST(test_vec2_angle_n);
+#endif
 	MU_RUN_TEST(test_vec2_rotate);
 	MU_RUN_TEST(test_vec2_sign);
 
@@ -418,6 +484,7 @@ MU_TEST_SUITE(test_suite)
 	MU_RUN_TEST(test_svec2_lerp);
 	MU_RUN_TEST(test_svec2_rotate);
 	MU_RUN_TEST(test_svec2_chained);
+	MU_RUN_TEST(test_svec2_matches_array_api);
 }
 
 int main(int argc, char** argv)
@@ -169,6 +169,234 @@ MU_TEST(test_vec3_clamp)
 	mu_assert(float_eq(5.0f, result[2]), "unchanged");
 }
 
+/* stream API */
+
+#define STREAM_COUNT 131
+
+static void stream_fill(mfloat_t* x, mfloat_t* y, mfloat_t* z, mfloat_t seed)
+{
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		x[i] = seed + (mfloat_t)(i % 7) - 3.0f;
+		y[i] = seed * 0.5f - (mfloat_t)(i % 5) + 1.25f;
+		z[i] = (mfloat_t)(i % 11) * 0.75f - seed;
+	}
+}
+
+static bool stream_matches(mfloat_t* rx, mfloat_t* ry, mfloat_t* rz, int i, mfloat_t* expected)
+{
+	return float_eq(expected[0], rx[i]) && float_eq(expected[1], ry[i]) &&
+		   float_eq(expected[2], rz[i]);
+}
+
+MU_TEST(test_vec3_add_n)
+{
+	mfloat_t x0[STREAM_COUNT], y0[STREAM_COUNT], z0[STREAM_COUNT];
+	mfloat_t x1[STREAM_COUNT], y1[STREAM_COUNT], z1[STREAM_COUNT];
+	mfloat_t rx[STREAM_COUNT], ry[STREAM_COUNT], rz[STREAM_COUNT];
+	stream_fill(x0, y0, z0, 2.0f);
+	stream_fill(x1, y1, z1, -1.5f);
+	vec3_add_n(rx, ry, rz, x0, y0, z0, x1, y1, z1, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t v0[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t v1[VEC3_SIZE] = {x1[i], y1[i], z1[i]};
+		mfloat_t expected[VEC3_SIZE];
+		vec3_add(expected, v0, v1);
+		mu_assert(stream_matches(rx, ry, rz, i, expected), "matches vec3_add");
+	}
+}
+
+MU_TEST(test_vec3_subtract_n)
+{
+	mfloat_t x0[STREAM_COUNT], y0[STREAM_COUNT], z0[STREAM_COUNT];
+	mfloat_t x1[STREAM_COUNT], y1[STREAM_COUNT], z1[STREAM_COUNT];
+	mfloat_t rx[STREAM_COUNT], ry[STREAM_COUNT], rz[STREAM_COUNT];
+	stream_fill(x0, y0, z0, 2.0f);
+	stream_fill(x1, y1, z1, -1.5f);
+	vec3_subtract_n(rx, ry, rz, x0, y0, z0, x1, y1, z1, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t v0[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t v1[VEC3_SIZE] = {x1[i], y1[i], z1[i]};
+		mfloat_t expected[VEC3_SIZE];
+		vec3_subtract(expected, v0, v1);
+		mu_assert(stream_matches(rx, ry, rz, i, expected), "matches vec3_subtract");
+	}
+}
+
+MU_TEST(test_vec3_multiply_n)
+{
+	mfloat_t x0[STREAM_COUNT], y0[STREAM_COUNT], z0[STREAM_COUNT];
+	mfloat_t x1[STREAM_COUNT], y1[STREAM_COUNT], z1[STREAM_COUNT];
+	mfloat_t rx[STREAM_COUNT], ry[STREAM_COUNT], rz[STREAM_COUNT];
+	stream_fill(x0, y0, z0, 2.0f);
+	stream_fill(x1, y1, z1, -1.5f);
+	vec3_multiply_n(rx, ry, rz, x0, y0, z0, x1, y1, z1, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t v0[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t v1[VEC3_SIZE] = {x1[i], y1[i], z1[i]};
+		mfloat_t expected[VEC3_SIZE];
+		vec3_multiply(expected, v0, v1);
+		mu_assert(stream_matches(rx, ry, rz, i, expected), "matches vec3_multiply");
+	}
+}
+
+MU_TEST(test_vec3_multiply_f_n)
+{
+	mfloat_t x0[STREAM_COUNT], y0[STREAM_COUNT], z0[STREAM_COUNT];
+	mfloat_t rx[STREAM_COUNT], ry[STREAM_COUNT], rz[STREAM_COUNT];
+	stream_fill(x0, y0, z0, 3.0f);
+	vec3_multiply_f_n(rx, ry, rz, x0, y0, z0, 2.5f, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t v0[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t expected[VEC3_SIZE];
+		vec3_multiply_f(expected, v0, 2.5f);
+		mu_assert(stream_matches(rx, ry, rz, i, expected), "matches vec3_multiply_f");
+	}
+}
+
+MU_TEST(test_vec3_negative_n)
+{
+	mfloat_t x0[STREAM_COUNT], y0[STREAM_COUNT], z0[STREAM_COUNT];
+	mfloat_t rx[STREAM_COUNT], ry[STREAM_COUNT], rz[STREAM_COUNT];
+	stream_fill(x0, y0, z0, 3.0f);
+	vec3_negative_n(rx, ry, rz, x0, y0, z0, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t v0[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t expected[VEC3_SIZE];
+		vec3_negative(expected, v0);
+		mu_assert(stream_matches(rx, ry, rz, i, expected), "matches vec3_negative");
+	}
+	vec3_negative_n(x0, y0, z0, x0, y0, z0, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mu_assert(x0[i] == rx[i] && y0[i] == ry[i] && z0[i] == rz[i], "in place");
+	}
+}
+
+MU_TEST(test_vec3_multiply_mat3_n)
+{
+	mfloat_t m[MAT3_SIZE] = {1.0f, 2.0f, 3.0f, -4.0f, 5.0f, 6.0f, 7.0f, -8.0f, 9.0f};
+	mfloat_t x0[STREAM_COUNT], y0[STREAM_COUNT], z0[STREAM_COUNT];
+	mfloat_t rx[STREAM_COUNT], ry[STREAM_COUNT], rz[STREAM_COUNT];
+	stream_fill(x0, y0, z0, 0.5f);
+	vec3_multiply_mat3_n(rx, ry, rz, x0, y0, z0, m, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t v0[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t expected[VEC3_SIZE];
+		vec3_multiply_mat3(expected, v0, m);
+		mu_assert(stream_matches(rx, ry, rz, i, expected), "matches vec3_multiply_mat3");
+	}
+}
+
+MU_TEST(test_vec3_cross_n)
+{
+	mfloat_t x0[STREAM_COUNT], y0[STREAM_COUNT], z0[STREAM_COUNT];
+	mfloat_t x1[STREAM_COUNT], y1[STREAM_COUNT], z1[STREAM_COUNT];
+	mfloat_t rx[STREAM_COUNT], ry[STREAM_COUNT], rz[STREAM_COUNT];
+	stream_fill(x0, y0, z0, 2.0f);
+	stream_fill(x1, y1, z1, -1.5f);
+	vec3_cross_n(rx, ry, rz, x0, y0, z0, x1, y1, z1, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t v0[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t v1[VEC3_SIZE] = {x1[i], y1[i], z1[i]};
+		mfloat_t expected[VEC3_SIZE];
+		vec3_cross(expected, v0, v1);
+		mu_assert(stream_matches(rx, ry, rz, i, expected), "matches vec3_cross");
+	}
+}
+
+MU_TEST(test_vec3_cross_n_in_place)
+{
+	mfloat_t x0[STREAM_COUNT], y0[STREAM_COUNT], z0[STREAM_COUNT];
+	mfloat_t x1[STREAM_COUNT], y1[STREAM_COUNT], z1[STREAM_COUNT];
+	mfloat_t ex[STREAM_COUNT], ey[STREAM_COUNT], ez[STREAM_COUNT];
+	stream_fill(x0, y0, z0, 2.0f);
+	stream_fill(x1, y1, z1, -1.5f);
+	vec3_cross_n(ex, ey, ez, x0, y0, z0, x1, y1, z1, STREAM_COUNT);
+	vec3_cross_n(x0, y0, z0, x0, y0, z0, x1, y1, z1, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t expected[VEC3_SIZE] = {ex[i], ey[i], ez[i]};
+		mu_assert(stream_matches(x0, y0, z0, i, expected), "in place");
+	}
+}
+
+MU_TEST(test_vec3_normalize_n)
+{
+	mfloat_t x0[STREAM_COUNT], y0[STREAM_COUNT], z0[STREAM_COUNT];
+	mfloat_t rx[STREAM_COUNT], ry[STREAM_COUNT], rz[STREAM_COUNT];
+	stream_fill(x0, y0, z0, 4.0f);
+	vec3_normalize_n(rx, ry, rz, x0, y0, z0, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t v0[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t expected[VEC3_SIZE];
+		vec3_normalize(expected, v0);
+		mu_assert(stream_matches(rx, ry, rz, i, expected), "matches vec3_normalize");
+	}
+	vec3_normalize_n(x0, y0, z0, x0, y0, z0, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t expected[VEC3_SIZE] = {rx[i], ry[i], rz[i]};
+		mu_assert(stream_matches(x0, y0, z0, i, expected), "in place");
+	}
+}
+
+MU_TEST(test_vec3_lerp_n)
+{
+	mfloat_t x0[STREAM_COUNT], y0[STREAM_COUNT], z0[STREAM_COUNT];
+	mfloat_t x1[STREAM_COUNT], y1[STREAM_COUNT], z1[STREAM_COUNT];
+	mfloat_t rx[STREAM_COUNT], ry[STREAM_COUNT], rz[STREAM_COUNT];
+	stream_fill(x0, y0, z0, 2.0f);
+	stream_fill(x1, y1, z1, -1.5f);
+	vec3_lerp_n(rx, ry, rz, x0, y0, z0, x1, y1, z1, 0.25f, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t v0[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t v1[VEC3_SIZE] = {x1[i], y1[i], z1[i]};
+		mfloat_t expected[VEC3_SIZE];
+		vec3_lerp(expected, v0, v1, 0.25f);
+		mu_assert(stream_matches(rx, ry, rz, i, expected), "matches vec3_lerp");
+	}
+}
+
+MU_TEST(test_vec3_dot_n)
+{
+	mfloat_t x0[STREAM_COUNT], y0[STREAM_COUNT], z0[STREAM_COUNT];
+	mfloat_t x1[STREAM_COUNT], y1[STREAM_COUNT], z1[STREAM_COUNT];
+	mfloat_t result[STREAM_COUNT];
+	stream_fill(x0, y0, z0, 2.0f);
+	stream_fill(x1, y1, z1, -1.5f);
+	vec3_dot_n(result, x0, y0, z0, x1, y1, z1, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t v0[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mfloat_t v1[VEC3_SIZE] = {x1[i], y1[i], z1[i]};
+		mu_assert(float_eq(vec3_dot(v0, v1), result[i]), "matches vec3_dot");
+	}
+}
+
+MU_TEST(test_vec3_length_n)
+{
+	mfloat_t x0[STREAM_COUNT], y0[STREAM_COUNT], z0[STREAM_COUNT];
+	mfloat_t length[STREAM_COUNT];
+	mfloat_t length_squared[STREAM_COUNT];
+	mfloat_t distance[STREAM_COUNT];
+	mfloat_t zero[STREAM_COUNT] = {0.0f};
+	stream_fill(x0, y0, z0, 2.0f);
+	vec3_length_n(length, x0, y0, z0, STREAM_COUNT);
+	vec3_length_squared_n(length_squared, x0, y0, z0, STREAM_COUNT);
+	vec3_distance_n(distance, x0, y0, z0, zero, zero, zero, STREAM_COUNT);
+	for (int i = 0; i < STREAM_COUNT; i++) {
+		mfloat_t v0[VEC3_SIZE] = {x0[i], y0[i], z0[i]};
+		mu_assert(float_eq(vec3_length(v0), length[i]), "matches vec3_length");
+		mu_assert(float_eq(vec3_length_squared(v0), length_squared[i]),
+				  "matches vec3_length_squared");
+		mu_assert(float_eq(vec3_length(v0), distance[i]), "distance to origin");
+	}
+}
+
+MU_TEST(test_vec3_stream_empty)
+{
+	mfloat_t x[1] = {1.0f};
+	vec3_add_n(x, x, x, x, x, x, x, x, x, 0);
+	vec3_normalize_n(x, x, x, x, x, x, 0);
+	mu_assert(float_eq(1.0f, x[0]), "untouched");
+}
+
 /* struct API */
 
 MU_TEST(test_svec3_create)
@@ -231,6 +459,54 @@ MU_TEST(test_svec3_chained)
 	mu_assert(float_eq(18.0f, result.z), "z");
 }
 
+MU_TEST(test_svec3_matches_array_api)
+{
+	mfloat_t a[VEC3_SIZE] = {1.5f, -2.0f, 3.25f};
+	mfloat_t b[VEC3_SIZE] = {-0.5f, 4.0f, 2.0f};
+	mfloat_t c[VEC3_SIZE] = {0.0f, 1.0f, 2.5f};
+	mfloat_t m[MAT3_SIZE] = {1.0f, 2.0f, -3.0f, 0.5f, 1.5f, 0.0f, -1.0f, 0.25f, 2.0f};
+	mfloat_t e[VEC3_SIZE];
+	struct vec3 v0 = svec3(a[0], a[1], a[2]);
+	struct vec3 v1 = svec3(b[0], b[1], b[2]);
+	struct vec3 v2 = svec3(c[0], c[1], c[2]);
+	struct mat3 m0 = smat3(m[0], m[3], m[6], m[1], m[4], m[7], m[2], m[5], m[8]);
+#define ASSERT_SVEC3(v, message)                                                                   \
+	mu_assert(float_eq(e[0], (v).x) && float_eq(e[1], (v).y) && float_eq(e[2], (v).z), message)
+	vec3_add(e, a, b);
+	ASSERT_SVEC3(svec3_add(v0, v1), "add");
+	vec3_subtract_f(e, a, 0.25f);
+	ASSERT_SVEC3(svec3_subtract_f(v0, 0.25f), "subtract_f");
+	vec3_multiply(e, a, b);
+	ASSERT_SVEC3(svec3_multiply(v0, v1), "multiply");
+	vec3_multiply_f(e, a, 3.0f);
+	ASSERT_SVEC3(svec3_multiply_f(v0, 3.0f), "multiply_f");
+	vec3_multiply_mat3(e, a, m);
+	ASSERT_SVEC3(svec3_multiply_mat3(v0, m0), "multiply_mat3");
+	vec3_divide_f(e, a, 2.0f);
+	ASSERT_SVEC3(svec3_divide_f(v0, 2.0f), "divide_f");
+	vec3_negative(e, a);
+	ASSERT_SVEC3(svec3_negative(v0), "negative");
+	vec3_round(e, a);
+	ASSERT_SVEC3(svec3_round(v0), "round");
+	vec3_max(e, a, b);
+	ASSERT_SVEC3(svec3_max(v0, v1), "max");
+	vec3_clamp(e, a, b, c);
+	ASSERT_SVEC3(svec3_clamp(v0, v1, v2), "clamp");
+	vec3_cross(e, a, b);
+	ASSERT_SVEC3(svec3_cross(v0, v1), "cross");
+	vec3_normalize(e, a);
+	ASSERT_SVEC3(svec3_normalize(v0), "normalize");
+	vec3_lerp(e, a, b, 0.3f);
+	ASSERT_SVEC3(svec3_lerp(v0, v1, 0.3f), "lerp");
+#undef ASSERT_SVEC3
+	mu_assert(float_eq(vec3_dot(a, b), svec3_dot(v0, v1)), "dot");
+	mu_assert(float_eq(vec3_length(a), svec3_length(v0)), "length");
+	mu_assert(float_eq(vec3_length_squared(a), svec3_length_squared(v0)), "length_squared");
+	mu_assert(float_eq(vec3_distance(a, b), svec3_distance(v0, v1)), "distance");
+	mu_assert(float_eq(vec3_distance_squared(a, b), svec3_distance_squared(v0, v1)),
+			  "distance_squared");
+}
+
 MU_TEST_SUITE(test_suite)
 {
 	MU_RUN_TEST(test_vec3_create);
@@ -250,6 +526,20 @@ MU_TEST_SUITE(test_suite)
 	MU_RUN_TEST(test_vec3_lerp);
 	MU_RUN_TEST(test_vec3_clamp);
 
+	MU_RUN_TEST(test_vec3_add_n);
+	MU_RUN_TEST(test_vec3_subtract_n);
+	MU_RUN_TEST(test_vec3_multiply_n);
+	MU_RUN_TEST(test_vec3_multiply_f_n);
+	MU_RUN_TEST(test_vec3_negative_n);
+	MU_RUN_TEST(test_vec3_multiply_mat3_n);
+	MU_RUN_TEST(test_vec3_cross_n);
+	MU_RUN_TEST(test_vec3_cross_n_in_place);
+	MU_RUN_TEST(test_vec3_normalize_n);
+	MU_RUN_TEST(test_vec3_lerp_n);
+	MU_RUN_TEST(test_vec3_dot_n);
+	MU_RUN_TEST(test_vec3_length_n);
+	MU_RUN_TEST(test_vec3_stream_empty);
+
 	MU_RUN_TEST(test_svec3_create);
 	MU_RUN_TEST(test_svec3_add);
 	MU_RUN_TEST(test_svec3_cross);
@@ -257,6 +547,7 @@ MU_TEST_SUITE(test_suite)
 	MU_RUN_TEST(test_svec3_dot);
 	MU_RUN_TEST(test_svec3_length);
 	MU_RUN_TEST(test_svec3_chained);
+	MU_RUN_TEST(test_svec3_matches_array_api);
 }
 
 int main(int argc, char** argv)
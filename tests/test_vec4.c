@@ -105,6 +105,28 @@ MU_TEST(test_vec4_negative)
 	mu_assert(float_eq(9.0f, result[3]), "w");
 }
 
+MU_TEST(test_vec4_multiply_mat4)
+{
+	// Column-major: columns (1,2,3,4), (5,6,7,8), (9,10,11,12), (13,14,15,16)
+	mfloat_t m[MAT4_SIZE];
+	for (int i = 0; i < MAT4_SIZE; i++) {
+		m[i] = (mfloat_t)(i + 1);
+	}
+	mfloat_t v0[VEC4_SIZE] = {1.0f, -2.0f, 0.5f, 3.0f};
+	mfloat_t result[VEC4_SIZE];
+	vec4_multiply_mat4(result, v0, m);
+	mu_assert(float_eq(34.5f, result[0]), "x");
+	mu_assert(float_eq(37.0f, result[1]), "y");
+	mu_assert(float_eq(39.5f, result[2]), "z");
+	mu_assert(float_eq(42.0f, result[3]), "w");
+
+	vec4_multiply_mat4(v0, v0, m);
+	mu_assert(float_eq(34.5f, v0[0]), "aliased x");
+	mu_assert(float_eq(37.0f, v0[1]), "aliased y");
+	mu_assert(float_eq(39.5f, v0[2]), "aliased z");
+	mu_assert(float_eq(42.0f, v0[3]), "aliased w");
+}
+
 MU_TEST(test_vec4_normalize)
 {
 	mfloat_t v0[VEC4_SIZE] = {2.0f, 0.0f, 0.0f, 0.0f};
@@ -178,6 +200,42 @@ MU_TEST(test_svec4_lerp)
 	mu_assert(float_eq(10.0f, result.y), "y");
 }
 
+MU_TEST(test_svec4_matches_array_api)
+{
+	mfloat_t a[VEC4_SIZE] = {1.5f, -2.0f, 3.25f, 0.75f};
+	mfloat_t b[VEC4_SIZE] = {-0.5f, 4.0f, 2.0f, -1.0f};
+	mfloat_t c[VEC4_SIZE] = {0.0f, 1.0f, 2.5f, 0.5f};
+	mfloat_t e[VEC4_SIZE];
+	struct vec4 v0 = svec4(a[0], a[1], a[2], a[3]);
+	struct vec4 v1 = svec4(b[0], b[1], b[2], b[3]);
+	struct vec4 v2 = svec4(c[0], c[1], c[2], c[3]);
+#define ASSERT_SVEC4(v, message)                                                                   \
+	mu_assert(float_eq(e[0], (v).x) && float_eq(e[1], (v).y) && float_eq(e[2], (v).z) &&           \
+				  float_eq(e[3], (v).w),                                                           \
+			  message)
+	vec4_add(e, a, b);
+	ASSERT_SVEC4(svec4_add(v0, v1), "add");
+	vec4_subtract(e, a, b);
+	ASSERT_SVEC4(svec4_subtract(v0, v1), "subtract");
+	vec4_multiply_f(e, a, 3.0f);
+	ASSERT_SVEC4(svec4_multiply_f(v0, 3.0f), "multiply_f");
+	vec4_divide(e, a, b);
+	ASSERT_SVEC4(svec4_divide(v0, v1), "divide");
+	vec4_negative(e, a);
+	ASSERT_SVEC4(svec4_negative(v0), "negative");
+	vec4_ceil(e, a);
+	ASSERT_SVEC4(svec4_ceil(v0), "ceil");
+	vec4_min(e, a, b);
+	ASSERT_SVEC4(svec4_min(v0, v1), "min");
+	vec4_clamp(e, a, b, c);
+	ASSERT_SVEC4(svec4_clamp(v0, v1, v2), "clamp");
+	vec4_normalize(e, a);
+	ASSERT_SVEC4(svec4_normalize(v0), "normalize");
+	vec4_lerp(e, a, b, 0.3f);
+	ASSERT_SVEC4(svec4_lerp(v0, v1, 0.3f), "lerp");
+#undef ASSERT_SVEC4
+}
+
 MU_TEST_SUITE(test_suite)
 {
 	MU_RUN_TEST(test_vec4_create);
@@ -189,6 +247,7 @@ MU_TEST_SUITE(test_suite)
 	MU_RUN_TEST(test_vec4_multiply);
 	MU_RUN_TEST(test_vec4_divide);
 	MU_RUN_TEST(test_vec4_negative);
+	MU_RUN_TEST(test_vec4_multiply_mat4);
 	MU_RUN_TEST(test_vec4_normalize);
 	MU_RUN_TEST(test_vec4_lerp);
 	MU_RUN_TEST(test_vec4_clamp);
@@ -197,6 +256,7 @@ MU_TEST_SUITE(test_suite)
 	MU_RUN_TEST(test_svec4_add);
 	MU_RUN_TEST(test_svec4_normalize);
 	MU_RUN_TEST(test_svec4_lerp);
+	MU_RUN_TEST(test_svec4_matches_array_api);
 }
 
 int main(int argc, char** argv)
@@ -25,7 +25,7 @@ def find_clang_format() -> str:
 def collect_files(root: Path) -> list[Path]:
     targets: list[Path] = []
     extensions = (".c", ".cc", ".cpp", ".h", ".hpp")
-    for rel_dir in ("source", "tests"):
+    for rel_dir in ("source", "tests", "bench"):
         base = root / rel_dir
         if not base.exists():
             continue
@@ -48,7 +48,7 @@ def main() -> int:
 
     files = collect_files(root)
     if not files:
-        print("No C/C++ source files found under 'source/' or 'tests/'. Nothing to do.")
+        print("No C/C++ source files found under 'source/', 'tests/' or 'bench/'. Nothing to do.")
         return 0
 
     failures: list[tuple[Path, str]] = []